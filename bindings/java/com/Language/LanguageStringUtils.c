@@ -10,8 +10,10 @@ JNIEXPORT jint JNICALL Java_com_Language_LanguageStringUtils_length(JNIEnv * env
 	if(buffer == NULL){
 		return -1;
 	}
-
-	return len(buffer, encoding);
+	jsize numberOfBytes = (*env)->GetStringUTFLength(env, str);
+	int result = lenBounded(buffer, (size_t)numberOfBytes, encoding);
+	(*env)->ReleaseStringUTFChars(env, str, buffer);
+	return result;
 }
 
 /**
@@ -21,7 +23,11 @@ JNIEXPORT jint JNICALL Java_com_Language_LanguageStringUtils_lengthEscaped(JNIEn
 		jint encoding, jstring estr, jint escapedEncoding){
 	const char * buffer = (*env)->GetStringUTFChars(env, str, NULL);
 	const char * escapedStr = (*env)->GetStringUTFChars(env, estr, NULL);
-	return lenEscaped(buffer, encoding, escapedStr, escapedEncoding, NULL);
+	jsize numberOfBytes = (*env)->GetStringUTFLength(env, str);
+	int result = lenEscapedBounded(buffer, (size_t)numberOfBytes, encoding, escapedStr, escapedEncoding, NULL);
+	(*env)->ReleaseStringUTFChars(env, str, buffer);
+	(*env)->ReleaseStringUTFChars(env, estr, escapedStr);
+	return result;
 }
 
 /**
@@ -32,7 +38,12 @@ JNIEXPORT jint JNICALL Java_com_Language_LanguageStringUtils_lengthEscapedWithEn
 	const char * buffer = (*env)->GetStringUTFChars(env, str, NULL);
 	const char * escapedStr = (*env)->GetStringUTFChars(env, estr, NULL);
 	const char * endString = (*env)->GetStringUTFChars(env, nstr, NULL);
-	return lenEscaped(buffer, encoding, escapedStr,escapedEncoding, endString);
+	jsize numberOfBytes = (*env)->GetStringUTFLength(env, str);
+	int result = lenEscapedBounded(buffer, (size_t)numberOfBytes, encoding, escapedStr, escapedEncoding, endString);
+	(*env)->ReleaseStringUTFChars(env, str, buffer);
+	(*env)->ReleaseStringUTFChars(env, estr, escapedStr);
+	(*env)->ReleaseStringUTFChars(env, nstr, endString);
+	return result;
 }
 
 
@@ -40,28 +51,28 @@ JNIEXPORT jint JNICALL Java_com_Language_LanguageStringUtils_lengthEscapedWithEn
  * Check if a sequence is a natural number
  */
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isNaturalNumber(JNIEnv * env, jobject thisObj, jstring str, jint encoding){
-	return sequenceCheck(isNumberSequence, env, thisObj, str, encoding);
+	return sequenceCheck(isNumberSequenceBounded, env, thisObj, str, encoding);
 }
 
 /**
  * Check if a sequence is a hex number
  */
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isHexNumber(JNIEnv * env, jobject thisObj, jstring str, jint encoding){
-	return sequenceCheck(isHexSequence, env, thisObj, str, encoding);
+	return sequenceCheck(isHexSequenceBounded, env, thisObj, str, encoding);
 }
 
 /**
  * Check if a sequence is a valid character
  */
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isValid(JNIEnv * env, jobject thisObj, jstring str, jint encoding){
-	return sequenceCheck(isValidCharacterSequence,env, thisObj, str, encoding);
+	return sequenceCheck(isValidCharacterSequenceBounded,env, thisObj, str, encoding);
 }
 
 /**
  * Check if a sequence is in the romance alphabet
  */
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isInRomanceAlphabet(JNIEnv * env, jobject thisObj, jstring str, jint encoding){
-	return sequenceCheck(isInRomanceAlphabetSequence, env, thisObj, str, encoding);
+	return sequenceCheck(isInRomanceAlphabetSequenceBounded, env, thisObj, str, encoding);
 }
 
 
@@ -70,7 +81,7 @@ JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isInRomanceAlph
  */
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isInAlphabet
 (JNIEnv * env, jobject obj, jstring str, jint encoding, jint language){
-	return alphabetLanguageSequenceCheck(isInAlphabetSequence, env, obj, str, encoding, language);
+	return alphabetLanguageSequenceCheck(isInAlphabetSequenceBounded, env, obj, str, encoding, language);
 }
 
 /**
@@ -79,7 +90,7 @@ JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isInAlphabet
  */
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isUpperCaseInAlphabet
 (JNIEnv * env, jobject obj, jstring str, jint encoding, jint language){
-	return alphabetLanguageSequenceCheck(isUpperCaseInAlphabetSequence, env, obj, str, encoding, language);
+	return alphabetLanguageSequenceCheck(isUpperCaseInAlphabetSequenceBounded, env, obj, str, encoding, language);
 }
 
 /**
@@ -88,7 +99,7 @@ JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isUpperCaseInAl
  */
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isLowerCaseInAlphabet
 (JNIEnv * env, jobject obj, jstring str, jint encoding, jint language){
-	return alphabetLanguageSequenceCheck(isLowerCaseInAlphabetSequence, env, obj, str, encoding, language);
+	return alphabetLanguageSequenceCheck(isLowerCaseInAlphabetSequenceBounded, env, obj, str, encoding, language);
 }
 
 /**
@@ -97,8 +108,162 @@ JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isLowerCaseInAl
  */
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isPunctuationMarkInAlphabet
 (JNIEnv * env, jobject obj, jstring str, jint encoding, jint language){
-	return alphabetLanguageSequenceCheck(isPunctuationMarkInAlphabetSequence, env, obj, str, encoding, language);
+	return alphabetLanguageSequenceCheck(isPunctuationMarkInAlphabetSequenceBounded, env, obj, str, encoding, language);
+}
+
+/**
+ * Validate the utf8 of a byte array. Returns the offset of the first malformed
+ * character, or -1 for valid utf8. A null array throws a NullPointerException,
+ * and an array that cannot be pinned returns with the pending exception, as
+ * no offset can stand for either
+ */
+JNIEXPORT jint JNICALL Java_com_Language_LanguageStringUtils_validateUTF8(JNIEnv * env, jobject obj, jbyteArray data){
+	if(data == NULL){
+		jclass exceptionClass = (*env)->FindClass(env, "java/lang/NullPointerException");
+		if(exceptionClass != NULL){
+			(*env)->ThrowNew(env, exceptionClass, "validateUTF8 expects a byte array");
+		}
+		return -1;
+	}
+	jsize numberOfBytes = (*env)->GetArrayLength(env, data);
+	jbyte * buffer = (jbyte *)(*env)->GetPrimitiveArrayCritical(env, data, NULL);
+	if(buffer == NULL){
+		// The return value is ignored while an exception is pending
+		return -1;
+	}
+	size_t errorOffset = 0;
+	int result = validateUTF8((const char *)buffer, (size_t)numberOfBytes, &errorOffset);
+	(*env)->ReleasePrimitiveArrayCritical(env, data, buffer, JNI_ABORT);
+	return result ? -1 : (jint)errorOffset;
 }
 
+/**
+ * Copy the utf16 code units of a java string into a buffer that the caller
+ * frees. The bytes of GetStringUTFChars are modified utf8, which writes NUL
+ * and the characters past the BMP differently from utf8, so the classes of a
+ * java string are found in its code units. Returns NULL when the buffer
+ * could not be allocated
+ */
+static jchar * getStringUnits(JNIEnv * env, jstring str, jsize * numberOfUnits){
+	*numberOfUnits = (*env)->GetStringLength(env, str);
+	jchar * units = (jchar *)malloc(((size_t)*numberOfUnits + 1) * sizeof(jchar));
+	if(units != NULL){
+		(*env)->GetStringRegion(env, str, 0, *numberOfUnits, units);
+	}
+	return units;
+}
 
+/**
+ * Classify a sequence in one pass. The code units of the string are
+ * classified as utf16 whatever the encoding asked for. Returns the character
+ * classes that every character has
+ */
+JNIEXPORT jint JNICALL Java_com_Language_LanguageStringUtils_classify(JNIEnv * env, jobject obj, jstring str, jint encoding,
+		jint language){
+	jsize numberOfUnits = 0;
+	jchar * units = getStringUnits(env, str, &numberOfUnits);
+	if(units == NULL){
+		return 0;
+	}
+	int result = classifySequenceBounded((const char *)units, (size_t)numberOfUnits * sizeof(jchar), UTF16, language);
+	free(units);
+	return result;
+}
 
+/**
+ * Count the characters of a sequence in each character class in one pass.
+ * The code units of the string are counted as utf16 whatever the encoding
+ * asked for. Returns a ClassHistogram, or NULL for a malformed sequence
+ */
+JNIEXPORT jobject JNICALL Java_com_Language_LanguageStringUtils_classHistogram(JNIEnv * env, jobject obj, jstring str, jint encoding,
+		jint language){
+	jclass histogramClass = (*env)->FindClass(env, "com/Language/types/ClassHistogram");
+	if(histogramClass == NULL){
+		return NULL;
+	}
+	jmethodID constructor = (*env)->GetMethodID(env, histogramClass, "<init>", "(IIIIIIII)V");
+	if(constructor == NULL){
+		return NULL;
+	}
+	jsize numberOfUnits = 0;
+	jchar * units = getStringUnits(env, str, &numberOfUnits);
+	if(units == NULL){
+		return NULL;
+	}
+	characterClassHistogram histogram;
+	int result = classHistogramBounded((const char *)units, (size_t)numberOfUnits * sizeof(jchar), UTF16, language, &histogram);
+	free(units);
+	if(!result){
+		return NULL;
+	}
+	return (*env)->NewObject(env, histogramClass, constructor, (jint)histogram.numberOfCharacters, (jint)histogram.alphabet,
+			(jint)histogram.upperCase, (jint)histogram.lowerCase, (jint)histogram.digits, (jint)histogram.punctuationMarks,
+			(jint)histogram.extended, (jint)histogram.diacriticalMarks);
+}
+
+/**
+ * Score a sequence in every language in one pass. The code units of the
+ * string are scored as utf16 whatever the encoding asked for. Returns the
+ * scores indexed by the language, or NULL for a malformed sequence
+ */
+JNIEXPORT jlongArray JNICALL Java_com_Language_LanguageStringUtils_scoreLanguages(JNIEnv * env, jobject obj, jstring str,
+		jint encoding){
+	jsize numberOfUnits = 0;
+	jchar * units = getStringUnits(env, str, &numberOfUnits);
+	if(units == NULL){
+		return NULL;
+	}
+	long long scores[NUMBER_OF_LANGUAGES];
+	jlong values[NUMBER_OF_LANGUAGES];
+	int language = scoreLanguagesBounded((const char *)units, (size_t)numberOfUnits * sizeof(jchar), UTF16, scores);
+	free(units);
+	if(language == -1){
+		return NULL;
+	}
+	jlongArray result = (*env)->NewLongArray(env, NUMBER_OF_LANGUAGES);
+	if(result == NULL){
+		return NULL;
+	}
+	for(language = 0; language < NUMBER_OF_LANGUAGES; language++){
+		values[language] = (jlong)scores[language];
+	}
+	(*env)->SetLongArrayRegion(env, result, 0, NUMBER_OF_LANGUAGES, values);
+	return result;
+}
+
+/**
+ * Convert the case of the letters of a sequence in an alphabet into a new
+ * string. The characters of a java string are utf16 whatever the encoding
+ * asked for, and its utf8 bytes are modified utf8, so they are converted as
+ * utf16. Returns NULL for an unknown language
+ */
+static jstring convertCase(JNIEnv * env, jstring str, jint encoding, jint language, int (*func)(char *, size_t, int, int)){
+	jsize numberOfUnits = (*env)->GetStringLength(env, str);
+	jchar * converted = (jchar *)malloc(((size_t)numberOfUnits + 1) * sizeof(jchar));
+	if(converted == NULL){
+		return NULL;
+	}
+	(*env)->GetStringRegion(env, str, 0, numberOfUnits, converted);
+	jstring result = NULL;
+	if(func((char *)converted, (size_t)numberOfUnits * sizeof(jchar), UTF16, language) != -1){
+		result = (*env)->NewString(env, converted, numberOfUnits);
+	}
+	free(converted);
+	return result;
+}
+
+/**
+ * Convert the letters of a sequence to the upper case of an alphabet
+ */
+JNIEXPORT jstring JNICALL Java_com_Language_LanguageStringUtils_toUpperInAlphabet(JNIEnv * env, jobject obj, jstring str, jint encoding,
+		jint language){
+	return convertCase(env, str, encoding, language, toUpperInAlphabetBounded);
+}
+
+/**
+ * Convert the letters of a sequence to the lower case of an alphabet
+ */
+JNIEXPORT jstring JNICALL Java_com_Language_LanguageStringUtils_toLowerInAlphabet(JNIEnv * env, jobject obj, jstring str, jint encoding,
+		jint language){
+	return convertCase(env, str, encoding, language, toLowerInAlphabetBounded);
+}
@@ -96,6 +96,54 @@ JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isLowerCaseInAl
 JNIEXPORT jboolean JNICALL Java_com_Language_LanguageStringUtils_isPunctuationMarkInAlphabet
 (JNIEnv *, jobject, jstring, jint, jint);
 
+/*
+ * Class:     LanguageStringUtils
+ * Method:    validateUTF8
+ * Signature: ([B)I
+ */
+JNIEXPORT jint JNICALL Java_com_Language_LanguageStringUtils_validateUTF8
+(JNIEnv *, jobject, jbyteArray);
+
+/*
+ * Class:     LanguageStringUtils
+ * Method:    classify
+ * Signature: (Ljava/lang/String;II)I
+ */
+JNIEXPORT jint JNICALL Java_com_Language_LanguageStringUtils_classify
+(JNIEnv *, jobject, jstring, jint, jint);
+
+/*
+ * Class:     LanguageStringUtils
+ * Method:    classHistogram
+ * Signature: (Ljava/lang/String;II)Lcom/Language/types/ClassHistogram;
+ */
+JNIEXPORT jobject JNICALL Java_com_Language_LanguageStringUtils_classHistogram
+(JNIEnv *, jobject, jstring, jint, jint);
+
+/*
+ * Class:     LanguageStringUtils
+ * Method:    scoreLanguages
+ * Signature: (Ljava/lang/String;I)[J
+ */
+JNIEXPORT jlongArray JNICALL Java_com_Language_LanguageStringUtils_scoreLanguages
+(JNIEnv *, jobject, jstring, jint);
+
+/*
+ * Class:     LanguageStringUtils
+ * Method:    toUpperInAlphabet
+ * Signature: (Ljava/lang/String;II)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_com_Language_LanguageStringUtils_toUpperInAlphabet
+(JNIEnv *, jobject, jstring, jint, jint);
+
+/*
+ * Class:     LanguageStringUtils
+ * Method:    toLowerInAlphabet
+ * Signature: (Ljava/lang/String;II)Ljava/lang/String;
+ */
+JNIEXPORT jstring JNICALL Java_com_Language_LanguageStringUtils_toLowerInAlphabet
+(JNIEnv *, jobject, jstring, jint, jint);
+
 #ifdef __cplusplus
 }
 #endif
@@ -1,4 +1,6 @@
 package com.Language;
+
+import com.Language.types.ClassHistogram;
 /**
  * The Language string utils interface
  * @author danielortiz
@@ -101,6 +103,62 @@ public class LanguageStringUtils{
 	 */
 	public native boolean isPunctuationMarkInAlphabet(String str, int encoding, int language);
 	
+	/**
+	 * Validate the utf8 of a byte array
+	 * @param data The utf8 bytes
+	 * @return The offset of the first malformed character, or -1 for valid utf8
+	 * @throws NullPointerException If data is null
+	 */
+	public native int validateUTF8(byte[] data);
+	
+	/**
+	 * Classify a character sequence in one pass
+	 * @param str A java string
+	 * @param encoding The encoding of the str, a java string is always classified as UTF16
+	 * @param language The language of the str
+	 * @return The bits of the CharacterClasses that every character has
+	 */
+	public native int classify(String str, int encoding, int language);
+	
+	/**
+	 * Count the characters of a character sequence in each character class
+	 * in one pass
+	 * @param str A java string
+	 * @param encoding The encoding of the str, a java string is always counted as UTF16
+	 * @param language The language of the str
+	 * @return The counts, or null for a malformed str
+	 */
+	public native ClassHistogram classHistogram(String str, int encoding, int language);
+	
+	/**
+	 * Score a character sequence in every language in one pass
+	 * @param str A java string
+	 * @param encoding The encoding of the str, a java string is always scored as UTF16
+	 * @return The scores indexed by the LanguageEncodings value, where the
+	 * highest score is the most likely language, or null for a malformed str
+	 */
+	public native long[] scoreLanguages(String str, int encoding);
+	
+	/**
+	 * Convert the letters of a character sequence to the upper case of an
+	 * alphabet
+	 * @param str A java string
+	 * @param encoding The encoding of the str, a java string is always converted as UTF16
+	 * @param language The language of the str
+	 * @return The converted str, or null for an unknown language
+	 */
+	public native String toUpperInAlphabet(String str, int encoding, int language);
+	
+	/**
+	 * Convert the letters of a character sequence to the lower case of an
+	 * alphabet
+	 * @param str A java string
+	 * @param encoding The encoding of the str, a java string is always converted as UTF16
+	 * @param language The language of the str
+	 * @return The converted str, or null for an unknown language
+	 */
+	public native String toLowerInAlphabet(String str, int encoding, int language);
+	
 	public static void main(String[] args) {
 		new LanguageStringUtils().length("Hello", 0);  // invoke the native method
 	}
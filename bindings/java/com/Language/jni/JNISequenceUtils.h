@@ -8,13 +8,15 @@
  * A function that generically performs a sequence check for a string
  * in a specific encoding.
  */
-static jboolean sequenceCheck(int (*func)(const char *, int), JNIEnv * env, jobject obj,
+static jboolean sequenceCheck(int (*func)(const char *, size_t, int), JNIEnv * env, jobject obj,
 		jstring str, jint encoding){
 	const char * buffer = (*env)->GetStringUTFChars(env, str, NULL);
 	if(buffer == NULL){
 		return JNI_FALSE;
 	}
-	int result = func(buffer, encoding);
+	jsize numberOfBytes = (*env)->GetStringUTFLength(env, str);
+	int result = func(buffer, (size_t)numberOfBytes, encoding);
+	(*env)->ReleaseStringUTFChars(env, str, buffer);
 	if(result == 0){
 		return JNI_FALSE;
 	}else{
@@ -32,7 +34,9 @@ static jboolean sequenceCheckAtIndex(int (*func)(const char *, int), JNIEnv * en
 	if(buffer == NULL){
 		return JNI_FALSE;
 	}
-	int result = isSequenceAtIndex(func, buffer, encoding, index);
+	jsize numberOfBytes = (*env)->GetStringUTFLength(env, str);
+	int result = isSequenceAtIndexBounded(func, buffer, (size_t)numberOfBytes, encoding, index);
+	(*env)->ReleaseStringUTFChars(env, str, buffer);
 	if(result == 0){
 		return JNI_FALSE;
 	}else{
@@ -45,13 +49,15 @@ static jboolean sequenceCheckAtIndex(int (*func)(const char *, int), JNIEnv * en
  * generic function provides the interface for all other language
  * specific function
  */
-static jboolean alphabetLanguageSequenceCheck(int (*func)(const char *, int, int), JNIEnv * env, jobject obj,
+static jboolean alphabetLanguageSequenceCheck(int (*func)(const char *, size_t, int, int), JNIEnv * env, jobject obj,
 		jstring str, jint encoding, jint language){
 	const char * buffer = (*env)->GetStringUTFChars(env, str, NULL);
 	if(buffer == NULL){
 		return JNI_FALSE;
 	}
-	int result = func(buffer, encoding, language);
+	jsize numberOfBytes = (*env)->GetStringUTFLength(env, str);
+	int result = func(buffer, (size_t)numberOfBytes, encoding, language);
+	(*env)->ReleaseStringUTFChars(env, str, buffer);
 	if(result == 0){
 		return JNI_FALSE;
 	}else{
@@ -70,7 +76,9 @@ static jboolean alphabetLanguageSequenceCheckAtIndex(int (*func)(const char *, i
 	if(buffer == NULL){
 		return JNI_FALSE;
 	}
-	int result = isLanguageSequenceAtIndex(func, buffer, encoding, language, index);
+	jsize numberOfBytes = (*env)->GetStringUTFLength(env, str);
+	int result = isLanguageSequenceAtIndexBounded(func, buffer, (size_t)numberOfBytes, encoding, language, index);
+	(*env)->ReleaseStringUTFChars(env, str, buffer);
 	if(result == 0){
 		return JNI_FALSE;
 	}else{
@@ -0,0 +1,37 @@
+package com.Language.types;
+
+/**
+ * The Language character classes, the bits of a classify result
+ * @author danielortiz
+ */
+public enum CharacterClasses{
+	ALPHA(0x001),
+	UPPER(0x002),
+	LOWER(0x004),
+	DIGIT(0x008),
+	HEX(0x010),
+	PUNCT(0x020),
+	EXTENDED(0x040),
+	VALID(0x080),
+	ROMANCE(0x100);
+	
+	private int state;
+	private CharacterClasses(int s){
+		state = s;
+	}
+	
+	/**
+	 * Get the bit associated with the character class
+	 */
+	public int getClassValue(){
+		return state;
+	}
+	
+	/**
+	 * Check if the class is set in a classify result
+	 * @param classes The result of classify
+	 */
+	public boolean isIn(int classes){
+		return (classes & state) != 0;
+	}
+}
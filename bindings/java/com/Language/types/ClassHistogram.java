@@ -0,0 +1,28 @@
+package com.Language.types;
+
+/**
+ * The number of characters of a string in each character class
+ * @author danielortiz
+ */
+public class ClassHistogram{
+	public final int characters;
+	public final int alphabet;
+	public final int upperCase;
+	public final int lowerCase;
+	public final int digits;
+	public final int punctuationMarks;
+	public final int extended;
+	public final int diacriticalMarks;
+	
+	public ClassHistogram(int characters, int alphabet, int upperCase, int lowerCase, int digits,
+			int punctuationMarks, int extended, int diacriticalMarks){
+		this.characters = characters;
+		this.alphabet = alphabet;
+		this.upperCase = upperCase;
+		this.lowerCase = lowerCase;
+		this.digits = digits;
+		this.punctuationMarks = punctuationMarks;
+		this.extended = extended;
+		this.diacriticalMarks = diacriticalMarks;
+	}
+}
@@ -1,5 +1,7 @@
 package com.Language.types;
 
+// Generated by generateLanguageTables.py from languages.json. Do not edit.
+
 /**
  * The Language string encoding types
  * @author danielortiz
@@ -21,4 +23,3 @@ public enum LanguageEncodings{
 		return state;
 	}
 }
-	
\ No newline at end of file
@@ -16,32 +16,60 @@
 #define __NODE_BASE_UTILS_H__
 
 #include <node.h>
-#include "../../../lib/stringUtils.h"
+#include <node_buffer.h>
+#include "../../../lib/stringUtils.hpp"
 
 /**
- * A helper function that checks using func a string in a particular encoding
+ * The bytes of a string or node::Buffer argument. A Buffer is read in place
+ * and a string is converted to utf8 once, so the byte length is known
+ * without a scan of the bytes.
+ */
+class ArgumentBuffer{
+public:
+	explicit ArgumentBuffer(v8::Handle<v8::Value> value) :
+		utf8Value(value->IsString() ? value : v8::Handle<v8::Value>()), buffer(NULL), numberOfBytes(0){
+		if(node::Buffer::HasInstance(value)){
+			buffer = node::Buffer::Data(value);
+			numberOfBytes = node::Buffer::Length(value);
+		}else if(value->IsString()){
+			buffer = *utf8Value;
+			numberOfBytes = utf8Value.length();
+		}
+	}
+
+	// Check that the argument was a string or a buffer
+	bool isValid() const{
+		return buffer != NULL;
+	}
+
+private:
+	v8::String::Utf8Value utf8Value;	// The utf8 copy of a string argument
+
+public:
+	const char * buffer;				// The bytes of the argument
+	size_t numberOfBytes;				// The number of bytes in the argument
+};
+
+/**
+ * A helper function that checks a string in a particular encoding with a
+ * predicate of stringUtils.hpp
  * @param args The v8 arguments
- * @param func The funcion to be used on the v8:Arguments
  */
-static int checkStringInEncoding(const v8::Arguments & args, int (*func)(const char *, int)){
+template<typename Predicate>
+static int checkStringInEncoding(const v8::Arguments & args){
 	// The base encoding
 	int encoding = UTF8_BINARY;
-	const char * buffer;
-	bool isValid = false;
+	ArgumentBuffer argument(args[0]);
 
 	// Get the variables from the arguments
-	if(args[0]->IsString()){
-		buffer = *v8::String::Utf8Value(args[0]);
-		isValid = true;
-	}
 	if(args[1]->IsNumber()){
 		encoding = args[1]->Uint32Value();
 	}
 
 	// Find the length if we have a valid call. If not return 0
 	int result = 0;
-	if(isValid){
-		result = func(buffer, encoding);
+	if(argument.isValid()){
+		result = language::isSequenceOf<Predicate>(argument.buffer, argument.numberOfBytes, encoding);
 	}
 	return result;
 }
@@ -55,48 +83,38 @@ static int checkStringInEncoding(const v8::Arguments & args, int (*func)(const c
 static int checkStringInEncodingAtIndex(const v8::Arguments & args, int (*func)(const char *, int)){
 	// The base encoding
 	int encoding = UTF8_BINARY;
-	const char * buffer;
-	bool isValid = false;
+	ArgumentBuffer argument(args[0]);
 	int index = 0;
 
 	// Get the variables from the arguments
-	if(args[0]->IsString()){
-		buffer = *v8::String::Utf8Value(args[0]);
-		isValid = true;
-	}
 	if(args[1]->IsNumber()){
 		encoding = args[1]->Uint32Value();
 	}
 	if(args[2]->IsNumber()){
-		index = args[1]->Uint32Value();
+		index = args[2]->Uint32Value();
 	}
 
 	// Find the length if we have a valid call. If not return 0
 	int result = 0;
-	if(isValid){
-		result = isSequenceAtIndex(func, buffer, encoding, index);
+	if(argument.isValid()){
+		result = isSequenceAtIndexBounded(func, argument.buffer, argument.numberOfBytes, encoding, index);
 	}
 	return result;
 }
 
 /**
- * A hlerp function that checks using a function if a string in particular encoding
- * and language has a certain characteristic
+ * A helper function that checks if a string in particular encoding and language
+ * has a certain characteristic with a predicate of stringUtils.hpp
  * @param args The v8 arguments
- * @param func The function to be used on the v8:Arguments
  */
-static int checkStringInEncodingAndLanguage(const v8::Arguments & args, int (*func)(const char *, int, int)){
+template<typename Predicate>
+static int checkStringInEncodingAndLanguage(const v8::Arguments & args){
 	// The base encoding
 	int encoding = UTF8_BINARY;
 	int language = ENGLISH;
-	const char * buffer;
-	bool isValid = false;
+	ArgumentBuffer argument(args[0]);
 
 	// Get the variables from the arguments
-	if(args[0]->IsString()){
-		buffer = *v8::String::Utf8Value(args[0]);
-		isValid = true;
-	}
 	if(args[1]->IsNumber()){
 		encoding = args[1]->Uint32Value();
 	}
@@ -106,8 +124,8 @@ static int checkStringInEncodingAndLanguage(const v8::Arguments & args, int (*fu
 
 	// Find the length if we have a valid call. If not return 0
 	int result = 0;
-	if(isValid){
-		result = func(buffer, encoding, language);
+	if(argument.isValid()){
+		result = language::isSequenceOf<Predicate>(argument.buffer, argument.numberOfBytes, encoding, language);
 	}
 	return result;
 }
@@ -122,15 +140,10 @@ static int checkStringInEncodingAndLanguageAtIndex(const v8::Arguments & args, i
 	// The base encoding
 	int encoding = UTF8_BINARY;
 	int language = ENGLISH;
-	const char * buffer;
+	ArgumentBuffer argument(args[0]);
 	int index = 0;
-	bool isValid = false;
 
 	// Get the variables from the arguments
-	if(args[0]->IsString()){
-		buffer = *v8::String::Utf8Value(args[0]);
-		isValid = true;
-	}
 	if(args[1]->IsNumber()){
 		encoding = args[1]->Uint32Value();
 	}
@@ -143,8 +156,8 @@ static int checkStringInEncodingAndLanguageAtIndex(const v8::Arguments & args, i
 
 	// Find the length if we have a valid call. If not return 0
 	int result = 0;
-	if(isValid){
-		result = isLanguageSequenceAtIndex(func, buffer, encoding, language, index);
+	if(argument.isValid()){
+		result = isLanguageSequenceAtIndexBounded(func, argument.buffer, argument.numberOfBytes, encoding, language, index);
 	}
 	return result;
 }
@@ -138,9 +138,9 @@ v8::Handle<v8::Value> CharUtils::getLanguageEncodings(v8::Local<v8::String> name
 	v8::HandleScope scope;
 	v8::Local<v8::Object> obj = v8::Object::New();
 
-	// Set the different string encodings
-	obj->Set(v8::String::New("ENGLISH"), v8::Integer::New(ENGLISH));
-	obj->Set(v8::String::New("SPANISH"), v8::Integer::New(SPANISH));
-	obj->Set(v8::String::New("FRENCH"), v8::Integer::New(FRENCH));
+	// Set the languages of languageTables.h
+	for(int language = 0; language < NUMBER_OF_LANGUAGES; language++){
+		obj->Set(v8::String::New(languageNames[language]), v8::Integer::New(language));
+	}
 	return scope.Close(obj);
 }
@@ -58,8 +58,21 @@ void StringUtils::Init(v8::Handle<v8::Object> exports){
 			v8::FunctionTemplate::New(isUpperCaseInAlphabet)->GetFunction());
 	tpl->PrototypeTemplate()->Set(v8::String::NewSymbol("isPunctuationMarkInAlphabet"),
 			v8::FunctionTemplate::New(isPunctuationMarkInAlphabet)->GetFunction());
+	tpl->PrototypeTemplate()->Set(v8::String::NewSymbol("validateUTF8"),
+			v8::FunctionTemplate::New(validateUTF8)->GetFunction());
+	tpl->PrototypeTemplate()->Set(v8::String::NewSymbol("classify"),
+			v8::FunctionTemplate::New(classify)->GetFunction());
+	tpl->PrototypeTemplate()->Set(v8::String::NewSymbol("classHistogram"),
+			v8::FunctionTemplate::New(classHistogram)->GetFunction());
+	tpl->PrototypeTemplate()->Set(v8::String::NewSymbol("scoreLanguages"),
+			v8::FunctionTemplate::New(scoreLanguages)->GetFunction());
+	tpl->PrototypeTemplate()->Set(v8::String::NewSymbol("toUpperInAlphabet"),
+			v8::FunctionTemplate::New(toUpperInAlphabet)->GetFunction());
+	tpl->PrototypeTemplate()->Set(v8::String::NewSymbol("toLowerInAlphabet"),
+			v8::FunctionTemplate::New(toLowerInAlphabet)->GetFunction());
 	tpl->InstanceTemplate()->SetAccessor(v8::String::New("stringEncodings"), getStringEncodings);
 	tpl->InstanceTemplate()->SetAccessor(v8::String::New("languageEncodings"), getLanguageEncodings);
+	tpl->InstanceTemplate()->SetAccessor(v8::String::New("characterClasses"), getCharacterClasses);
 
 	constructor = v8::Persistent<v8::Function>::New(tpl->GetFunction());
 	exports->Set(v8::String::NewSymbol("StringUtils"), constructor);
@@ -90,22 +103,17 @@ v8::Handle<v8::Value> StringUtils::length(const v8::Arguments & args){
 
 	// The base encoding
 	int encoding = UTF8_BINARY;
-	const char * buffer;
-	bool isValid = false;
+	ArgumentBuffer argument(args[0]);
 
 	// Get the variables from the arguments
-	if(args[0]->IsString()){
-		buffer = *v8::String::Utf8Value(args[0]);
-		isValid = true;
-	}
 	if(args[1]->IsNumber()){
 		encoding = args[1]->Uint32Value();
 	}
 
 	// Find the length if we have a valid call. If not return 0
 	int result = 0;
-	if(isValid){
-		result = len(buffer, encoding);
+	if(argument.isValid()){
+		result = lenBounded(argument.buffer, argument.numberOfBytes, encoding);
 	}else{
 		result = -1;
 	}
@@ -119,11 +127,7 @@ v8::Handle<v8::Value> StringUtils::lengthEscaped(const v8::Arguments & args){
 	v8::HandleScope scope;
 
 	// The information need to find the length of escaped characterså
-	const char * buffer = NULL;
-	v8::String::Utf8Value bufferStr(args[0]->ToString());
-	if(args[0]->IsString()){
-		buffer = *bufferStr;
-	}
+	ArgumentBuffer argument(args[0]);
 	int encoding = args[1]->IsNumber() ? args[1]->Uint32Value() : ASCII;
 	const char * controlString = NULL;
 	v8::String::Utf8Value controlStr(args[2]->ToString());
@@ -138,59 +142,194 @@ v8::Handle<v8::Value> StringUtils::lengthEscaped(const v8::Arguments & args){
 		endString = *end;
 	}
 
-	int result = lenEscaped(buffer, encoding, controlString, escapeEncoding, endString);
+	int result = -1;
+	if(argument.isValid()){
+		result = lenEscapedBounded(argument.buffer, argument.numberOfBytes, encoding, controlString, escapeEncoding, endString);
+	}
 	return scope.Close(v8::Number::New(result));
 }
 
 v8::Handle<v8::Value> StringUtils::isNaturalNumber(const v8::Arguments & args){
 	v8::HandleScope scope;
-	int result = checkStringInEncoding(args, isNumberSequence);
+	int result = checkStringInEncoding<language::Number>(args);
 	return scope.Close(v8::Boolean::New(result == 1));
 }
 
 v8::Handle<v8::Value> StringUtils::isHexNumber(const v8::Arguments & args){
 	v8::HandleScope scope;
-	int result = checkStringInEncoding(args, isHexSequence);
+	int result = checkStringInEncoding<language::Hex>(args);
 	return scope.Close(v8::Boolean::New(result == 1));
 }
 
 v8::Handle<v8::Value> StringUtils::isValid(const v8::Arguments & args){
 	v8::HandleScope scope;
-	int result = checkStringInEncoding(args, isValidCharacterSequence);
+	int result = checkStringInEncoding<language::ValidCharacter>(args);
 	return scope.Close(v8::Boolean::New(result == 1));
 }
 
 v8::Handle<v8::Value> StringUtils::isInRomanceAlphabet(const v8::Arguments & args){
 	v8::HandleScope scope;
-	int result = checkStringInEncoding(args, isInRomanceAlphabetSequence);
+	int result = checkStringInEncoding<language::RomanceAlphabet>(args);
 	return scope.Close(v8::Boolean::New(result == 1));
 }
 
 
 v8::Handle<v8::Value> StringUtils::isInAlphabet(const v8::Arguments & args){
 	v8::HandleScope scope;
-	int result = checkStringInEncodingAndLanguage(args, isInAlphabetSequence);
+	int result = checkStringInEncodingAndLanguage<language::Alphabet>(args);
 	return scope.Close(v8::Boolean::New(result == 1));
 }
 
 v8::Handle<v8::Value> StringUtils::isLowerCaseInAlphabet(const v8::Arguments & args){
 	v8::HandleScope scope;
-	int result = checkStringInEncodingAndLanguage(args, ::isLowerCaseInAlphabetSequence);
+	int result = checkStringInEncodingAndLanguage<language::LowerCase>(args);
 	return scope.Close(v8::Boolean::New(result == 1));
 }
 
 v8::Handle<v8::Value> StringUtils::isUpperCaseInAlphabet(const v8::Arguments & args){
 	v8::HandleScope scope;
-	int result = checkStringInEncodingAndLanguage(args, ::isUpperCaseInAlphabetSequence);
+	int result = checkStringInEncodingAndLanguage<language::UpperCase>(args);
 	return scope.Close(v8::Boolean::New(result == 1));
 }
 
 v8::Handle<v8::Value> StringUtils::isPunctuationMarkInAlphabet(const v8::Arguments & args){
 	v8::HandleScope scope;
-	int result = checkStringInEncodingAndLanguage(args, ::isPunctuationMarkInAlphabetSequence);
+	int result = checkStringInEncodingAndLanguage<language::PunctuationMark>(args);
 	return scope.Close(v8::Boolean::New(result == 1));
 }
 
+// Validate the utf8 of a string or a buffer. Returns the offset of the first
+// malformed character, or -1 for valid utf8. Any other argument is a
+// TypeError, as no offset can stand for it
+v8::Handle<v8::Value> StringUtils::validateUTF8(const v8::Arguments & args){
+	v8::HandleScope scope;
+	ArgumentBuffer argument(args[0]);
+
+	if(!argument.isValid()){
+		return v8::ThrowException(v8::Exception::TypeError(v8::String::New("validateUTF8 expects a string or a buffer")));
+	}
+	size_t errorOffset = 0;
+	double result = ::validateUTF8(argument.buffer, argument.numberOfBytes, &errorOffset) ? -1 : (double)errorOffset;
+	return scope.Close(v8::Number::New(result));
+}
+
+// Classify a string or a buffer in an encoding and a language in one pass.
+// Returns the characterClasses bits that every character has
+v8::Handle<v8::Value> StringUtils::classify(const v8::Arguments & args){
+	v8::HandleScope scope;
+	int encoding = UTF8_BINARY;
+	int language = ENGLISH;
+	ArgumentBuffer argument(args[0]);
+
+	// Get the variables from the arguments
+	if(args[1]->IsNumber()){
+		encoding = args[1]->Uint32Value();
+	}
+	if(args[2]->IsNumber()){
+		language = args[2]->Uint32Value();
+	}
+
+	int result = 0;
+	if(argument.isValid()){
+		result = classifySequenceBounded(argument.buffer, argument.numberOfBytes, encoding, language);
+	}
+	return scope.Close(v8::Integer::New(result));
+}
+
+// Count the characters of a string or a buffer in each character class in one
+// pass. Returns an object with the counts, or null for a malformed string
+v8::Handle<v8::Value> StringUtils::classHistogram(const v8::Arguments & args){
+	v8::HandleScope scope;
+	int encoding = UTF8_BINARY;
+	int language = ENGLISH;
+	ArgumentBuffer argument(args[0]);
+
+	// Get the variables from the arguments
+	if(args[1]->IsNumber()){
+		encoding = args[1]->Uint32Value();
+	}
+	if(args[2]->IsNumber()){
+		language = args[2]->Uint32Value();
+	}
+
+	characterClassHistogram histogram;
+	if(!argument.isValid() || !classHistogramBounded(argument.buffer, argument.numberOfBytes, encoding, language, &histogram)){
+		return scope.Close(v8::Null());
+	}
+	v8::Local<v8::Object> obj = v8::Object::New();
+	obj->Set(v8::String::New("characters"), v8::Number::New((double)histogram.numberOfCharacters));
+	obj->Set(v8::String::New("alphabet"), v8::Number::New((double)histogram.alphabet));
+	obj->Set(v8::String::New("upperCase"), v8::Number::New((double)histogram.upperCase));
+	obj->Set(v8::String::New("lowerCase"), v8::Number::New((double)histogram.lowerCase));
+	obj->Set(v8::String::New("digits"), v8::Number::New((double)histogram.digits));
+	obj->Set(v8::String::New("punctuationMarks"), v8::Number::New((double)histogram.punctuationMarks));
+	obj->Set(v8::String::New("extended"), v8::Number::New((double)histogram.extended));
+	obj->Set(v8::String::New("diacriticalMarks"), v8::Number::New((double)histogram.diacriticalMarks));
+	return scope.Close(obj);
+}
+
+// Score a string or a buffer in every language in one pass. Returns an object
+// with the score of each language, or null for a malformed string
+v8::Handle<v8::Value> StringUtils::scoreLanguages(const v8::Arguments & args){
+	v8::HandleScope scope;
+	int encoding = UTF8_BINARY;
+	ArgumentBuffer argument(args[0]);
+
+	// Get the variables from the arguments
+	if(args[1]->IsNumber()){
+		encoding = args[1]->Uint32Value();
+	}
+
+	long long scores[NUMBER_OF_LANGUAGES];
+	if(!argument.isValid() || scoreLanguagesBounded(argument.buffer, argument.numberOfBytes, encoding, scores) == -1){
+		return scope.Close(v8::Null());
+	}
+	v8::Local<v8::Object> obj = v8::Object::New();
+	for(int language = 0; language < NUMBER_OF_LANGUAGES; language++){
+		obj->Set(v8::String::New(languageNames[language]), v8::Number::New((double)scores[language]));
+	}
+	return scope.Close(obj);
+}
+
+// Convert the case of the letters of a string or a buffer in an alphabet. A
+// string is converted into a new string and a buffer in place. The bytes of a
+// string are its utf8 copy, so only a buffer is converted in the encoding
+// asked for. Returns the converted string or buffer, or null for a malformed
+// string
+static v8::Handle<v8::Value> convertCase(const v8::Arguments & args, int (*func)(char *, size_t, int, int)){
+	v8::HandleScope scope;
+	int encoding = UTF8_BINARY;
+	int language = ENGLISH;
+	ArgumentBuffer argument(args[0]);
+
+	// Get the variables from the arguments
+	if(args[1]->IsNumber() && node::Buffer::HasInstance(args[0])){
+		encoding = args[1]->Uint32Value();
+	}
+	if(args[2]->IsNumber()){
+		language = args[2]->Uint32Value();
+	}
+
+	// The bytes of a string argument are a copy of it, so both are converted where they are
+	char * buffer = const_cast<char *>(argument.buffer);
+	if(!argument.isValid() || func(buffer, argument.numberOfBytes, encoding, language) == -1){
+		return scope.Close(v8::Null());
+	}
+	if(node::Buffer::HasInstance(args[0])){
+		return scope.Close(args[0]);
+	}
+	return scope.Close(v8::String::New(buffer, (int)argument.numberOfBytes));
+}
+
+// Convert the letters of a string or a buffer to the upper case of an alphabet
+v8::Handle<v8::Value> StringUtils::toUpperInAlphabet(const v8::Arguments & args){
+	return convertCase(args, toUpperInAlphabetBounded);
+}
+
+// Convert the letters of a string or a buffer to the lower case of an alphabet
+v8::Handle<v8::Value> StringUtils::toLowerInAlphabet(const v8::Arguments & args){
+	return convertCase(args, toLowerInAlphabetBounded);
+}
 
 // Getters and setters
 v8::Handle<v8::Value> StringUtils::getStringEncodings(v8::Local<v8::String> name, const v8::AccessorInfo & info){
@@ -208,10 +347,27 @@ v8::Handle<v8::Value> StringUtils::getLanguageEncodings(v8::Local<v8::String> na
 	v8::HandleScope scope;
 	v8::Local<v8::Object> obj = v8::Object::New();
 
-	// Set the different string encodings
-	obj->Set(v8::String::New("ENGLISH"), v8::Integer::New(ENGLISH));
-	obj->Set(v8::String::New("SPANISH"), v8::Integer::New(SPANISH));
-	obj->Set(v8::String::New("FRENCH"), v8::Integer::New(FRENCH));
+	// Set the languages of languageTables.h
+	for(int language = 0; language < NUMBER_OF_LANGUAGES; language++){
+		obj->Set(v8::String::New(languageNames[language]), v8::Integer::New(language));
+	}
+	return scope.Close(obj);
+}
+
+v8::Handle<v8::Value> StringUtils::getCharacterClasses(v8::Local<v8::String> name, const v8::AccessorInfo & info){
+	v8::HandleScope scope;
+	v8::Local<v8::Object> obj = v8::Object::New();
+
+	// Set the bits of the classify result
+	obj->Set(v8::String::New("ALPHA"), v8::Integer::New(CHARACTER_CLASS_ALPHA));
+	obj->Set(v8::String::New("UPPER"), v8::Integer::New(CHARACTER_CLASS_UPPER));
+	obj->Set(v8::String::New("LOWER"), v8::Integer::New(CHARACTER_CLASS_LOWER));
+	obj->Set(v8::String::New("DIGIT"), v8::Integer::New(CHARACTER_CLASS_DIGIT));
+	obj->Set(v8::String::New("HEX"), v8::Integer::New(CHARACTER_CLASS_HEX));
+	obj->Set(v8::String::New("PUNCT"), v8::Integer::New(CHARACTER_CLASS_PUNCT));
+	obj->Set(v8::String::New("EXTENDED"), v8::Integer::New(CHARACTER_CLASS_EXTENDED));
+	obj->Set(v8::String::New("VALID"), v8::Integer::New(CHARACTER_CLASS_VALID));
+	obj->Set(v8::String::New("ROMANCE"), v8::Integer::New(CHARACTER_CLASS_ROMANCE));
 	return scope.Close(obj);
 }
 
@@ -47,10 +47,17 @@ private:
 	static v8::Handle<v8::Value> isLowerCaseInAlphabet(const v8::Arguments & args);
 	static v8::Handle<v8::Value> isUpperCaseInAlphabet(const v8::Arguments & args);
 	static v8::Handle<v8::Value> isPunctuationMarkInAlphabet(const v8::Arguments & args);
+	static v8::Handle<v8::Value> validateUTF8(const v8::Arguments & args);
+	static v8::Handle<v8::Value> classify(const v8::Arguments & args);
+	static v8::Handle<v8::Value> classHistogram(const v8::Arguments & args);
+	static v8::Handle<v8::Value> scoreLanguages(const v8::Arguments & args);
+	static v8::Handle<v8::Value> toUpperInAlphabet(const v8::Arguments & args);
+	static v8::Handle<v8::Value> toLowerInAlphabet(const v8::Arguments & args);
 
 	// Getters and setters
 	static v8::Handle<v8::Value> getStringEncodings(v8::Local<v8::String> name, const v8::AccessorInfo & info);
 	static v8::Handle<v8::Value> getLanguageEncodings(v8::Local<v8::String> name, const v8::AccessorInfo & info);
+	static v8::Handle<v8::Value> getCharacterClasses(v8::Local<v8::String> name, const v8::AccessorInfo & info);
 
 
 };
@@ -17,6 +17,8 @@ The base utils contains
 @version: 0.01
 """
 
+from Languages import languageEncodings
+
 class BaseUtils(object):
     """
     The base utils object is the base class for different utilties.
@@ -37,8 +39,21 @@ class BaseUtils(object):
         """
         Get the language encodings associated with the utilities
         """
+        return dict(languageEncodings)
+        
+    @classmethod
+    def characterClasses(cls):
+        """
+        Get the character class bits of the classify result
+        """
         return {
-            'ENGLISH':0,
-            'SPANISH':1,
-            'FRENCH':2
+            'ALPHA':0x001,
+            'UPPER':0x002,
+            'LOWER':0x004,
+            'DIGIT':0x008,
+            'HEX':0x010,
+            'PUNCT':0x020,
+            'EXTENDED':0x040,
+            'VALID':0x080,
+            'ROMANCE':0x100
         }
\ No newline at end of file
@@ -27,6 +27,12 @@ from Language.stringUtils import isInAlphabet
 from Language.stringUtils import isUpperCaseInAlphabet
 from Language.stringUtils import isLowerCaseInAlphabet
 from Language.stringUtils import isPunctuationMarkInAlphabet
+from Language.stringUtils import validateUTF8
+from Language.stringUtils import classify
+from Language.stringUtils import classHistogram
+from Language.stringUtils import scoreLanguages
+from Language.stringUtils import toUpperInAlphabet
+from Language.stringUtils import toLowerInAlphabet
 from BaseUtils import BaseUtils
 
 class StringUtils(BaseUtils):
@@ -108,4 +114,49 @@ class StringUtils(BaseUtils):
         """
         Return true if the string is a punctuation mark alphabet 
         """
-        return isPunctuationMarkInAlphabet(self.str, self.encoding, self.language)
\ No newline at end of file
+        return isPunctuationMarkInAlphabet(self.str, self.encoding, self.language)
+    
+    def validateUTF8(self):
+        """
+        Return the offset of the first malformed utf8 character, or -1 if the
+        string is valid utf8
+        """
+        return validateUTF8(self.str)
+    
+    def classify(self):
+        """
+        Return the character classes that every character of the string has,
+        as the bits of BaseUtils.characterClasses
+        """
+        return classify(self.str, self.encoding, self.language)
+    
+    def classHistogram(self):
+        """
+        Return a dict of the number of characters of the string in each
+        character class, or None if the string is malformed
+        """
+        return classHistogram(self.str, self.encoding, self.language)
+    
+    def scoreLanguages(self):
+        """
+        Return a dict of the score of the string in each language, where the
+        highest score is the most likely language, or None if the string is
+        malformed
+        """
+        return scoreLanguages(self.str, self.encoding)
+    
+    def toUpper(self):
+        """
+        Return the string with its letters in the upper case of the alphabet
+        of the language, or None if the string is malformed. A bytearray is
+        converted in place.
+        """
+        return toUpperInAlphabet(self.str, self.encoding, self.language)
+    
+    def toLower(self):
+        """
+        Return the string with its letters in the lower case of the alphabet
+        of the language, or None if the string is malformed. A bytearray is
+        converted in place.
+        """
+        return toLowerInAlphabet(self.str, self.encoding, self.language)
\ No newline at end of file
@@ -2,6 +2,51 @@
 #include "bytesobject.h"
 #include "stringUtils.h"
 
+/**
+ * Get the bytes of a python string, unicode string or bytearray along with
+ * their byte length. A str or a bytearray is read in place in the encoding
+ * asked for. The code units of a unicode string are read in place as UTF16 on
+ * a narrow build, and its code points through a utf8 copy on a wide one.
+ * @param stringArg The python object
+ * @param buffer The bytes of the python object
+ * @param numberOfBytes The number of bytes in the python object
+ * @param stringEncoding Set to the encoding of a unicode string, or to -1 for
+ * the encoding asked for
+ * @param utf8Copy Set to the utf8 copy of a unicode string that the caller
+ * releases, or to NULL
+ * @returns {0 = not a string, 1 = a string}
+ */
+static int getStringBytes(PyObject * stringArg, const char ** buffer, size_t * numberOfBytes, int * stringEncoding,
+		PyObject ** utf8Copy){
+	*stringEncoding = -1;
+	*utf8Copy = NULL;
+	if(PyObject_TypeCheck(stringArg, &PyString_Type)){
+		*buffer = PyString_AS_STRING(stringArg);
+		*numberOfBytes = (size_t)PyString_GET_SIZE(stringArg);
+		return 1;
+	}else if(PyObject_TypeCheck(stringArg, &PyUnicode_Type)){
+#if Py_UNICODE_SIZE == 2
+		*buffer = (const char *)PyUnicode_AS_UNICODE(stringArg);
+		*numberOfBytes = (size_t)PyUnicode_GET_DATA_SIZE(stringArg);
+		*stringEncoding = UTF16;
+#else
+		*utf8Copy = PyUnicode_AsUTF8String(stringArg);
+		if(*utf8Copy == NULL){
+			return 0;
+		}
+		*buffer = PyString_AS_STRING(*utf8Copy);
+		*numberOfBytes = (size_t)PyString_GET_SIZE(*utf8Copy);
+		*stringEncoding = UTF8_BINARY;
+#endif
+		return 1;
+	}else if(PyByteArray_Check(stringArg)){
+		*buffer = PyByteArray_AS_STRING(stringArg);
+		*numberOfBytes = (size_t)PyByteArray_GET_SIZE(stringArg);
+		return 1;
+	}
+	return 0;
+}
+
 
 /**
  * A wrapper of the underlying stringUtils:length function that handles different
@@ -14,7 +59,10 @@ static PyObject * py_stringutils_length(PyObject * self, PyObject *args){
 
 	// The main buffere of the py utils
 	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
 	int encoding = UTF8_BINARY;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
 
 	// Check if the pyarg unpack tuple
 	if(!PyArg_UnpackTuple(args, "stringutils_length", 1, 2, &stringArg, &encodingArg)){
@@ -23,11 +71,7 @@ static PyObject * py_stringutils_length(PyObject * self, PyObject *args){
 
 	// Check if the argument is a unicode string or an ascii string. For the ascii
 	// utf-8 can be encoded into the string.
-	if(PyObject_TypeCheck(stringArg, &PyString_Type)){
-		buffer = PyString_AS_STRING(stringArg);
-	}else if(PyObject_TypeCheck(stringArg, &PyUnicode_Type)){
-		buffer = PyUnicode_AS_DATA(stringArg);
-	}else{
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
 		PyErr_Format(PyExc_TypeError, "Py_stringutils_length expects a string");
 	}
 
@@ -41,7 +85,11 @@ static PyObject * py_stringutils_length(PyObject * self, PyObject *args){
 			}
 		}
 	}
-	size_t ldist = len(buffer, encoding);
+	if(stringEncoding != -1){
+		encoding = stringEncoding;
+	}
+	size_t ldist = lenBounded(buffer, numberOfBytes, encoding);
+	Py_XDECREF(utf8Copy);
 	return PyInt_FromLong((long)ldist);
 }
 
@@ -59,6 +107,7 @@ static PyObject * py_stringutils_lengthescaped(PyObject * self, PyObject * args)
 
 	// The C arguments associated with the function lengthEscaped
 	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
 	int encoding = ASCII;
 	const char * escapedChars = NULL;
 	int escapedEncoding = ASCII_HEX_UTF_ESCAPE;
@@ -73,6 +122,7 @@ static PyObject * py_stringutils_lengthescaped(PyObject * self, PyObject * args)
 	// Check that a string is being passed
 	if(PyObject_TypeCheck(stringArg, &PyString_Type)){
 		buffer = PyString_AS_STRING(stringArg);
+		numberOfBytes = (size_t)PyString_GET_SIZE(stringArg);
 	}else{
 		PyErr_Format(PyExc_TypeError, "Py_stringutils_lengthEscaped expects an ASCII string");
 	}
@@ -97,7 +147,7 @@ static PyObject * py_stringutils_lengthescaped(PyObject * self, PyObject * args)
 		}
 	}
 
-	size_t ldist = lenEscaped(buffer, encoding, escapedChars, escapedEncoding, endChar);
+	size_t ldist = lenEscapedBounded(buffer, numberOfBytes, encoding, escapedChars, escapedEncoding, endChar);
 	return PyInt_FromLong((long)ldist);
 }
 
@@ -105,7 +155,7 @@ static PyObject * py_stringutils_lengthescaped(PyObject * self, PyObject * args)
 /**
  * A python function that checks if a character is of a certain type
  */
-static PyObject * checkStringContent(PyObject * self, PyObject * args, int (*func)(const char *, int),
+static PyObject * checkStringContent(PyObject * self, PyObject * args, int (*func)(const char *, size_t, int),
 		const char * unPackString, const char * errorString){
 	// The string argument for the string utils
 	PyObject * stringArg = NULL;
@@ -113,7 +163,10 @@ static PyObject * checkStringContent(PyObject * self, PyObject * args, int (*fun
 
 	// The main buffere of the py utils
 	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
 	int encoding = UTF8_BINARY;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
 
 	// Check if the pyarg unpack tuple
 	if(!PyArg_UnpackTuple(args, unPackString, 2, 2, &stringArg, &encodingArg)){
@@ -122,11 +175,7 @@ static PyObject * checkStringContent(PyObject * self, PyObject * args, int (*fun
 
 	// Check if the argument is a unicode string or an ascii string. For the ascii
 	// utf-8 can be encoded into the string.
-	if(PyObject_TypeCheck(stringArg, &PyString_Type)){
-		buffer = PyString_AS_STRING(stringArg);
-	}else if(PyObject_TypeCheck(stringArg, &PyUnicode_Type)){
-		buffer = PyUnicode_AS_DATA(stringArg);
-	}else{
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
 		PyErr_Format(PyExc_TypeError, "%s",errorString);
 		Py_RETURN_FALSE;
 	}
@@ -140,7 +189,11 @@ static PyObject * checkStringContent(PyObject * self, PyObject * args, int (*fun
 			}
 		}
 	}
-	size_t ldist = func(buffer, encoding);
+	if(stringEncoding != -1){
+		encoding = stringEncoding;
+	}
+	size_t ldist = func(buffer, numberOfBytes, encoding);
+	Py_XDECREF(utf8Copy);
 	if(ldist == 0){
 		Py_RETURN_FALSE;
 	}else{
@@ -161,7 +214,10 @@ static PyObject * checkStringContentAtIndex(PyObject * self, PyObject * args, in
 
 	// The main buffere of the py utils
 	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
 	int encoding = UTF8_BINARY;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
 	int index = 0;
 
 	// Check if the pyarg unpack tuple
@@ -171,11 +227,7 @@ static PyObject * checkStringContentAtIndex(PyObject * self, PyObject * args, in
 
 	// Check if the argument is a unicode string or an ascii string. For the ascii
 	// utf-8 can be encoded into the string.
-	if(PyObject_TypeCheck(stringArg, &PyString_Type)){
-		buffer = PyString_AS_STRING(stringArg);
-	}else if(PyObject_TypeCheck(stringArg, &PyUnicode_Type)){
-		buffer = PyUnicode_AS_DATA(stringArg);
-	}else{
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
 		PyErr_Format(PyExc_TypeError, "%s",errorString);
 		Py_RETURN_FALSE;
 	}
@@ -198,7 +250,11 @@ static PyObject * checkStringContentAtIndex(PyObject * self, PyObject * args, in
 		}
 	}
 
-	size_t ldist = isSequenceAtIndex(func, buffer, encoding, index);
+	if(stringEncoding != -1){
+		encoding = stringEncoding;
+	}
+	size_t ldist = isSequenceAtIndexBounded(func, buffer, numberOfBytes, encoding, index);
+	Py_XDECREF(utf8Copy);
 	if(ldist == 0){
 		Py_RETURN_FALSE;
 	}else{
@@ -209,7 +265,7 @@ static PyObject * checkStringContentAtIndex(PyObject * self, PyObject * args, in
 /**
  * A python function that checks if a character is of a certain type in a language
  */
-static PyObject * checkLanguageStringContent(PyObject * self, PyObject * args, int (*func)(const char *, int, int),
+static PyObject * checkLanguageStringContent(PyObject * self, PyObject * args, int (*func)(const char *, size_t, int, int),
 		const char * unPackString, const char * errorString){
 	// The string argument for the string utils
 	PyObject * stringArg = NULL;
@@ -218,7 +274,10 @@ static PyObject * checkLanguageStringContent(PyObject * self, PyObject * args, i
 
 	// The main buffere of the py utils
 	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
 	int encoding = UTF8_BINARY;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
 	int language = ENGLISH;
 
 	// Check if the pyarg unpack tuple
@@ -228,11 +287,7 @@ static PyObject * checkLanguageStringContent(PyObject * self, PyObject * args, i
 
 	// Check if the argument is a unicode string or an ascii string. For the ascii
 	// utf-8 can be encoded into the string.
-	if(PyObject_TypeCheck(stringArg, &PyString_Type)){
-		buffer = PyString_AS_STRING(stringArg);
-	}else if(PyObject_TypeCheck(stringArg, &PyUnicode_Type)){
-		buffer = PyUnicode_AS_DATA(stringArg);
-	}else{
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
 		PyErr_Format(PyExc_TypeError, "%s",errorString);
 		Py_RETURN_FALSE;
 	}
@@ -251,13 +306,17 @@ static PyObject * checkLanguageStringContent(PyObject * self, PyObject * args, i
 	if(languageArg == NULL){
 		if(PyObject_TypeCheck(languageArg, &PyInt_Type)){
 			int potentialEncoding = PyInt_AsLong(languageArg);
-			if(potentialEncoding >= ENGLISH && potentialEncoding <= FRENCH){
+			if(potentialEncoding >= ENGLISH && potentialEncoding < NUMBER_OF_LANGUAGES){
 				language = potentialEncoding;
 			}
 		}
 	}
 
-	size_t ldist = func(buffer, encoding, language);
+	if(stringEncoding != -1){
+		encoding = stringEncoding;
+	}
+	size_t ldist = func(buffer, numberOfBytes, encoding, language);
+	Py_XDECREF(utf8Copy);
 	if(ldist == 0){
 		Py_RETURN_FALSE;
 	}else{
@@ -279,7 +338,10 @@ static PyObject * checkLanguageStringContentAtIndex(PyObject * self, PyObject *
 
 	// The main buffere of the py utils
 	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
 	int encoding = UTF8_BINARY;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
 	int language = ENGLISH;
 	int index = 0;
 
@@ -290,11 +352,7 @@ static PyObject * checkLanguageStringContentAtIndex(PyObject * self, PyObject *
 
 	// Check if the argument is a unicode string or an ascii string. For the ascii
 	// utf-8 can be encoded into the string.
-	if(PyObject_TypeCheck(stringArg, &PyString_Type)){
-		buffer = PyString_AS_STRING(stringArg);
-	}else if(PyObject_TypeCheck(stringArg, &PyUnicode_Type)){
-		buffer = PyUnicode_AS_DATA(stringArg);
-	}else{
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
 		PyErr_Format(PyExc_TypeError, "%s",errorString);
 		Py_RETURN_FALSE;
 	}
@@ -313,7 +371,7 @@ static PyObject * checkLanguageStringContentAtIndex(PyObject * self, PyObject *
 	if(languageArg == NULL){
 		if(PyObject_TypeCheck(languageArg, &PyInt_Type)){
 			int potentialEncoding = PyInt_AsLong(languageArg);
-			if(potentialEncoding >= ENGLISH && potentialEncoding <= FRENCH){
+			if(potentialEncoding >= ENGLISH && potentialEncoding < NUMBER_OF_LANGUAGES){
 				language = potentialEncoding;
 			}
 		}
@@ -328,7 +386,11 @@ static PyObject * checkLanguageStringContentAtIndex(PyObject * self, PyObject *
 			}
 		}
 	}
-	size_t ldist = isLanguageSequenceAtIndex(func, buffer, encoding, language, index);
+	if(stringEncoding != -1){
+		encoding = stringEncoding;
+	}
+	size_t ldist = isLanguageSequenceAtIndexBounded(func, buffer, numberOfBytes, encoding, language, index);
+	Py_XDECREF(utf8Copy);
 	if(ldist == 0){
 		Py_RETURN_FALSE;
 	}else{
@@ -341,7 +403,7 @@ static PyObject * checkLanguageStringContentAtIndex(PyObject * self, PyObject *
  * in different encodings
  */
 static PyObject * py_stringutils_isNaturalNumber(PyObject * self, PyObject *args){
-	return  checkStringContent(self, args, isNumberSequence,"stringutils_isNaturalNumber",
+	return  checkStringContent(self, args, isNumberSequenceBounded,"stringutils_isNaturalNumber",
 				"py_stringutils_isNaturalNumber expects a string");
 
 }
@@ -351,7 +413,7 @@ static PyObject * py_stringutils_isNaturalNumber(PyObject * self, PyObject *args
  * in different encodings
  */
 static PyObject * py_stringutils_isHexNumber(PyObject * self, PyObject * args){
-	return  checkStringContent(self, args, isHexSequence,"stringutils_isHexNumber",
+	return  checkStringContent(self, args, isHexSequenceBounded,"stringutils_isHexNumber",
 			"py_stringutils_isHexNumber expects a string");
 }
 
@@ -360,7 +422,7 @@ static PyObject * py_stringutils_isHexNumber(PyObject * self, PyObject * args){
  * encodings
  */
 static PyObject * py_stringutils_isValid(PyObject * self, PyObject * args){
-	return  checkStringContent(self, args, isValidCharacterSequence,"stringutils_isHexNumber",
+	return  checkStringContent(self, args, isValidCharacterSequenceBounded,"stringutils_isHexNumber",
 			"Py_stringutils_length expects a string");
 }
 
@@ -369,7 +431,7 @@ static PyObject * py_stringutils_isValid(PyObject * self, PyObject * args){
  * romance alphabet
  */
 static PyObject * py_stringutils_isInRomanceAlphabet(PyObject * self, PyObject * args){
-	return  checkStringContent(self, args, isInRomanceAlphabetSequence,"stringutils_isInRomanceAlphabet",
+	return  checkStringContent(self, args, isInRomanceAlphabetSequenceBounded,"stringutils_isInRomanceAlphabet",
 				"Py_stringutils_length expects a string");
 }
 
@@ -378,7 +440,7 @@ static PyObject * py_stringutils_isInRomanceAlphabet(PyObject * self, PyObject *
  * for a specific language and encoding
  */
 static PyObject * py_stringutils_isInAlphabet(PyObject * self, PyObject * args){
-	return checkLanguageStringContent(self, args, isInAlphabetSequence, "stringutils_isInAlphabet",
+	return checkLanguageStringContent(self, args, isInAlphabetSequenceBounded, "stringutils_isInAlphabet",
 			"Py_stringutils_length expects a string");
 }
 
@@ -387,7 +449,7 @@ static PyObject * py_stringutils_isInAlphabet(PyObject * self, PyObject * args){
  * and language
  */
 static PyObject * py_stringutils_isUpperCaseInAlphabetSequence(PyObject * self, PyObject * args){
-	return checkLanguageStringContent(self, args, isUpperCaseInAlphabetSequence, "charutils_isUpperCaseInAlphabetSequence",
+	return checkLanguageStringContent(self, args, isUpperCaseInAlphabetSequenceBounded, "charutils_isUpperCaseInAlphabetSequence",
 			"py_stringutils_isUpperCaseInAlphabetSequence");
 }
 
@@ -396,7 +458,7 @@ static PyObject * py_stringutils_isUpperCaseInAlphabetSequence(PyObject * self,
  * and language
  */
 static PyObject * py_stringutils_isLowerCaseInAlphabetSequence(PyObject * self, PyObject * args){
-	return checkLanguageStringContent(self, args, isLowerCaseInAlphabetSequence, "charutils_isLowerCaseInAlphabetSequence",
+	return checkLanguageStringContent(self, args, isLowerCaseInAlphabetSequenceBounded, "charutils_isLowerCaseInAlphabetSequence",
 			"py_stringutils_isLowerCaseInAlphabetSequence");
 }
 
@@ -405,10 +467,301 @@ static PyObject * py_stringutils_isLowerCaseInAlphabetSequence(PyObject * self,
  * and language
  */
 static PyObject * py_stringutils_isPunctuationMarkInAlphabetSequence(PyObject * self, PyObject * args){
-	return checkLanguageStringContent(self, args, isPunctuationMarkInAlphabetSequence, "stringutils_isPunctuationMarkInAlphabet",
+	return checkLanguageStringContent(self, args, isPunctuationMarkInAlphabetSequenceBounded, "stringutils_isPunctuationMarkInAlphabet",
 			"py_stringutils_isPunctuationMarkInAlphabetSequence");
 }
 
+/**
+ * A wrapper of the underlying stringUtils:validateUTF8 function. Returns the
+ * offset of the first malformed character, or -1 for valid utf8
+ */
+static PyObject * py_stringutils_validateUTF8(PyObject * self, PyObject * args){
+	PyObject * stringArg = NULL;
+	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
+	size_t errorOffset = 0;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
+
+	if(!PyArg_UnpackTuple(args, "stringutils_validateUTF8", 1, 1, &stringArg)){
+		return NULL;
+	}
+
+	// A unicode object has been decoded already and is always well formed
+	if(PyObject_TypeCheck(stringArg, &PyUnicode_Type)){
+		return PyInt_FromLong(-1);
+	}
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
+		PyErr_Format(PyExc_TypeError, "Py_stringutils_validateUTF8 expects a string or a bytearray");
+		return NULL;
+	}
+	if(validateUTF8(buffer, numberOfBytes, &errorOffset)){
+		return PyInt_FromLong(-1);
+	}
+	return PyInt_FromSsize_t((Py_ssize_t)errorOffset);
+}
+
+/**
+ * A wrapper of the underlying stringUtils:classifySequenceBounded function.
+ * Returns the characterClasses bits that every character of the string has
+ */
+static PyObject * py_stringutils_classify(PyObject * self, PyObject * args){
+	PyObject * stringArg = NULL;
+	PyObject * encodingArg = NULL;
+	PyObject * languageArg = NULL;
+	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
+	int encoding = UTF8_BINARY;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
+	int language = ENGLISH;
+
+	if(!PyArg_UnpackTuple(args, "stringutils_classify", 1, 3, &stringArg, &encodingArg, &languageArg)){
+		return NULL;
+	}
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
+		PyErr_Format(PyExc_TypeError, "Py_stringutils_classify expects a string or a bytearray");
+		return NULL;
+	}
+	if(encodingArg != NULL && PyObject_TypeCheck(encodingArg, &PyInt_Type)){
+		int potentialEncoding = PyInt_AsLong(encodingArg);
+		if(potentialEncoding >= UTF8_BINARY && potentialEncoding <= ISO_8859_1){
+			encoding = potentialEncoding;
+		}
+	}
+	if(languageArg != NULL && PyObject_TypeCheck(languageArg, &PyInt_Type)){
+		int potentialLanguage = PyInt_AsLong(languageArg);
+		if(potentialLanguage >= ENGLISH && potentialLanguage < NUMBER_OF_LANGUAGES){
+			language = potentialLanguage;
+		}
+	}
+	if(stringEncoding != -1){
+		encoding = stringEncoding;
+	}
+	int classes = classifySequenceBounded(buffer, numberOfBytes, encoding, language);
+	Py_XDECREF(utf8Copy);
+	return PyInt_FromLong(classes);
+}
+
+/**
+ * A wrapper of the underlying stringUtils:classHistogramBounded function.
+ * Returns a dict of the number of characters in each character class, or
+ * None for a malformed string
+ */
+static PyObject * py_stringutils_classHistogram(PyObject * self, PyObject * args){
+	PyObject * stringArg = NULL;
+	PyObject * encodingArg = NULL;
+	PyObject * languageArg = NULL;
+	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
+	int encoding = UTF8_BINARY;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
+	int language = ENGLISH;
+	characterClassHistogram histogram;
+
+	if(!PyArg_UnpackTuple(args, "stringutils_classHistogram", 1, 3, &stringArg, &encodingArg, &languageArg)){
+		return NULL;
+	}
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
+		PyErr_Format(PyExc_TypeError, "Py_stringutils_classHistogram expects a string or a bytearray");
+		return NULL;
+	}
+	if(encodingArg != NULL && PyObject_TypeCheck(encodingArg, &PyInt_Type)){
+		int potentialEncoding = PyInt_AsLong(encodingArg);
+		if(potentialEncoding >= UTF8_BINARY && potentialEncoding <= ISO_8859_1){
+			encoding = potentialEncoding;
+		}
+	}
+	if(languageArg != NULL && PyObject_TypeCheck(languageArg, &PyInt_Type)){
+		int potentialLanguage = PyInt_AsLong(languageArg);
+		if(potentialLanguage >= ENGLISH && potentialLanguage < NUMBER_OF_LANGUAGES){
+			language = potentialLanguage;
+		}
+	}
+	if(stringEncoding != -1){
+		encoding = stringEncoding;
+	}
+	int counted = classHistogramBounded(buffer, numberOfBytes, encoding, language, &histogram);
+	Py_XDECREF(utf8Copy);
+	if(!counted){
+		Py_RETURN_NONE;
+	}
+	return Py_BuildValue("{s:n,s:n,s:n,s:n,s:n,s:n,s:n,s:n}",
+			"characters", (Py_ssize_t)histogram.numberOfCharacters,
+			"alphabet", (Py_ssize_t)histogram.alphabet,
+			"upperCase", (Py_ssize_t)histogram.upperCase,
+			"lowerCase", (Py_ssize_t)histogram.lowerCase,
+			"digits", (Py_ssize_t)histogram.digits,
+			"punctuationMarks", (Py_ssize_t)histogram.punctuationMarks,
+			"extended", (Py_ssize_t)histogram.extended,
+			"diacriticalMarks", (Py_ssize_t)histogram.diacriticalMarks);
+}
+
+/**
+ * A wrapper of the underlying stringUtils:scoreLanguagesBounded function.
+ * Returns a dict of the score of the string in each language, or None for a
+ * malformed string
+ */
+static PyObject * py_stringutils_scoreLanguages(PyObject * self, PyObject * args){
+	PyObject * stringArg = NULL;
+	PyObject * encodingArg = NULL;
+	const char * buffer = NULL;
+	size_t numberOfBytes = 0;
+	int encoding = UTF8_BINARY;
+	int stringEncoding = -1;
+	PyObject * utf8Copy = NULL;
+	long long scores[NUMBER_OF_LANGUAGES];
+	int language;
+
+	if(!PyArg_UnpackTuple(args, "stringutils_scoreLanguages", 1, 2, &stringArg, &encodingArg)){
+		return NULL;
+	}
+	if(!getStringBytes(stringArg, &buffer, &numberOfBytes, &stringEncoding, &utf8Copy)){
+		PyErr_Format(PyExc_TypeError, "Py_stringutils_scoreLanguages expects a string or a bytearray");
+		return NULL;
+	}
+	if(encodingArg != NULL && PyObject_TypeCheck(encodingArg, &PyInt_Type)){
+		int potentialEncoding = PyInt_AsLong(encodingArg);
+		if(potentialEncoding >= UTF8_BINARY && potentialEncoding <= ISO_8859_1){
+			encoding = potentialEncoding;
+		}
+	}
+	if(stringEncoding != -1){
+		encoding = stringEncoding;
+	}
+	int scored = scoreLanguagesBounded(buffer, numberOfBytes, encoding, scores);
+	Py_XDECREF(utf8Copy);
+	if(scored == -1){
+		Py_RETURN_NONE;
+	}
+	PyObject * result = PyDict_New();
+	if(result == NULL){
+		return NULL;
+	}
+	for(language = 0; language < NUMBER_OF_LANGUAGES; language++){
+		PyObject * score = PyLong_FromLongLong(scores[language]);
+		if(score == NULL || PyDict_SetItemString(result, languageNames[language], score) == -1){
+			Py_XDECREF(score);
+			Py_DECREF(result);
+			return NULL;
+		}
+		Py_DECREF(score);
+	}
+	return result;
+}
+
+/**
+ * A python function that converts the case of the letters of a string in an
+ * alphabet. A str or a unicode string is converted into a copy, and a
+ * bytearray in place. The code units of a unicode string are converted as
+ * utf16 on a narrow build, and its code points through utf8 on a wide one,
+ * whatever the encoding asked for. Returns the converted string, or None for
+ * a malformed string
+ */
+static PyObject * convertStringCase(PyObject * self, PyObject * args, int (*func)(char *, size_t, int, int),
+		const char * unPackString, const char * errorString){
+	PyObject * stringArg = NULL;
+	PyObject * encodingArg = NULL;
+	PyObject * languageArg = NULL;
+	PyObject * result = NULL;
+	PyObject * utf8Copy = NULL;
+	char * buffer = NULL;
+	size_t numberOfBytes = 0;
+	int encoding = UTF8_BINARY;
+	int unicodeEncoding = -1;
+	int language = ENGLISH;
+
+	if(!PyArg_UnpackTuple(args, unPackString, 1, 3, &stringArg, &encodingArg, &languageArg)){
+		return NULL;
+	}
+	if(PyObject_TypeCheck(stringArg, &PyString_Type)){
+		// A copy from a string can be one of the shared single character
+		// strings, so the copy is a new string that is filled here
+		result = PyString_FromStringAndSize(NULL, PyString_GET_SIZE(stringArg));
+		if(result != NULL){
+			buffer = PyString_AS_STRING(result);
+			numberOfBytes = (size_t)PyString_GET_SIZE(result);
+			memcpy(buffer, PyString_AS_STRING(stringArg), numberOfBytes);
+		}
+	}else if(PyObject_TypeCheck(stringArg, &PyUnicode_Type)){
+#if Py_UNICODE_SIZE == 2
+		result = PyUnicode_FromUnicode(NULL, PyUnicode_GET_SIZE(stringArg));
+		if(result != NULL){
+			buffer = (char *)PyUnicode_AS_UNICODE(result);
+			numberOfBytes = (size_t)PyUnicode_GET_DATA_SIZE(result);
+			memcpy(buffer, PyUnicode_AS_UNICODE(stringArg), numberOfBytes);
+		}
+		unicodeEncoding = UTF16;
+#else
+		PyObject * encoded = PyUnicode_AsUTF8String(stringArg);
+		if(encoded == NULL){
+			return NULL;
+		}
+		utf8Copy = PyString_FromStringAndSize(NULL, PyString_GET_SIZE(encoded));
+		if(utf8Copy != NULL){
+			buffer = PyString_AS_STRING(utf8Copy);
+			numberOfBytes = (size_t)PyString_GET_SIZE(utf8Copy);
+			memcpy(buffer, PyString_AS_STRING(encoded), numberOfBytes);
+			result = utf8Copy;
+		}
+		Py_DECREF(encoded);
+		unicodeEncoding = UTF8_BINARY;
+#endif
+	}else if(PyByteArray_Check(stringArg)){
+		Py_INCREF(stringArg);
+		result = stringArg;
+		buffer = PyByteArray_AS_STRING(result);
+		numberOfBytes = (size_t)PyByteArray_GET_SIZE(result);
+	}else{
+		PyErr_Format(PyExc_TypeError, "%s expects a string or a bytearray", errorString);
+		return NULL;
+	}
+	if(result == NULL){
+		return NULL;
+	}
+	if(encodingArg != NULL && PyObject_TypeCheck(encodingArg, &PyInt_Type)){
+		int potentialEncoding = PyInt_AsLong(encodingArg);
+		if(potentialEncoding >= UTF8_BINARY && potentialEncoding <= UTF16){
+			encoding = potentialEncoding;
+		}
+	}
+	if(unicodeEncoding != -1){
+		encoding = unicodeEncoding;
+	}
+	if(languageArg != NULL && PyObject_TypeCheck(languageArg, &PyInt_Type)){
+		int potentialLanguage = PyInt_AsLong(languageArg);
+		if(potentialLanguage >= ENGLISH && potentialLanguage < NUMBER_OF_LANGUAGES){
+			language = potentialLanguage;
+		}
+	}
+	if(func(buffer, numberOfBytes, encoding, language) == -1){
+		Py_DECREF(result);
+		Py_RETURN_NONE;
+	}
+	if(utf8Copy != NULL){
+		result = PyUnicode_DecodeUTF8(buffer, (Py_ssize_t)numberOfBytes, NULL);
+		Py_DECREF(utf8Copy);
+	}
+	return result;
+}
+
+/**
+ * A wrapper of the underlying stringUtils:toUpperInAlphabetBounded function
+ */
+static PyObject * py_stringutils_toUpperInAlphabet(PyObject * self, PyObject * args){
+	return convertStringCase(self, args, toUpperInAlphabetBounded, "stringutils_toUpperInAlphabet",
+			"Py_stringutils_toUpperInAlphabet");
+}
+
+/**
+ * A wrapper of the underlying stringUtils:toLowerInAlphabetBounded function
+ */
+static PyObject * py_stringutils_toLowerInAlphabet(PyObject * self, PyObject * args){
+	return convertStringCase(self, args, toLowerInAlphabetBounded, "stringutils_toLowerInAlphabet",
+			"Py_stringutils_toLowerInAlphabet");
+}
+
 /**
  * A python function to check if a character is a hex number
  */
@@ -492,6 +845,12 @@ static PyMethodDef stringutils_methods[] = {
 		{"isUpperCaseInAlphabet", py_stringutils_isUpperCaseInAlphabetSequence, METH_VARARGS, "Is the sequence of text part of the upper case of an alphabet?"},
 		{"isLowerCaseInAlphabet", py_stringutils_isLowerCaseInAlphabetSequence, METH_VARARGS, "Is the sequence of text part of the lower case of an alphabet?"},
 		{"isPunctuationMarkInAlphabet",py_stringutils_isPunctuationMarkInAlphabetSequence, METH_VARARGS, "Is the sequence of text a punctuation makr in an alphabet?"},
+		{"validateUTF8", py_stringutils_validateUTF8, METH_VARARGS, "The offset of the first malformed utf8 character, or -1 for valid utf8"},
+		{"classify", py_stringutils_classify, METH_VARARGS, "The character classes that every character of the text has"},
+		{"classHistogram", py_stringutils_classHistogram, METH_VARARGS, "The number of characters of the text in each character class"},
+		{"scoreLanguages", py_stringutils_scoreLanguages, METH_VARARGS, "The score of the text in each language"},
+		{"toUpperInAlphabet", py_stringutils_toUpperInAlphabet, METH_VARARGS, "Convert the letters of the text to the upper case of an alphabet"},
+		{"toLowerInAlphabet", py_stringutils_toLowerInAlphabet, METH_VARARGS, "Convert the letters of the text to the lower case of an alphabet"},
 		{NULL, NULL}
 };
 
@@ -0,0 +1,231 @@
+# Copyright 2014 by Daniel Ortiz
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Compile the grapheme cluster break property of UAX #29 into the two stage
+table of graphemeTables.h. The general categories come from the unicodedata
+module of the python that runs the script, and the properties that it does
+not have are listed below. Run it with --check to find a graphemeTables.h
+that is out of date.
+@author:  Daniel Ortiz
+@version: 0.01
+"""
+import argparse, os, sys, unicodedata
+
+# The break properties, in the order of the graphemeBreakProperties enum
+PROPERTIES = ['OTHER', 'CR', 'LF', 'CONTROL', 'EXTEND', 'ZWJ', 'REGIONAL_INDICATOR', 'PREPEND', 'SPACING_MARK',
+              'L', 'V', 'T', 'LV', 'LVT', 'EXTENDED_PICTOGRAPHIC']
+
+# The code points of the two stage table. The planes past it are handled by
+# getGraphemeBreakProperty, and PLANE_14 is checked against the data here.
+CODE_POINTS = 0x20000
+BLOCK_SIZE = 64
+
+# The tags and the variation selectors of plane 14 are Extend, and the rest of
+# the plane is Control
+PLANE_14 = (0xe0000, 0xe0fff)
+PLANE_14_EXTEND = [(0xe0020, 0xe007f), (0xe0100, 0xe01ef)]
+
+# Other_Grapheme_Extend, which is Extend but not Mn or Me
+OTHER_GRAPHEME_EXTEND = ("09BE 09D7 0B3E 0B57 0BBE 0BD7 0CC2 0CD5-0CD6 0D3E 0D57 0DCF 0DDF 1B35 200C 302E-302F FF9E-FF9F "
+                         "1133E 11357 114B0 114BD 115AF 11930 1D165 1D16E-1D172 E0020-E007F")
+
+# The emoji modifiers are Extend
+EMOJI_MODIFIERS = "1F3FB-1F3FF"
+
+# Prepended_Concatenation_Mark and the preceding repha consonants
+PREPEND = "0600-0605 06DD 070F 0890-0891 08E2 110BD 110CD 0D4E 111C2-111C3 1193F 11941 11A3A 11A84-11A89 11D46"
+
+# The spacing marks that are not SpacingMark, and the two that are not Mc
+SPACING_MARK_EXCEPTIONS = "102B 102C 1038 1062-1064 1067-106D 1083 1087-108C 108F 109A-109C 1A61 1A63 1A64 AA7B AA7D 11720 11721"
+SPACING_MARK_ADDITIONS = "0E33 0EB3"
+
+# The unassigned default ignorable code points, which are Control
+DEFAULT_IGNORABLE_UNASSIGNED = "2065 FFF0-FFF8 E0000 E0002-E001F E0080-E00FF E01F0-E0FFF"
+
+# Extended_Pictographic of emoji-data.txt
+EXTENDED_PICTOGRAPHIC = ("00A9 00AE 203C 2049 2122 2139 2194-2199 21A9-21AA 231A-231B 2328 2388 23CF 23E9-23F3 23F8-23FA "
+                         "24C2 25AA-25AB 25B6 25C0 25FB-25FE 2600-2605 2607-2612 2614-2685 2690-2705 2708-2712 2714 2716 "
+                         "271D 2721 2728 2733-2734 2744 2747 274C 274E 2753-2755 2757 2763-2767 2795-2797 27A1 27B0 27BF "
+                         "2934-2935 2B05-2B07 2B1B-2B1C 2B50 2B55 3030 303D 3297 3299 1F000-1F0FF 1F10D-1F10F 1F12F "
+                         "1F16C-1F171 1F17E-1F17F 1F18E 1F191-1F19A 1F1AD-1F1E5 1F201-1F20F 1F21A 1F22F 1F232-1F23A "
+                         "1F23C-1F23F 1F249-1F3FA 1F400-1F53D 1F546-1F64F 1F680-1F6FF 1F774-1F77F 1F7D5-1F7FF "
+                         "1F80C-1F80F 1F848-1F84F 1F85A-1F85F 1F888-1F88F 1F8AE-1F8FF 1F90C-1F93A 1F93C-1F945 "
+                         "1F947-1FAFF 1FC00-1FFFD")
+
+REGIONAL_INDICATORS = "1F1E6-1F1FF"
+
+# Hangul_Syllable_Type
+HANGUL_L = "1100-115F A960-A97C"
+HANGUL_V = "1160-11A7 D7B0-D7C6"
+HANGUL_T = "11A8-11FF D7CB-D7FB"
+HANGUL_SYLLABLES = (0xac00, 0xd7a3)
+
+LICENSE = """//Copyright 2014 by Daniel Ortiz
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+"""
+
+def parseRanges(ranges):
+    """
+    Get the code points of a list of hex code points and first-last ranges
+    @param ranges: The code points and ranges separated by spaces
+    """
+    codePoints = []
+    for r in ranges.split():
+        bounds = r.split('-')
+        codePoints.extend(range(int(bounds[0], 16), int(bounds[-1], 16) + 1))
+    return codePoints
+
+def getBreakProperties():
+    """
+    Get the break property of every code point, as an index of PROPERTIES
+    """
+    index = dict((name, i) for i, name in enumerate(PROPERTIES))
+    properties = [index['OTHER']] * 0x110000
+    for codePoint in range(0x110000):
+        category = unicodedata.category(unichr(codePoint) if sys.version_info[0] < 3 else chr(codePoint))
+        if category in ('Zl', 'Zp', 'Cc', 'Cf'):
+            properties[codePoint] = index['CONTROL']
+        elif category in ('Mn', 'Me'):
+            properties[codePoint] = index['EXTEND']
+        elif category == 'Mc':
+            properties[codePoint] = index['SPACING_MARK']
+
+    # The later lists take precedence over the earlier ones
+    overrides = [
+        (DEFAULT_IGNORABLE_UNASSIGNED, 'CONTROL'),
+        (EXTENDED_PICTOGRAPHIC, 'EXTENDED_PICTOGRAPHIC'),
+        (SPACING_MARK_EXCEPTIONS, 'OTHER'),
+        (SPACING_MARK_ADDITIONS, 'SPACING_MARK'),
+        (OTHER_GRAPHEME_EXTEND, 'EXTEND'),
+        (EMOJI_MODIFIERS, 'EXTEND'),
+        (PREPEND, 'PREPEND'),
+        (REGIONAL_INDICATORS, 'REGIONAL_INDICATOR'),
+        (HANGUL_L, 'L'),
+        (HANGUL_V, 'V'),
+        (HANGUL_T, 'T'),
+        ("200D", 'ZWJ'),
+        ("000D", 'CR'),
+        ("000A", 'LF')
+    ]
+    for ranges, name in overrides:
+        for codePoint in parseRanges(ranges):
+            properties[codePoint] = index[name]
+    for codePoint in range(HANGUL_SYLLABLES[0], HANGUL_SYLLABLES[1] + 1):
+        properties[codePoint] = index['LV'] if (codePoint - HANGUL_SYLLABLES[0]) % 28 == 0 else index['LVT']
+    return properties
+
+def checkPastTable(properties):
+    """
+    Check that the code points past the table have the properties that
+    getGraphemeBreakProperty gives them
+    @param properties: The break property of every code point
+    """
+    for codePoint in range(CODE_POINTS, 0x110000):
+        expected = 'OTHER'
+        if PLANE_14[0] <= codePoint <= PLANE_14[1]:
+            expected = 'EXTEND' if any(first <= codePoint <= last for first, last in PLANE_14_EXTEND) else 'CONTROL'
+        if PROPERTIES[properties[codePoint]] != expected:
+            raise ValueError("U+%X is %s, not %s" % (codePoint, PROPERTIES[properties[codePoint]], expected))
+
+def generateHeader(properties):
+    """
+    Generate graphemeTables.h
+    @param properties: The break property of every code point
+    """
+    blocks = []
+    blockIndices = {}
+    pages = []
+    for start in range(0, CODE_POINTS, BLOCK_SIZE):
+        block = tuple(properties[start:start + BLOCK_SIZE])
+        if block not in blockIndices:
+            blockIndices[block] = len(blocks)
+            blocks.append(block)
+        pages.append(blockIndices[block])
+    if len(blocks) > 256:
+        raise ValueError("The blocks do not fit the unsigned char of graphemeBreakPages")
+
+    out = [LICENSE]
+    out.append("// Generated by generateGraphemeTables.py from Unicode %s. Do not edit.\n" % unicodedata.unidata_version)
+    out.append("#ifndef __LANGUAGE_GRAPHEMETABLES_H__\n#define __LANGUAGE_GRAPHEMETABLES_H__\n")
+    out.append("/**\n * The grapheme cluster break properties of UAX #29\n */")
+    out.append("typedef enum{")
+    out.append(",\n".join("\tGRAPHEME_BREAK_%s = %d" % (name, i) for i, name in enumerate(PROPERTIES)))
+    out.append("} graphemeBreakProperties;\n")
+    out.append("/**\n * The code points of the two stage break property table. The planes past\n"
+               " * the first two have no property but the tags and variation selectors of\n"
+               " * plane 14, see getGraphemeBreakProperty.\n */")
+    out.append("#define GRAPHEME_BREAK_CODE_POINTS 0x%x\n" % CODE_POINTS)
+    out.append("/**\n * The number of code points in a block of the break property table\n */")
+    out.append("#define GRAPHEME_BREAK_BLOCK_SIZE %d\n" % BLOCK_SIZE)
+    out.append("/**\n * The number of blocks of the break property table\n */")
+    out.append("#define GRAPHEME_BREAK_BLOCKS %d\n" % len(blocks))
+    out.append("/**\n * The first stage of the break property table, the block of every %d code\n"
+               " * points\n */" % BLOCK_SIZE)
+    out.append("static const unsigned char graphemeBreakPages[GRAPHEME_BREAK_CODE_POINTS / GRAPHEME_BREAK_BLOCK_SIZE] = {")
+    rows = []
+    pagesPerRow = 32
+    for start in range(0, len(pages), pagesPerRow):
+        separator = ',' if start + pagesPerRow < len(pages) else ''
+        rows.append("\t%s%s\t// %05x-%05x" % (",".join(str(p) for p in pages[start:start + pagesPerRow]), separator,
+                                             start * BLOCK_SIZE, (start + pagesPerRow) * BLOCK_SIZE - 1))
+    out.append("\n".join(rows))
+    out.append("};\n")
+    out.append("/**\n * The second stage of the break property table, the graphemeBreakProperties\n"
+               " * of the code points of each block\n */")
+    out.append("static const unsigned char graphemeBreakBlocks[GRAPHEME_BREAK_BLOCKS][GRAPHEME_BREAK_BLOCK_SIZE] = {")
+    rows = []
+    for i, block in enumerate(blocks):
+        half = BLOCK_SIZE // 2
+        rows.append("\t{%s,\t// %d\n\t\t%s}" % (",".join(str(p) for p in block[:half]), i,
+                                               ",".join(str(p) for p in block[half:])))
+    out.append(",\n".join(rows))
+    out.append("};\n")
+    out.append("#endif\n")
+    return "\n".join(out)
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the grapheme cluster break tables")
+    parser.add_argument('--check', action='store_true', help="Only check that graphemeTables.h is up to date")
+    args = parser.parse_args()
+
+    properties = getBreakProperties()
+    checkPastTable(properties)
+    content = generateHeader(properties)
+    fileName = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'graphemeTables.h')
+    current = None
+    if os.path.exists(fileName):
+        with open(fileName) as f:
+            current = f.read()
+    if current == content:
+        return 0
+    if args.check:
+        sys.stderr.write("Out of date: " + fileName + "\n")
+        return 1
+    with open(fileName, 'w') as f:
+        f.write(content)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
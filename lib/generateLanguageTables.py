@@ -0,0 +1,452 @@
+# Copyright 2014 by Daniel Ortiz
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Compile the language definitions of languages.json into the character class
+tables of languageTables.h and the language enums of the bindings. Run it
+after a change to languages.json, or with --check to find generated files
+that are out of date.
+@author:  Daniel Ortiz
+@version: 0.01
+"""
+import argparse, json, os, sys, unicodedata
+
+# The characterClasses bits of stringUtils.h
+CHARACTER_CLASS_ALPHA = 0x001
+CHARACTER_CLASS_UPPER = 0x002
+CHARACTER_CLASS_LOWER = 0x004
+CHARACTER_CLASS_DIGIT = 0x008
+CHARACTER_CLASS_HEX = 0x010
+CHARACTER_CLASS_PUNCT = 0x020
+CHARACTER_CLASS_EXTENDED = 0x040
+CHARACTER_CLASS_VALID = 0x080
+CHARACTER_CLASS_ROMANCE = 0x100
+
+# The encodings with a table per language, in the order of singleByteCharacterClasses
+SINGLE_BYTE_ENCODINGS = [('ASCII', 'ascii', 'ascii bytes'), ('ISO_8859_1', 'iso', 'ISO-8859-1 bytes')]
+
+# The number of pages of 256 code points in the unicode class trie
+UNICODE_CLASS_PAGES = 256
+
+# The letters of the language bigrams, the word boundary and a-z
+BIGRAM_LETTERS = '_abcdefghijklmnopqrstuvwxyz'
+
+# The encodings of the case mappings, the single byte encodings and the first
+# 256 code points of utf8 and utf16
+CASE_ENCODINGS = ['ASCII', 'ISO_8859_1', 'UNICODE']
+
+# The foldCases of stringUtils.h, the case of the text of foldDiacriticsInto:
+# kept, or the upper or the lower case of the alphabet
+FOLD_CASES = [None, True, False]
+
+LICENSE = """//Copyright 2014 by Daniel Ortiz
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+"""
+
+PYTHON_LICENSE = """# Copyright 2014 by Daniel Ortiz
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+
+def parseCodePoints(listOfRanges):
+    """
+    Get the code points of a list of hex code points and first-last ranges
+    @param listOfRanges: The list of code points and ranges
+    """
+    codePoints = set()
+    for r in listOfRanges:
+        bounds = r.split('-')
+        first = int(bounds[0], 16)
+        last = int(bounds[-1], 16)
+        if len(bounds) > 2 or last < first:
+            raise ValueError("Malformed code point range " + r)
+        codePoints.update(range(first, last + 1))
+    return codePoints
+
+def getEncodingClasses(language, encoding):
+    """
+    Get the class definition of a language in an encoding, following the
+    encodings that name another encoding
+    @param language: The language definition
+    @param encoding: The name of the encoding
+    """
+    definition = language.get(encoding, {})
+    seen = [encoding]
+    while not isinstance(definition, dict):
+        if definition in seen:
+            raise ValueError("The encodings of " + language['name'] + " refer to each other")
+        seen.append(definition)
+        definition = language.get(definition, {})
+    return definition
+
+def getClassTable(definitions, language, encoding, size):
+    """
+    Get the characterClasses bits of every character of an encoding in a language
+    @param definitions: The languages.json definitions
+    @param language: The language definition
+    @param encoding: The name of the encoding
+    @param size: The number of characters in the table
+    """
+    table = [0] * size
+    def addClass(listOfRanges, characterClass):
+        for codePoint in parseCodePoints(listOfRanges):
+            if codePoint >= size:
+                raise ValueError("Code point %x is out of the %s range of %s" % (codePoint, encoding, language['name']))
+            table[codePoint] |= characterClass
+
+    classes = definitions['classes']
+    encodingClasses = getEncodingClasses(language, encoding)
+    addClass(classes.get('digit', []), CHARACTER_CLASS_DIGIT)
+    addClass(classes.get('hex', []), CHARACTER_CLASS_HEX)
+    addClass(classes.get('romance', []), CHARACTER_CLASS_ROMANCE | CHARACTER_CLASS_ALPHA)
+    addClass(definitions['valid'].get(encoding, []), CHARACTER_CLASS_VALID)
+    addClass(encodingClasses.get('upper', []), CHARACTER_CLASS_UPPER)
+    addClass(encodingClasses.get('lower', []), CHARACTER_CLASS_LOWER)
+    addClass(encodingClasses.get('punctuation', []), CHARACTER_CLASS_PUNCT)
+    addClass(encodingClasses.get('extended', []), CHARACTER_CLASS_EXTENDED | CHARACTER_CLASS_ALPHA)
+    return table
+
+def getCaseMappings(table, toUpper):
+    """
+    Get the byte or code point that every one of the first 256 characters of an
+    encoding converts to in a language. A letter of the alphabet converts when
+    its simple case mapping is a letter of the alphabet as well.
+    @param table: The classes of the characters of the encoding in the language
+    @param toUpper: True for the upper case mappings, False for the lower case ones
+    """
+    mappings = list(range(256))
+    for codePoint in range(len(table)):
+        if not table[codePoint] & CHARACTER_CLASS_ALPHA:
+            continue
+        character = unichr(codePoint) if sys.version_info[0] < 3 else chr(codePoint)
+        converted = character.upper() if toUpper else character.lower()
+        if len(converted) != 1 or ord(converted) == codePoint or ord(converted) >= len(table) or \
+                not table[ord(converted)] & CHARACTER_CLASS_ALPHA:
+            continue
+        if codePoint >= 256 or ord(converted) >= 256:
+            raise ValueError("The case mappings only cover the first 256 code points, not U+%X" % codePoint)
+        if (codePoint < 0x80) != (ord(converted) < 0x80):
+            # The conversions are in place because no letter changes its utf8 length
+            raise ValueError("U+%X and U+%X have different utf8 lengths" % (codePoint, ord(converted)))
+        mappings[codePoint] = ord(converted)
+    for codePoint in range(0x80):
+        # The vector paths convert the ascii letters without the tables
+        expected = codePoint ^ 0x20 if chr(codePoint).isalpha() and chr(codePoint).isupper() != toUpper else codePoint
+        if mappings[codePoint] != expected:
+            raise ValueError("The case mapping of ascii %x differs from the ascii letters" % codePoint)
+    return mappings
+
+def getFoldableCodePoints(definitions):
+    """
+    Get the precomposed letters that lose their diacritics in foldDiacriticsInto,
+    the extended letters of every language in iso-8859-1 and unicode. A search
+    key does not depend on the language of the text, so the letters of every
+    language fold in all of them.
+    @param definitions: The languages.json definitions
+    """
+    foldable = set()
+    for language in definitions['languages']:
+        for encoding in ('ISO_8859_1', 'UNICODE'):
+            foldable.update(parseCodePoints(getEncodingClasses(language, encoding).get('extended', [])))
+    return foldable
+
+def getFoldings(foldable, caseMappings):
+    """
+    Get the character that every one of the first 256 characters of an encoding
+    folds to: the base letter of a foldable letter, in the case of the mappings
+    @param foldable: The foldable code points of the encoding
+    @param caseMappings: The case mappings of the encoding in the language, or None to keep the case
+    """
+    foldings = list(range(256))
+    for codePoint in foldable:
+        character = unichr(codePoint) if sys.version_info[0] < 3 else chr(codePoint)
+        base = ord(unicodedata.normalize('NFD', character)[0])
+        if codePoint >= 256 or base >= 0x80:
+            # The folded letters are ascii, so folding never makes utf8 longer
+            raise ValueError("U+%X does not fold to an ascii letter" % codePoint)
+        foldings[codePoint] = base
+    if caseMappings is not None:
+        foldings = [caseMappings[f] for f in foldings]
+    return foldings
+
+def formatRows(values, indent, rowComment):
+    """
+    Format a list of 256 classes as rows of 16 with the range of each row
+    @param values: The classes
+    @param indent: The indentation of the rows
+    @param rowComment: A function of the first index of a row that returns its comment
+    """
+    rows = []
+    for start in range(0, len(values), 16):
+        row = ','.join('0x%03x' % v for v in values[start:start + 16])
+        separator = ',' if start + 16 < len(values) else ''
+        rows.append('%s%s%s\t// %s' % (indent, row, separator, rowComment(start)))
+    return '\n'.join(rows)
+
+def getTitle(name):
+    """
+    Get the title case of a language name, e.g. ENGLISH to English
+    @param name: The name of the language
+    """
+    return name[0].upper() + name[1:].lower()
+
+def generateHeader(definitions):
+    """
+    Generate languageTables.h
+    @param definitions: The languages.json definitions
+    """
+    languages = definitions['languages']
+    names = [l['name'] for l in languages]
+    out = [LICENSE]
+    out.append("// Generated by generateLanguageTables.py from languages.json. Do not edit.\n")
+    out.append("#ifndef __LANGUAGE_LANGUAGETABLES_H__\n#define __LANGUAGE_LANGUAGETABLES_H__\n")
+
+    # The languages
+    out.append("/**\n * An enum that encapsulates the different encodings and their\n * alphabets\n */")
+    out.append("typedef enum{")
+    out.append(",\n".join("\t%s = %d" % (name, i) for i, name in enumerate(names)))
+    out.append("} Languages;\n")
+    out.append("/**\n * The number of languages\n */")
+    out.append("#define NUMBER_OF_LANGUAGES %d\n" % len(names))
+    out.append("/**\n * Apply a macro to every language, so that the code that instantiates a\n"
+               " * template per language picks up a new language\n */")
+    out.append("#define LANGUAGE_FOR_EACH_LANGUAGE(APPLY) %s\n" % " ".join("APPLY(%s)" % name for name in names))
+    out.append("/**\n * The names of the languages, indexed by the language\n */")
+    out.append("static const char * const languageNames[NUMBER_OF_LANGUAGES] = {")
+    out.append("\t" + ", ".join('"%s"' % name for name in names))
+    out.append("};\n")
+
+    # The single byte encodings
+    for encoding, prefix, description in SINGLE_BYTE_ENCODINGS:
+        for language in languages:
+            title = getTitle(language['name'])
+            table = getClassTable(definitions, language, encoding, 256)
+            if getEncodingClasses(language, encoding):
+                out.append("/**\n * The classes of %s in %s\n */" % (description, title))
+            else:
+                # A language without letters or marks of its own in the encoding
+                out.append("/**\n * The classes of %s in %s. %s has no %s upper or lower\n"
+                           " * case letters or punctuation marks, only the romance core of the alphabet\n */"
+                           % (description, title, description[0].upper() + description[1:].split(' ')[0], title))
+            out.append("static const unsigned short %s%sCharacterClasses[256] = {" % (prefix, title))
+            out.append(formatRows(table, '\t', lambda start: '%02x-%02x' % (start, start + 15)))
+            out.append("};\n")
+    out.append("/**\n * The character class tables of the single byte encodings, indexed by the\n"
+               " * encoding less ASCII and by the language. The bytes past 0x7f keep the valid\n"
+               " * bit in ascii that the signed compare of isValidCharacter has always given them.\n */")
+    out.append("static const unsigned short * const singleByteCharacterClasses[%d][NUMBER_OF_LANGUAGES] = {"
+               % len(SINGLE_BYTE_ENCODINGS))
+    rows = []
+    for encoding, prefix, description in SINGLE_BYTE_ENCODINGS:
+        rows.append("\t{" + ", ".join("%s%sCharacterClasses" % (prefix, getTitle(l['name'])) for l in languages) + "}")
+    out.append(",\n".join(rows))
+    out.append("};\n")
+
+    # The unicode class trie. The pages with a class in any language get a block
+    size = UNICODE_CLASS_PAGES * 256
+    unicodeTables = [getClassTable(definitions, l, 'UNICODE', size) for l in languages]
+    usedPages = sorted(set(codePoint >> 8 for table in unicodeTables for codePoint in range(size) if table[codePoint]))
+    pages = [0] * UNICODE_CLASS_PAGES
+    for block, page in enumerate(usedPages):
+        pages[page] = block + 1
+    out.append("/**\n * The number of pages of 256 code points in the first stage of the unicode\n"
+               " * class trie. The trie covers the basic multilingual plane, and the code\n"
+               " * points past it have no classes in any language.\n */")
+    out.append("#define UNICODE_CLASS_PAGES %d\n" % UNICODE_CLASS_PAGES)
+    out.append("/**\n * The number of blocks in the second stage of the unicode class trie\n */")
+    out.append("#define UNICODE_CLASS_BLOCKS %d\n" % max(len(usedPages), 1))
+    out.append("/**\n * The first stage of the unicode class trie. Every page of 256 code points has\n"
+               " * the number of its block in unicodeClassBlocks, or 0 when none of its code\n"
+               " * points has a class.\n */")
+    out.append("static const unsigned char unicodeClassPages[UNICODE_CLASS_PAGES] = {")
+    rows = []
+    for start in range(0, UNICODE_CLASS_PAGES, 16):
+        separator = ',' if start + 16 < UNICODE_CLASS_PAGES else ''
+        rows.append("\t%s%s\t// %04x-%04x" % (",".join(str(p) for p in pages[start:start + 16]), separator,
+                                             start << 8, ((start + 16) << 8) - 1))
+    out.append("\n".join(rows))
+    out.append("};\n")
+    out.append("/**\n * The second stage of the unicode class trie, the blocks of each language.\n"
+               " * These are the classes of the utf8 and utf16 predicates, so they differ from\n"
+               " * the iso-8859-1 tables where the lists of the two have always differed.\n"
+               " * CHARACTER_CLASS_VALID is left to the decoders.\n */")
+    out.append("static const unsigned short unicodeClassBlocks[NUMBER_OF_LANGUAGES][UNICODE_CLASS_BLOCKS][256] = {")
+    languageRows = []
+    for language, table in zip(languages, unicodeTables):
+        blocks = []
+        for page in (usedPages or [0]):
+            block = table[page << 8:(page + 1) << 8] if usedPages else [0] * 256
+            blocks.append(formatRows(block, '\t\t', lambda start: '%02x-%02x' % (start, start + 15)))
+        languageRows.append("\t{{\t// %s\n%s\n\t}}" % (getTitle(language['name']), "\n\t},{\n".join(blocks)))
+    out.append(",\n".join(languageRows))
+    out.append("};\n")
+
+    # The case mappings of each encoding and language
+    out.append("/**\n * The index of the upper and lower case mappings in languageCaseMappings\n */")
+    out.append("#define LANGUAGE_CASE_UPPER 0")
+    out.append("#define LANGUAGE_CASE_LOWER 1\n")
+    out.append("/**\n * The number of encodings of languageCaseMappings: ascii, iso-8859-1, and the\n"
+               " * first 256 code points of utf8 and utf16\n */")
+    out.append("#define LANGUAGE_CASE_ENCODINGS %d\n" % len(CASE_ENCODINGS))
+    out.append("/**\n * The character that each of the first 256 characters converts to, indexed by\n"
+               " * the encoding, the language and the case. A letter of the alphabet converts\n"
+               " * when its simple case mapping is a letter of the alphabet too, so no letter\n"
+               " * changes its utf8 length and the ascii letters are those of every language.\n */")
+    out.append("static const unsigned char languageCaseMappings[LANGUAGE_CASE_ENCODINGS][NUMBER_OF_LANGUAGES][2][256] = {")
+    encodingRows = []
+    for encoding in CASE_ENCODINGS:
+        languageRows = []
+        for language in languages:
+            size = 256 if encoding != 'UNICODE' else UNICODE_CLASS_PAGES * 256
+            table = getClassTable(definitions, language, encoding, size)
+            cases = [formatRows(getCaseMappings(table, toUpper), '\t\t\t', lambda start: '%02x-%02x' % (start, start + 15))
+                     for toUpper in (True, False)]
+            languageRows.append("\t\t{{\t// %s %s upper\n%s\n\t\t},{\t// lower\n%s\n\t\t}}"
+                                % (encoding, getTitle(language['name']), cases[0], cases[1]))
+        encodingRows.append("\t{\n%s\n\t}" % ",\n".join(languageRows))
+    out.append(",\n".join(encodingRows))
+    out.append("};\n")
+
+    # The diacritic foldings of each encoding and language
+    foldable = getFoldableCodePoints(definitions)
+    out.append("/**\n * The number of cases of languageFoldings, indexed by the foldCases value\n */")
+    out.append("#define LANGUAGE_FOLD_CASES %d\n" % len(FOLD_CASES))
+    out.append("/**\n * The character that each of the first 256 characters folds to, indexed by the\n"
+               " * encoding and the language as languageCaseMappings and by the foldCases\n"
+               " * value. The extended letters of every language fold to their ascii base\n"
+               " * letter, which then takes the case of the alphabet of the language. The\n"
+               " * bytes past ascii have no letters in ascii.\n */")
+    out.append("static const unsigned char languageFoldings[LANGUAGE_CASE_ENCODINGS][NUMBER_OF_LANGUAGES][LANGUAGE_FOLD_CASES][256] = {")
+    encodingRows = []
+    for encoding in CASE_ENCODINGS:
+        languageRows = []
+        for language in languages:
+            size = 256 if encoding != 'UNICODE' else UNICODE_CLASS_PAGES * 256
+            table = getClassTable(definitions, language, encoding, size)
+            cases = []
+            for toUpper in FOLD_CASES:
+                caseMappings = getCaseMappings(table, toUpper) if toUpper is not None else None
+                foldings = getFoldings(foldable if encoding != 'ASCII' else set(), caseMappings)
+                cases.append(formatRows(foldings, '\t\t\t', lambda start: '%02x-%02x' % (start, start + 15)))
+            languageRows.append("\t\t{{\t// %s %s keep case\n%s\n\t\t},{\t// upper\n%s\n\t\t},{\t// lower\n%s\n\t\t}}"
+                                % (encoding, getTitle(language['name']), cases[0], cases[1], cases[2]))
+        encodingRows.append("\t{\n%s\n\t}" % ",\n".join(languageRows))
+    out.append(",\n".join(encodingRows))
+    out.append("};\n")
+
+    # The language bigrams, a bit per language
+    if len(languages) > 32:
+        raise ValueError("The bigrams have a bit per language, so there can be no more than 32 languages")
+    bigrams = [0] * (len(BIGRAM_LETTERS) * len(BIGRAM_LETTERS))
+    for i, language in enumerate(languages):
+        for bigram in language.get('bigrams', []):
+            if len(bigram) != 2 or any(letter not in BIGRAM_LETTERS for letter in bigram):
+                raise ValueError("Malformed bigram " + bigram + " of " + language['name'])
+            bigrams[BIGRAM_LETTERS.index(bigram[0]) * len(BIGRAM_LETTERS) + BIGRAM_LETTERS.index(bigram[1])] |= 1 << i
+    out.append("/**\n * The number of letters of the language bigrams, the word boundary and a-z\n */")
+    out.append("#define LANGUAGE_BIGRAM_LETTERS %d\n" % len(BIGRAM_LETTERS))
+    out.append("/**\n * The languages of the bigrams of letters, a bit per language. A bigram is\n"
+               " * indexed by the letter before times LANGUAGE_BIGRAM_LETTERS and the letter,\n"
+               " * where 0 is a word boundary and 1-26 are a-z in either case.\n */")
+    out.append("static const unsigned int languageBigrams[LANGUAGE_BIGRAM_LETTERS * LANGUAGE_BIGRAM_LETTERS] = {")
+    rows = []
+    for start in range(0, len(bigrams), len(BIGRAM_LETTERS)):
+        separator = ',' if start + len(BIGRAM_LETTERS) < len(bigrams) else ''
+        rows.append("\t%s%s\t// %s" % (",".join('0x%x' % b for b in bigrams[start:start + len(BIGRAM_LETTERS)]),
+                                        separator, BIGRAM_LETTERS[start // len(BIGRAM_LETTERS)]))
+    out.append("\n".join(rows))
+    out.append("};\n")
+    out.append("#endif\n")
+    return "\n".join(out)
+
+def generateJavaEnum(definitions):
+    """
+    Generate the LanguageEncodings enum of the java binding
+    @param definitions: The languages.json definitions
+    """
+    names = [l['name'] for l in definitions['languages']]
+    values = ",\n".join("\t%s(%d)" % (name, i) for i, name in enumerate(names))
+    return ("package com.Language.types;\n\n"
+            "// Generated by generateLanguageTables.py from languages.json. Do not edit.\n\n"
+            "/**\n * The Language string encoding types\n * @author danielortiz\n */\n"
+            "public enum LanguageEncodings{\n" + values + ";\n\t\n"
+            "\tprivate int state;\n\tprivate LanguageEncodings(int s){\n\t\tstate = s;\n\t}\n\t\n"
+            "\t/**\n\t * Get the integer associated with the string encoding\n\t */\n"
+            "\tpublic int getEncodingValue(){\n\t\treturn state;\n\t}\n}\n")
+
+def generatePythonModule(definitions):
+    """
+    Generate the Languages module of the python binding
+    @param definitions: The languages.json definitions
+    """
+    names = [l['name'] for l in definitions['languages']]
+    values = ",\n".join("    '%s':%d" % (name, i) for i, name in enumerate(names))
+    return (PYTHON_LICENSE + '"""\nThe languages of Language. Generated by generateLanguageTables.py from\n'
+            'languages.json. Do not edit.\n"""\n\nlanguageEncodings = {\n' + values + "\n}\n")
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the language tables from languages.json")
+    parser.add_argument('--check', action='store_true', help="Only check that the generated files are up to date")
+    args = parser.parse_args()
+
+    libDir = os.path.dirname(os.path.abspath(__file__))
+    rootDir = os.path.dirname(libDir)
+    with open(os.path.join(libDir, 'languages.json')) as f:
+        definitions = json.load(f)
+    outputs = [
+        (os.path.join(libDir, 'languageTables.h'), generateHeader(definitions)),
+        (os.path.join(rootDir, 'bindings', 'java', 'com', 'Language', 'types', 'LanguageEncodings.java'),
+         generateJavaEnum(definitions)),
+        (os.path.join(rootDir, 'bindings', 'python', 'Languages.py'), generatePythonModule(definitions))
+    ]
+
+    outOfDate = []
+    for fileName, content in outputs:
+        current = None
+        if os.path.exists(fileName):
+            with open(fileName) as f:
+                current = f.read()
+        if current == content:
+            continue
+        outOfDate.append(fileName)
+        if not args.check:
+            with open(fileName, 'w') as f:
+                f.write(content)
+    if args.check and outOfDate:
+        sys.stderr.write("Out of date: " + ", ".join(outOfDate) + "\n")
+        return 1
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
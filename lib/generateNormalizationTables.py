@@ -0,0 +1,237 @@
+# Copyright 2014 by Daniel Ortiz
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+"""
+Compile the canonical decompositions, compositions and combining classes of
+UAX #15 into the tables of normalizationTables.h. The data comes from the
+unicodedata module of the python that runs the script. Run it with --check
+to find a normalizationTables.h that is out of date.
+@author:  Daniel Ortiz
+@version: 0.01
+"""
+import argparse, os, sys, unicodedata
+
+# The code points of the two stage property table. The planes past it have no
+# decompositions and no combining marks, which checkPastTable makes sure of.
+CODE_POINTS = 0x30000
+BLOCK_SIZE = 64
+
+# The bits of a property table entry
+COMBINING_CLASS_MASK = 0xff
+NFC_MAYBE = 0x100
+NFC_NO = 0x200
+NFD_NO = 0x400
+
+# The hangul syllables, which are decomposed and composed by arithmetic
+HANGUL_SYLLABLES = (0xac00, 0xd7a3)
+HANGUL_V = (0x1161, 0x1175)
+HANGUL_T = (0x11a8, 0x11c2)
+
+LICENSE = """//Copyright 2014 by Daniel Ortiz
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+"""
+
+def character(codePoint):
+    return unichr(codePoint) if sys.version_info[0] < 3 else chr(codePoint)
+
+def getNormalizationData():
+    """
+    Get the property table entry of every code point, the full canonical
+    decompositions and the primary composites
+    """
+    properties = [0] * 0x110000
+    decompositions = {}
+    compositions = {}
+    for codePoint in range(0x110000):
+        if HANGUL_SYLLABLES[0] <= codePoint <= HANGUL_SYLLABLES[1]:
+            properties[codePoint] = NFD_NO
+            continue
+        c = character(codePoint)
+        properties[codePoint] = unicodedata.combining(c)
+        mapping = unicodedata.decomposition(c)
+        if mapping == '' or mapping.startswith('<'):
+            continue
+        properties[codePoint] |= NFD_NO
+        decompositions[codePoint] = [ord(d) for d in unicodedata.normalize('NFD', c)]
+        if unicodedata.normalize('NFC', c) != c:
+            # Singletons, non starter decompositions and the composition
+            # exclusions never appear in NFC
+            properties[codePoint] |= NFC_NO
+        else:
+            pair = tuple(int(d, 16) for d in mapping.split())
+            compositions[pair] = codePoint
+    for first, second in compositions:
+        properties[second] |= NFC_MAYBE
+    for first, last in (HANGUL_V, HANGUL_T):
+        for codePoint in range(first, last + 1):
+            properties[codePoint] |= NFC_MAYBE
+    return properties, decompositions, compositions
+
+def getQuickCheckLimit(properties, mask):
+    """
+    Get the first code point that is not a starter that is already normalized
+    @param properties: The property table entry of every code point
+    @param mask: The quick check bits of the normalization form
+    """
+    codePoint = 0
+    while properties[codePoint] & (COMBINING_CLASS_MASK | mask) == 0:
+        codePoint += 1
+    return codePoint
+
+def checkPastTable(properties):
+    """
+    Check that the code points past the table have no properties
+    @param properties: The property table entry of every code point
+    """
+    for codePoint in range(CODE_POINTS, 0x110000):
+        if properties[codePoint] != 0:
+            raise ValueError("U+%X is past the property table" % codePoint)
+
+def formatRows(values, perRow):
+    """
+    Format a list of numbers as the rows of a C array
+    @param values: The numbers
+    @param perRow: The number of values in a row
+    """
+    rows = []
+    for start in range(0, len(values), perRow):
+        separator = ',' if start + perRow < len(values) else ''
+        rows.append("\t%s%s" % (",".join(values[start:start + perRow]), separator))
+    return "\n".join(rows)
+
+def generateHeader(properties, decompositions, compositions):
+    """
+    Generate normalizationTables.h
+    @param properties: The property table entry of every code point
+    @param decompositions: The full canonical decomposition of every code point that has one
+    @param compositions: The primary composite of every pair of code points that has one
+    """
+    blocks = []
+    blockIndices = {}
+    pages = []
+    for start in range(0, CODE_POINTS, BLOCK_SIZE):
+        block = tuple(properties[start:start + BLOCK_SIZE])
+        if block not in blockIndices:
+            blockIndices[block] = len(blocks)
+            blocks.append(block)
+        pages.append(blockIndices[block])
+    if len(blocks) > 256:
+        raise ValueError("The blocks do not fit the unsigned char of normalizationPages")
+
+    decomposed = sorted(decompositions)
+    offsets = [0]
+    pool = []
+    for codePoint in decomposed:
+        pool.extend(decompositions[codePoint])
+        offsets.append(len(pool))
+    if len(pool) > 0xffff:
+        raise ValueError("The decompositions do not fit the unsigned short of normalizationDecompositionOffsets")
+    pairs = sorted(compositions)
+
+    out = [LICENSE]
+    out.append("// Generated by generateNormalizationTables.py from Unicode %s. Do not edit.\n" % unicodedata.unidata_version)
+    out.append("#ifndef __LANGUAGE_NORMALIZATIONTABLES_H__\n#define __LANGUAGE_NORMALIZATIONTABLES_H__\n")
+    out.append("/**\n * The bits of an entry of the normalization property table: the canonical\n"
+               " * combining class, and the quick check values that are not yes\n */")
+    out.append("#define NORMALIZATION_COMBINING_CLASS_MASK 0x%x" % COMBINING_CLASS_MASK)
+    out.append("#define NORMALIZATION_NFC_MAYBE 0x%x" % NFC_MAYBE)
+    out.append("#define NORMALIZATION_NFC_NO 0x%x" % NFC_NO)
+    out.append("#define NORMALIZATION_NFD_NO 0x%x\n" % NFD_NO)
+    out.append("/**\n * The code points below these are starters that are already in NFC and NFD\n */")
+    out.append("#define NORMALIZATION_NFC_QUICK_CHECK_LIMIT 0x%x" % getQuickCheckLimit(properties, NFC_MAYBE | NFC_NO))
+    out.append("#define NORMALIZATION_NFD_QUICK_CHECK_LIMIT 0x%x\n" % getQuickCheckLimit(properties, NFD_NO))
+    out.append("/**\n * The code points of the two stage property table. The planes past it have\n"
+               " * no decompositions and no combining marks.\n */")
+    out.append("#define NORMALIZATION_CODE_POINTS 0x%x\n" % CODE_POINTS)
+    out.append("/**\n * The number of code points in a block of the property table\n */")
+    out.append("#define NORMALIZATION_BLOCK_SIZE %d\n" % BLOCK_SIZE)
+    out.append("/**\n * The number of blocks of the property table\n */")
+    out.append("#define NORMALIZATION_BLOCKS %d\n" % len(blocks))
+    out.append("/**\n * The number of code points with a canonical decomposition, hangul aside\n */")
+    out.append("#define NORMALIZATION_DECOMPOSITIONS %d\n" % len(decomposed))
+    out.append("/**\n * The number of code points in the longest full decomposition\n */")
+    out.append("#define NORMALIZATION_MAX_DECOMPOSITION %d\n" % max(len(d) for d in decompositions.values()))
+    out.append("/**\n * The number of primary composites, hangul aside\n */")
+    out.append("#define NORMALIZATION_COMPOSITIONS %d\n" % len(pairs))
+    out.append("/**\n * The first stage of the property table, the block of every %d code points\n */" % BLOCK_SIZE)
+    out.append("static const unsigned char normalizationPages[NORMALIZATION_CODE_POINTS / NORMALIZATION_BLOCK_SIZE] = {")
+    out.append(formatRows([str(p) for p in pages], 32))
+    out.append("};\n")
+    out.append("/**\n * The second stage of the property table, the entries of the code points of\n * each block\n */")
+    out.append("static const unsigned short normalizationBlocks[NORMALIZATION_BLOCKS][NORMALIZATION_BLOCK_SIZE] = {")
+    rows = []
+    for i, block in enumerate(blocks):
+        half = BLOCK_SIZE // 2
+        rows.append("\t{%s,\t// %d\n\t\t%s}" % (",".join("0x%x" % p for p in block[:half]), i,
+                                               ",".join("0x%x" % p for p in block[half:])))
+    out.append(",\n".join(rows))
+    out.append("};\n")
+    out.append("/**\n * The sorted code points that have a canonical decomposition\n */")
+    out.append("static const unsigned int normalizationDecomposed[NORMALIZATION_DECOMPOSITIONS] = {")
+    out.append(formatRows(["0x%x" % c for c in decomposed], 16))
+    out.append("};\n")
+    out.append("/**\n * Where the full decomposition of each code point of normalizationDecomposed\n"
+               " * starts in normalizationDecompositions. The last offset is the end of the pool.\n */")
+    out.append("static const unsigned short normalizationDecompositionOffsets[NORMALIZATION_DECOMPOSITIONS + 1] = {")
+    out.append(formatRows([str(o) for o in offsets], 24))
+    out.append("};\n")
+    out.append("/**\n * The full canonical decompositions, in canonical order\n */")
+    out.append("static const unsigned int normalizationDecompositions[%d] = {" % len(pool))
+    out.append(formatRows(["0x%x" % c for c in pool], 16))
+    out.append("};\n")
+    out.append("/**\n * The sorted pairs of code points that compose, as first << 21 | second\n */")
+    out.append("static const unsigned long long normalizationCompositionPairs[NORMALIZATION_COMPOSITIONS] = {")
+    out.append(formatRows(["0x%xULL" % (first << 21 | second) for first, second in pairs], 8))
+    out.append("};\n")
+    out.append("/**\n * The primary composite of each pair of normalizationCompositionPairs\n */")
+    out.append("static const unsigned int normalizationComposites[NORMALIZATION_COMPOSITIONS] = {")
+    out.append(formatRows(["0x%x" % compositions[pair] for pair in pairs], 16))
+    out.append("};\n")
+    out.append("#endif\n")
+    return "\n".join(out)
+
+def main():
+    parser = argparse.ArgumentParser(description="Generate the normalization tables")
+    parser.add_argument('--check', action='store_true', help="Only check that normalizationTables.h is up to date")
+    args = parser.parse_args()
+
+    properties, decompositions, compositions = getNormalizationData()
+    checkPastTable(properties)
+    content = generateHeader(properties, decompositions, compositions)
+    fileName = os.path.join(os.path.dirname(os.path.abspath(__file__)), 'normalizationTables.h')
+    current = None
+    if os.path.exists(fileName):
+        with open(fileName) as f:
+            current = f.read()
+    if current == content:
+        return 0
+    if args.check:
+        sys.stderr.write("Out of date: " + fileName + "\n")
+        return 1
+    with open(fileName, 'w') as f:
+        f.write(content)
+    return 0
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -0,0 +1,1162 @@
+//Copyright 2014 by Daniel Ortiz
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Generated by generateLanguageTables.py from languages.json. Do not edit.
+
+#ifndef __LANGUAGE_LANGUAGETABLES_H__
+#define __LANGUAGE_LANGUAGETABLES_H__
+
+/**
+ * An enum that encapsulates the different encodings and their
+ * alphabets
+ */
+typedef enum{
+	ENGLISH = 0,
+	SPANISH = 1,
+	FRENCH = 2
+} Languages;
+
+/**
+ * The number of languages
+ */
+#define NUMBER_OF_LANGUAGES 3
+
+/**
+ * Apply a macro to every language, so that the code that instantiates a
+ * template per language picks up a new language
+ */
+#define LANGUAGE_FOR_EACH_LANGUAGE(APPLY) APPLY(ENGLISH) APPLY(SPANISH) APPLY(FRENCH)
+
+/**
+ * The names of the languages, indexed by the language
+ */
+static const char * const languageNames[NUMBER_OF_LANGUAGES] = {
+	"ENGLISH", "SPANISH", "FRENCH"
+};
+
+/**
+ * The classes of ascii bytes in English
+ */
+static const unsigned short asciiEnglishCharacterClasses[256] = {
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 00-0f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 10-1f
+	0x0a0,0x0a0,0x080,0x080,0x080,0x080,0x080,0x0a0,0x0a0,0x0a0,0x080,0x080,0x0a0,0x0a0,0x0a0,0x080,	// 20-2f
+	0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x0a0,0x0a0,0x080,0x080,0x080,0x0a0,	// 30-3f
+	0x080,0x193,0x193,0x193,0x193,0x193,0x193,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,	// 40-4f
+	0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x0a0,0x080,0x0a0,0x080,0x080,	// 50-5f
+	0x080,0x195,0x195,0x195,0x195,0x195,0x195,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,	// 60-6f
+	0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x0a0,0x080,0x0a0,0x080,0x000,	// 70-7f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 80-8f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 90-9f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// a0-af
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// b0-bf
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// c0-cf
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// d0-df
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// e0-ef
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080	// f0-ff
+};
+
+/**
+ * The classes of ascii bytes in Spanish. Ascii has no Spanish upper or lower
+ * case letters or punctuation marks, only the romance core of the alphabet
+ */
+static const unsigned short asciiSpanishCharacterClasses[256] = {
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 00-0f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 10-1f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 20-2f
+	0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x080,0x080,0x080,0x080,0x080,0x080,	// 30-3f
+	0x080,0x191,0x191,0x191,0x191,0x191,0x191,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,	// 40-4f
+	0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x080,0x080,0x080,0x080,0x080,	// 50-5f
+	0x080,0x191,0x191,0x191,0x191,0x191,0x191,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,	// 60-6f
+	0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x080,0x080,0x080,0x080,0x000,	// 70-7f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 80-8f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 90-9f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// a0-af
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// b0-bf
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// c0-cf
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// d0-df
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// e0-ef
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080	// f0-ff
+};
+
+/**
+ * The classes of ascii bytes in French. Ascii has no French upper or lower
+ * case letters or punctuation marks, only the romance core of the alphabet
+ */
+static const unsigned short asciiFrenchCharacterClasses[256] = {
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 00-0f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 10-1f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 20-2f
+	0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x080,0x080,0x080,0x080,0x080,0x080,	// 30-3f
+	0x080,0x191,0x191,0x191,0x191,0x191,0x191,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,	// 40-4f
+	0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x080,0x080,0x080,0x080,0x080,	// 50-5f
+	0x080,0x191,0x191,0x191,0x191,0x191,0x191,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,	// 60-6f
+	0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x181,0x080,0x080,0x080,0x080,0x000,	// 70-7f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 80-8f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// 90-9f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// a0-af
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// b0-bf
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// c0-cf
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// d0-df
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// e0-ef
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080	// f0-ff
+};
+
+/**
+ * The classes of ISO-8859-1 bytes in English
+ */
+static const unsigned short isoEnglishCharacterClasses[256] = {
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 00-0f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 10-1f
+	0x000,0x0a0,0x0a0,0x080,0x080,0x080,0x080,0x0a0,0x0a0,0x0a0,0x080,0x080,0x0a0,0x0a0,0x0a0,0x080,	// 20-2f
+	0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x0a0,0x0a0,0x080,0x080,0x080,0x0a0,	// 30-3f
+	0x080,0x193,0x193,0x193,0x193,0x193,0x193,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,	// 40-4f
+	0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x0a0,0x080,0x0a0,0x080,0x080,	// 50-5f
+	0x080,0x195,0x195,0x195,0x195,0x195,0x195,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,	// 60-6f
+	0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x0a0,0x080,0x0a0,0x080,0x000,	// 70-7f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 80-8f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 90-9f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// a0-af
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// b0-bf
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// c0-cf
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// d0-df
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// e0-ef
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080	// f0-ff
+};
+
+/**
+ * The classes of ISO-8859-1 bytes in Spanish
+ */
+static const unsigned short isoSpanishCharacterClasses[256] = {
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 00-0f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 10-1f
+	0x000,0x0a0,0x0a0,0x080,0x080,0x080,0x080,0x0a0,0x0a0,0x0a0,0x080,0x080,0x0a0,0x0a0,0x0a0,0x080,	// 20-2f
+	0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x0a0,0x0a0,0x080,0x080,0x080,0x0a0,	// 30-3f
+	0x080,0x193,0x193,0x193,0x193,0x193,0x193,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,	// 40-4f
+	0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x0a0,0x080,0x0a0,0x080,0x080,	// 50-5f
+	0x080,0x195,0x195,0x195,0x195,0x195,0x195,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,	// 60-6f
+	0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x0a0,0x080,0x0a0,0x080,0x000,	// 70-7f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 80-8f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 90-9f
+	0x080,0x0a0,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x0a0,0x080,0x080,0x080,0x080,	// a0-af
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x0a0,0x080,0x080,0x080,0x0a0,	// b0-bf
+	0x080,0x0c3,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x0c3,0x080,0x080,0x080,0x0c3,0x080,0x080,	// c0-cf
+	0x080,0x0c3,0x080,0x0c3,0x080,0x080,0x080,0x080,0x080,0x080,0x0c3,0x080,0x080,0x080,0x080,0x080,	// d0-df
+	0x080,0x0c5,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x0c5,0x080,0x080,0x080,0x0c5,0x080,0x080,	// e0-ef
+	0x080,0x0c5,0x080,0x0c5,0x080,0x080,0x080,0x080,0x080,0x080,0x0c5,0x080,0x0c5,0x080,0x080,0x080	// f0-ff
+};
+
+/**
+ * The classes of ISO-8859-1 bytes in French
+ */
+static const unsigned short isoFrenchCharacterClasses[256] = {
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 00-0f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 10-1f
+	0x000,0x0a0,0x0a0,0x080,0x080,0x080,0x080,0x0a0,0x0a0,0x0a0,0x080,0x080,0x0a0,0x0a0,0x0a0,0x080,	// 20-2f
+	0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x098,0x0a0,0x0a0,0x080,0x080,0x080,0x0a0,	// 30-3f
+	0x080,0x193,0x193,0x193,0x193,0x193,0x193,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,	// 40-4f
+	0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x183,0x0a0,0x080,0x0a0,0x080,0x080,	// 50-5f
+	0x080,0x195,0x195,0x195,0x195,0x195,0x195,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,	// 60-6f
+	0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x185,0x0a0,0x080,0x0a0,0x080,0x000,	// 70-7f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 80-8f
+	0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 90-9f
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// a0-af
+	0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,0x080,	// b0-bf
+	0x0c3,0x080,0x0c3,0x080,0x080,0x080,0x080,0x0c3,0x0c3,0x0c3,0x0c3,0x0c3,0x0c3,0x080,0x0c3,0x080,	// c0-cf
+	0x080,0x080,0x080,0x080,0x0c3,0x080,0x080,0x080,0x080,0x0c3,0x080,0x0c3,0x0c3,0x080,0x080,0x080,	// d0-df
+	0x0c5,0x0c1,0x0c5,0x080,0x080,0x080,0x080,0x0c5,0x0c5,0x0c5,0x084,0x0c5,0x0c5,0x080,0x0c5,0x080,	// e0-ef
+	0x080,0x080,0x080,0x080,0x0c5,0x080,0x080,0x080,0x080,0x0c5,0x080,0x0c5,0x0c5,0x080,0x080,0x0c5	// f0-ff
+};
+
+/**
+ * The character class tables of the single byte encodings, indexed by the
+ * encoding less ASCII and by the language. The bytes past 0x7f keep the valid
+ * bit in ascii that the signed compare of isValidCharacter has always given them.
+ */
+static const unsigned short * const singleByteCharacterClasses[2][NUMBER_OF_LANGUAGES] = {
+	{asciiEnglishCharacterClasses, asciiSpanishCharacterClasses, asciiFrenchCharacterClasses},
+	{isoEnglishCharacterClasses, isoSpanishCharacterClasses, isoFrenchCharacterClasses}
+};
+
+/**
+ * The number of pages of 256 code points in the first stage of the unicode
+ * class trie. The trie covers the basic multilingual plane, and the code
+ * points past it have no classes in any language.
+ */
+#define UNICODE_CLASS_PAGES 256
+
+/**
+ * The number of blocks in the second stage of the unicode class trie
+ */
+#define UNICODE_CLASS_BLOCKS 1
+
+/**
+ * The first stage of the unicode class trie. Every page of 256 code points has
+ * the number of its block in unicodeClassBlocks, or 0 when none of its code
+ * points has a class.
+ */
+static const unsigned char unicodeClassPages[UNICODE_CLASS_PAGES] = {
+	1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 0000-0fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 1000-1fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 2000-2fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 3000-3fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 4000-4fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 5000-5fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 6000-6fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 7000-7fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 8000-8fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 9000-9fff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// a000-afff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// b000-bfff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// c000-cfff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// d000-dfff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// e000-efff
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0	// f000-ffff
+};
+
+/**
+ * The second stage of the unicode class trie, the blocks of each language.
+ * These are the classes of the utf8 and utf16 predicates, so they differ from
+ * the iso-8859-1 tables where the lists of the two have always differed.
+ * CHARACTER_CLASS_VALID is left to the decoders.
+ */
+static const unsigned short unicodeClassBlocks[NUMBER_OF_LANGUAGES][UNICODE_CLASS_BLOCKS][256] = {
+	{{	// English
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 00-0f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 10-1f
+		0x020,0x020,0x000,0x000,0x000,0x000,0x000,0x020,0x020,0x020,0x000,0x000,0x020,0x020,0x020,0x000,	// 20-2f
+		0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x020,0x020,0x000,0x000,0x000,0x020,	// 30-3f
+		0x000,0x113,0x113,0x113,0x113,0x113,0x113,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,	// 40-4f
+		0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x020,0x000,0x020,0x000,0x000,	// 50-5f
+		0x000,0x115,0x115,0x115,0x115,0x115,0x115,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,	// 60-6f
+		0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x020,0x000,0x020,0x000,0x000,	// 70-7f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 80-8f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 90-9f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// a0-af
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// b0-bf
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// c0-cf
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// d0-df
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// e0-ef
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000	// f0-ff
+	}},
+	{{	// Spanish
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 00-0f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 10-1f
+		0x000,0x020,0x020,0x000,0x000,0x000,0x000,0x020,0x020,0x020,0x000,0x000,0x020,0x020,0x020,0x000,	// 20-2f
+		0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x020,0x020,0x000,0x000,0x000,0x020,	// 30-3f
+		0x000,0x113,0x113,0x113,0x113,0x113,0x113,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,	// 40-4f
+		0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x020,0x000,0x020,0x000,0x000,	// 50-5f
+		0x000,0x115,0x115,0x115,0x115,0x115,0x115,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,	// 60-6f
+		0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x020,0x000,0x020,0x000,0x000,	// 70-7f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 80-8f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 90-9f
+		0x000,0x020,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x020,0x000,0x000,0x000,0x000,	// a0-af
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x020,0x000,0x000,0x000,0x020,	// b0-bf
+		0x000,0x043,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x043,0x000,0x000,0x000,0x043,0x000,0x000,	// c0-cf
+		0x000,0x043,0x000,0x043,0x000,0x000,0x000,0x000,0x000,0x000,0x043,0x000,0x000,0x000,0x000,0x000,	// d0-df
+		0x000,0x045,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x045,0x000,0x000,0x000,0x045,0x000,0x000,	// e0-ef
+		0x000,0x045,0x000,0x045,0x000,0x000,0x000,0x000,0x000,0x000,0x045,0x000,0x045,0x000,0x000,0x000	// f0-ff
+	}},
+	{{	// French
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 00-0f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 10-1f
+		0x000,0x020,0x020,0x000,0x000,0x000,0x000,0x020,0x020,0x020,0x000,0x000,0x020,0x020,0x020,0x000,	// 20-2f
+		0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x018,0x020,0x020,0x000,0x000,0x000,0x020,	// 30-3f
+		0x000,0x113,0x113,0x113,0x113,0x113,0x113,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,	// 40-4f
+		0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x103,0x020,0x000,0x020,0x000,0x000,	// 50-5f
+		0x000,0x115,0x115,0x115,0x115,0x115,0x115,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,	// 60-6f
+		0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x105,0x020,0x000,0x020,0x000,0x000,	// 70-7f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 80-8f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,	// 90-9f
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x020,0x000,0x000,0x000,0x000,	// a0-af
+		0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x000,0x020,0x000,0x000,0x000,0x000,	// b0-bf
+		0x043,0x000,0x043,0x000,0x000,0x000,0x000,0x043,0x043,0x043,0x043,0x043,0x000,0x000,0x043,0x043,	// c0-cf
+		0x000,0x000,0x000,0x000,0x043,0x000,0x000,0x000,0x000,0x043,0x000,0x043,0x043,0x000,0x000,0x000,	// d0-df
+		0x045,0x000,0x045,0x000,0x000,0x000,0x000,0x045,0x045,0x045,0x045,0x045,0x000,0x000,0x045,0x045,	// e0-ef
+		0x000,0x000,0x000,0x000,0x045,0x000,0x000,0x000,0x000,0x045,0x000,0x045,0x045,0x000,0x000,0x045	// f0-ff
+	}}
+};
+
+/**
+ * The index of the upper and lower case mappings in languageCaseMappings
+ */
+#define LANGUAGE_CASE_UPPER 0
+#define LANGUAGE_CASE_LOWER 1
+
+/**
+ * The number of encodings of languageCaseMappings: ascii, iso-8859-1, and the
+ * first 256 code points of utf8 and utf16
+ */
+#define LANGUAGE_CASE_ENCODINGS 3
+
+/**
+ * The character that each of the first 256 characters converts to, indexed by
+ * the encoding, the language and the case. A letter of the alphabet converts
+ * when its simple case mapping is a letter of the alphabet too, so no letter
+ * changes its utf8 length and the ascii letters are those of every language.
+ */
+static const unsigned char languageCaseMappings[LANGUAGE_CASE_ENCODINGS][NUMBER_OF_LANGUAGES][2][256] = {
+	{
+		{{	// ASCII English upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}},
+		{{	// ASCII Spanish upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}},
+		{{	// ASCII French upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}}
+	},
+	{
+		{{	// ISO_8859_1 English upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}},
+		{{	// ISO_8859_1 Spanish upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0c1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0c9,0x0ea,0x0eb,0x0ec,0x0cd,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0d1,0x0f2,0x0d3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0da,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0e1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0e9,0x0ca,0x0cb,0x0cc,0x0ed,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0f1,0x0d2,0x0f3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0fa,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}},
+		{{	// ISO_8859_1 French upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0c0,0x0e1,0x0c2,0x0e3,0x0e4,0x0e5,0x0e6,0x0c7,0x0c8,0x0c9,0x0ea,0x0cb,0x0cc,0x0ed,0x0ce,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0d4,0x0f5,0x0f6,0x0f7,0x0f8,0x0d9,0x0fa,0x0db,0x0dc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0e0,0x0c1,0x0e2,0x0c3,0x0c4,0x0c5,0x0c6,0x0e7,0x0e8,0x0e9,0x0ca,0x0eb,0x0ec,0x0cd,0x0ee,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0f4,0x0d5,0x0d6,0x0d7,0x0d8,0x0f9,0x0da,0x0fb,0x0fc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}}
+	},
+	{
+		{{	// UNICODE English upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}},
+		{{	// UNICODE Spanish upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0c1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0c9,0x0ea,0x0eb,0x0ec,0x0cd,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0d1,0x0f2,0x0d3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0da,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0e1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0e9,0x0ca,0x0cb,0x0cc,0x0ed,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0f1,0x0d2,0x0f3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0fa,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}},
+		{{	// UNICODE French upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0c0,0x0e1,0x0c2,0x0e3,0x0e4,0x0e5,0x0e6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0ec,0x0ed,0x0ce,0x0cf,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0d4,0x0f5,0x0f6,0x0f7,0x0f8,0x0d9,0x0fa,0x0db,0x0dc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0e0,0x0c1,0x0e2,0x0c3,0x0c4,0x0c5,0x0c6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0cc,0x0cd,0x0ee,0x0ef,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0f4,0x0d5,0x0d6,0x0d7,0x0d8,0x0f9,0x0da,0x0fb,0x0fc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}}
+	}
+};
+
+/**
+ * The number of cases of languageFoldings, indexed by the foldCases value
+ */
+#define LANGUAGE_FOLD_CASES 3
+
+/**
+ * The character that each of the first 256 characters folds to, indexed by the
+ * encoding and the language as languageCaseMappings and by the foldCases
+ * value. The extended letters of every language fold to their ascii base
+ * letter, which then takes the case of the alphabet of the language. The
+ * bytes past ascii have no letters in ascii.
+ */
+static const unsigned char languageFoldings[LANGUAGE_CASE_ENCODINGS][NUMBER_OF_LANGUAGES][LANGUAGE_FOLD_CASES][256] = {
+	{
+		{{	// ASCII English keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}},
+		{{	// ASCII Spanish keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}},
+		{{	// ASCII French keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x0c0,0x0c1,0x0c2,0x0c3,0x0c4,0x0c5,0x0c6,0x0c7,0x0c8,0x0c9,0x0ca,0x0cb,0x0cc,0x0cd,0x0ce,0x0cf,	// c0-cf
+			0x0d0,0x0d1,0x0d2,0x0d3,0x0d4,0x0d5,0x0d6,0x0d7,0x0d8,0x0d9,0x0da,0x0db,0x0dc,0x0dd,0x0de,0x0df,	// d0-df
+			0x0e0,0x0e1,0x0e2,0x0e3,0x0e4,0x0e5,0x0e6,0x0e7,0x0e8,0x0e9,0x0ea,0x0eb,0x0ec,0x0ed,0x0ee,0x0ef,	// e0-ef
+			0x0f0,0x0f1,0x0f2,0x0f3,0x0f4,0x0f5,0x0f6,0x0f7,0x0f8,0x0f9,0x0fa,0x0fb,0x0fc,0x0fd,0x0fe,0x0ff	// f0-ff
+		}}
+	},
+	{
+		{{	// ISO_8859_1 English keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x041,0x041,0x041,0x0e3,0x0e4,0x0e5,0x0e6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// e0-ef
+			0x0f0,0x04e,0x0f2,0x04f,0x04f,0x0f5,0x0f6,0x0f7,0x0f8,0x055,0x055,0x055,0x055,0x0fd,0x0fe,0x059	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x061,0x061,0x061,0x0c3,0x0c4,0x0c5,0x0c6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// c0-cf
+			0x0d0,0x06e,0x0d2,0x06f,0x06f,0x0d5,0x0d6,0x0d7,0x0d8,0x075,0x075,0x075,0x075,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		}},
+		{{	// ISO_8859_1 Spanish keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x041,0x041,0x041,0x0e3,0x0e4,0x0e5,0x0e6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// e0-ef
+			0x0f0,0x04e,0x0f2,0x04f,0x04f,0x0f5,0x0f6,0x0f7,0x0f8,0x055,0x055,0x055,0x055,0x0fd,0x0fe,0x059	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x061,0x061,0x061,0x0c3,0x0c4,0x0c5,0x0c6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// c0-cf
+			0x0d0,0x06e,0x0d2,0x06f,0x06f,0x0d5,0x0d6,0x0d7,0x0d8,0x075,0x075,0x075,0x075,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		}},
+		{{	// ISO_8859_1 French keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x041,0x041,0x041,0x0e3,0x0e4,0x0e5,0x0e6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// e0-ef
+			0x0f0,0x04e,0x0f2,0x04f,0x04f,0x0f5,0x0f6,0x0f7,0x0f8,0x055,0x055,0x055,0x055,0x0fd,0x0fe,0x059	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x061,0x061,0x061,0x0c3,0x0c4,0x0c5,0x0c6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// c0-cf
+			0x0d0,0x06e,0x0d2,0x06f,0x06f,0x0d5,0x0d6,0x0d7,0x0d8,0x075,0x075,0x075,0x075,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		}}
+	},
+	{
+		{{	// UNICODE English keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x041,0x041,0x041,0x0e3,0x0e4,0x0e5,0x0e6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// e0-ef
+			0x0f0,0x04e,0x0f2,0x04f,0x04f,0x0f5,0x0f6,0x0f7,0x0f8,0x055,0x055,0x055,0x055,0x0fd,0x0fe,0x059	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x061,0x061,0x061,0x0c3,0x0c4,0x0c5,0x0c6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// c0-cf
+			0x0d0,0x06e,0x0d2,0x06f,0x06f,0x0d5,0x0d6,0x0d7,0x0d8,0x075,0x075,0x075,0x075,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		}},
+		{{	// UNICODE Spanish keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x041,0x041,0x041,0x0e3,0x0e4,0x0e5,0x0e6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// e0-ef
+			0x0f0,0x04e,0x0f2,0x04f,0x04f,0x0f5,0x0f6,0x0f7,0x0f8,0x055,0x055,0x055,0x055,0x0fd,0x0fe,0x059	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x061,0x061,0x061,0x0c3,0x0c4,0x0c5,0x0c6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// c0-cf
+			0x0d0,0x06e,0x0d2,0x06f,0x06f,0x0d5,0x0d6,0x0d7,0x0d8,0x075,0x075,0x075,0x075,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		}},
+		{{	// UNICODE French keep case
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		},{	// upper
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 40-4f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x041,0x042,0x043,0x044,0x045,0x046,0x047,0x048,0x049,0x04a,0x04b,0x04c,0x04d,0x04e,0x04f,	// 60-6f
+			0x050,0x051,0x052,0x053,0x054,0x055,0x056,0x057,0x058,0x059,0x05a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x041,0x041,0x041,0x0c3,0x0c4,0x0c5,0x0c6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// c0-cf
+			0x0d0,0x04e,0x0d2,0x04f,0x04f,0x0d5,0x0d6,0x0d7,0x0d8,0x055,0x055,0x055,0x055,0x0dd,0x0de,0x0df,	// d0-df
+			0x041,0x041,0x041,0x0e3,0x0e4,0x0e5,0x0e6,0x043,0x045,0x045,0x045,0x045,0x049,0x049,0x049,0x049,	// e0-ef
+			0x0f0,0x04e,0x0f2,0x04f,0x04f,0x0f5,0x0f6,0x0f7,0x0f8,0x055,0x055,0x055,0x055,0x0fd,0x0fe,0x059	// f0-ff
+		},{	// lower
+			0x000,0x001,0x002,0x003,0x004,0x005,0x006,0x007,0x008,0x009,0x00a,0x00b,0x00c,0x00d,0x00e,0x00f,	// 00-0f
+			0x010,0x011,0x012,0x013,0x014,0x015,0x016,0x017,0x018,0x019,0x01a,0x01b,0x01c,0x01d,0x01e,0x01f,	// 10-1f
+			0x020,0x021,0x022,0x023,0x024,0x025,0x026,0x027,0x028,0x029,0x02a,0x02b,0x02c,0x02d,0x02e,0x02f,	// 20-2f
+			0x030,0x031,0x032,0x033,0x034,0x035,0x036,0x037,0x038,0x039,0x03a,0x03b,0x03c,0x03d,0x03e,0x03f,	// 30-3f
+			0x040,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 40-4f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x05b,0x05c,0x05d,0x05e,0x05f,	// 50-5f
+			0x060,0x061,0x062,0x063,0x064,0x065,0x066,0x067,0x068,0x069,0x06a,0x06b,0x06c,0x06d,0x06e,0x06f,	// 60-6f
+			0x070,0x071,0x072,0x073,0x074,0x075,0x076,0x077,0x078,0x079,0x07a,0x07b,0x07c,0x07d,0x07e,0x07f,	// 70-7f
+			0x080,0x081,0x082,0x083,0x084,0x085,0x086,0x087,0x088,0x089,0x08a,0x08b,0x08c,0x08d,0x08e,0x08f,	// 80-8f
+			0x090,0x091,0x092,0x093,0x094,0x095,0x096,0x097,0x098,0x099,0x09a,0x09b,0x09c,0x09d,0x09e,0x09f,	// 90-9f
+			0x0a0,0x0a1,0x0a2,0x0a3,0x0a4,0x0a5,0x0a6,0x0a7,0x0a8,0x0a9,0x0aa,0x0ab,0x0ac,0x0ad,0x0ae,0x0af,	// a0-af
+			0x0b0,0x0b1,0x0b2,0x0b3,0x0b4,0x0b5,0x0b6,0x0b7,0x0b8,0x0b9,0x0ba,0x0bb,0x0bc,0x0bd,0x0be,0x0bf,	// b0-bf
+			0x061,0x061,0x061,0x0c3,0x0c4,0x0c5,0x0c6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// c0-cf
+			0x0d0,0x06e,0x0d2,0x06f,0x06f,0x0d5,0x0d6,0x0d7,0x0d8,0x075,0x075,0x075,0x075,0x0dd,0x0de,0x0df,	// d0-df
+			0x061,0x061,0x061,0x0e3,0x0e4,0x0e5,0x0e6,0x063,0x065,0x065,0x065,0x065,0x069,0x069,0x069,0x069,	// e0-ef
+			0x0f0,0x06e,0x0f2,0x06f,0x06f,0x0f5,0x0f6,0x0f7,0x0f8,0x075,0x075,0x075,0x075,0x0fd,0x0fe,0x079	// f0-ff
+		}}
+	}
+};
+
+/**
+ * The number of letters of the language bigrams, the word boundary and a-z
+ */
+#define LANGUAGE_BIGRAM_LETTERS 27
+
+/**
+ * The languages of the bigrams of letters, a bit per language. A bigram is
+ * indexed by the letter before times LANGUAGE_BIGRAM_LETTERS and the letter,
+ * where 0 is a word boundary and 1-26 are a-z in either case.
+ */
+static const unsigned int languageBigrams[LANGUAGE_BIGRAM_LETTERS * LANGUAGE_BIGRAM_LETTERS] = {
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x2,0x0,	// _
+	0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x1,0x0,0x1,0x0,	// a
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// b
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// c
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// d
+	0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x1,0x0,0x1,0x4,	// e
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// f
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// g
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// h
+	0x0,0x2,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// i
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// j
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// k
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// l
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// m
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x0,	// n
+	0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x2,0x0,0x4,0x0,0x1,0x0,0x0,0x0,	// o
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// p
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// q
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// r
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// s
+	0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// t
+	0x0,0x0,0x0,0x0,0x0,0x2,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x4,0x0,0x0,	// u
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// v
+	0x0,0x1,0x0,0x0,0x0,0x1,0x0,0x0,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// w
+	0x4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// x
+	0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// y
+	0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0	// z
+};
+
+#endif
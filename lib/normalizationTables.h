@@ -0,0 +1,1137 @@
+//Copyright 2014 by Daniel Ortiz
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+// Generated by generateNormalizationTables.py from Unicode 14.0.0. Do not edit.
+
+#ifndef __LANGUAGE_NORMALIZATIONTABLES_H__
+#define __LANGUAGE_NORMALIZATIONTABLES_H__
+
+/**
+ * The bits of an entry of the normalization property table: the canonical
+ * combining class, and the quick check values that are not yes
+ */
+#define NORMALIZATION_COMBINING_CLASS_MASK 0xff
+#define NORMALIZATION_NFC_MAYBE 0x100
+#define NORMALIZATION_NFC_NO 0x200
+#define NORMALIZATION_NFD_NO 0x400
+
+/**
+ * The code points below these are starters that are already in NFC and NFD
+ */
+#define NORMALIZATION_NFC_QUICK_CHECK_LIMIT 0x300
+#define NORMALIZATION_NFD_QUICK_CHECK_LIMIT 0xc0
+
+/**
+ * The code points of the two stage property table. The planes past it have
+ * no decompositions and no combining marks.
+ */
+#define NORMALIZATION_CODE_POINTS 0x30000
+
+/**
+ * The number of code points in a block of the property table
+ */
+#define NORMALIZATION_BLOCK_SIZE 64
+
+/**
+ * The number of blocks of the property table
+ */
+#define NORMALIZATION_BLOCKS 163
+
+/**
+ * The number of code points with a canonical decomposition, hangul aside
+ */
+#define NORMALIZATION_DECOMPOSITIONS 2061
+
+/**
+ * The number of code points in the longest full decomposition
+ */
+#define NORMALIZATION_MAX_DECOMPOSITION 4
+
+/**
+ * The number of primary composites, hangul aside
+ */
+#define NORMALIZATION_COMPOSITIONS 941
+
+/**
+ * The first stage of the property table, the block of every 64 code points
+ */
+static const unsigned char normalizationPages[NORMALIZATION_CODE_POINTS / NORMALIZATION_BLOCK_SIZE] = {
+	0,0,0,1,2,3,4,5,6,0,0,0,7,8,9,10,11,12,13,14,0,0,15,16,17,18,0,19,20,21,0,22,
+	23,24,25,26,27,28,29,30,31,32,33,34,29,35,36,37,33,38,33,39,40,37,0,41,42,43,44,45,46,47,48,49,
+	50,0,51,0,0,52,53,54,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,57,
+	0,0,58,0,59,0,0,0,60,61,62,63,64,65,66,67,68,0,0,69,0,0,0,70,71,71,72,73,74,75,76,77,
+	78,0,0,79,80,0,81,82,83,84,85,86,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,89,0,90,0,91,0,0,0,0,0,0,0,0,
+	92,93,94,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,97,98,0,0,0,0,
+	99,0,0,100,101,102,103,104,0,0,105,106,0,0,0,107,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+	71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+	71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+	71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+	71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,
+	71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,71,108,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,109,109,109,109,110,111,109,112,113,114,0,0,0,0,0,0,0,0,0,0,115,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,116,0,0,0,117,0,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,119,0,0,120,0,0,0,0,0,0,0,0,121,0,0,0,0,0,122,0,0,123,124,0,
+	0,125,126,0,127,103,0,128,129,0,0,130,131,132,0,0,0,133,134,135,0,0,136,137,90,0,138,0,139,0,0,0,
+	140,0,0,0,141,142,0,143,144,145,146,0,0,0,0,0,90,0,0,0,0,147,148,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,149,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,151,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,153,154,155,0,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	157,0,0,0,150,0,0,0,0,0,158,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,160,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+	109,109,109,109,109,109,109,109,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0
+};
+
+/**
+ * The second stage of the property table, the entries of the code points of
+ * each block
+ */
+static const unsigned short normalizationBlocks[NORMALIZATION_BLOCKS][NORMALIZATION_BLOCK_SIZE] = {
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 0
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x0,0x0,	// 1
+		0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x0,0x400},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,	// 2
+		0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x0},
+	{0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,	// 3
+		0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 4
+		0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x400,0x400,	// 5
+		0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,	// 6
+		0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0xe6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0x1e6,0xe6,0xe6,0x1e6,0xe6,0x1e6,0xe6,0x1e6,0x1e6,0xe8,0xdc,0xdc,0xdc,0xdc,0xe8,0x1d8,0xdc,0xdc,0xdc,0xdc,	// 7
+		0xdc,0xca,0xca,0x1dc,0x1dc,0x1dc,0x1dc,0x1ca,0x1ca,0xdc,0xdc,0xdc,0xdc,0x1dc,0x1dc,0xdc,0x1dc,0x1dc,0xdc,0xdc,0x1,0x1,0x1,0x1,0x101,0xdc,0xdc,0xdc,0xdc,0xe6,0xe6,0xe6},
+	{0x6e6,0x6e6,0x1e6,0x6e6,0x6e6,0x1f0,0xe6,0xdc,0xdc,0xdc,0xe6,0xe6,0xe6,0xdc,0xdc,0x0,0xe6,0xe6,0xe6,0xdc,0xdc,0xdc,0xdc,0xe6,0xe8,0xdc,0xdc,0xe6,0xe9,0xea,0xea,0xe9,	// 8
+		0xea,0xea,0xe9,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x600,0x400,0x400,0x400,0x0,0x400,0x0,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 9
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 10
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x400,0x400,0x0,0x400,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,	// 11
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x400,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x0,	// 12
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 13
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,	// 14
+		0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0xe6,0xe6,0xe6,0xe6,0xdc,0xe6,0xe6,0xe6,0xde,0xdc,0xe6,0xe6,0xe6,0xe6,	// 15
+		0xe6,0xe6,0xdc,0xdc,0xdc,0xdc,0xdc,0xdc,0xe6,0xe6,0xdc,0xe6,0xe6,0xde,0xe4,0xe6,0xa,0xb,0xc,0xd,0xe,0xf,0x10,0x11,0x12,0x13,0x13,0x14,0x15,0x16,0x0,0x17},
+	{0x0,0x18,0x19,0x0,0xe6,0xdc,0x0,0x12,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 16
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x1e,0x1f,0x20,0x0,0x0,0x0,0x0,0x0,	// 17
+		0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1b,0x1c,0x1d,0x1e,0x1f,0x20,0x21,0x22,0x1e6,0x1e6,0x1dc,0xdc,0xe6,0xe6,0xe6,0xe6,0xe6,0xdc,0xe6,0xe6,0xdc,	// 18
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x23,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x400,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0xe6,	// 19
+		0xe6,0xe6,0xe6,0xdc,0xe6,0x0,0x0,0xe6,0xe6,0x0,0xdc,0xe6,0xe6,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x24,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 20
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xdc,0xe6,0xe6,0xdc,0xe6,0xe6,0xdc,0xdc,0xdc,0xe6,0xdc,0xdc,0xe6,0xdc,0xe6},
+	{0xe6,0xe6,0xdc,0xe6,0xdc,0xe6,0xdc,0xe6,0xdc,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 21
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 22
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xdc,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,	// 23
+		0xe6,0xe6,0xe6,0xe6,0x0,0xe6,0xe6,0xe6,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0xdc,0xdc,0x0,0x0,0x0,0x0,	// 24
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xdc,0xdc,0xdc,0xe6,0xe6,0xe6,0xe6,	// 25
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xdc,0xdc,0xdc,0xdc,0xdc,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,	// 26
+		0xe6,0xe6,0x0,0xdc,0xe6,0xe6,0xdc,0xe6,0xe6,0xdc,0xe6,0xe6,0xe6,0xdc,0xdc,0xdc,0x1b,0x1c,0x1d,0xe6,0xe6,0xe6,0xdc,0xe6,0xe6,0xdc,0xdc,0xe6,0xe6,0xe6,0xe6,0xe6},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 27
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x107,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0xe6,0xdc,0xe6,0xe6,0x0,0x0,0x0,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,	// 28
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 29
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x100,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x600,0x600,0x0,0x600,	// 30
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 31
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x600,0x600,0x0,0x0,0x600,0x0,	// 32
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 33
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 34
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x400,0x400,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x100,0x0,0x0,0x0,0x0,0x600,0x600,0x0,0x0,	// 35
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 36
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 37
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x54,0x15b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 38
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x400,0x0,0x100,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 39
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 40
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x9,0x0,0x100,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x109,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x400,0x400,0x400,0x100,	// 41
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 42
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x67,0x67,0x9,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6b,0x6b,0x6b,0x6b,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 43
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 44
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x76,0x76,0x9,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7a,0x7a,0x7a,0x7a,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 45
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,	// 46
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0x0,0xdc,0x0,0xd8,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,	// 47
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x81,0x82,0x600,0x84,0x600,0x600,0x0,0x600,0x0,0x82,0x82,0x82,0x82,0x0,0x0},
+	{0x82,0x600,0xe6,0xe6,0x9,0x0,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0,0x0,	// 48
+		0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 49
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 50
+		0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x9,0x9,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 51
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 52
+		0x0,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 53
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100,0x100},
+	{0x100,0x100,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 54
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,	// 55
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 56
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0x0,0x0,	// 57
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 58
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe4,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 59
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xde,0xe6,0xdc,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 60
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 61
+		0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0xdc},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 62
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xdc,0xdc,0xdc,0xdc,0xdc,0xdc,0xe6,0xe6,0xdc,0x0,0xdc},
+	{0xdc,0xe6,0xe6,0xdc,0xdc,0xe6,0xe6,0xe6,0xe6,0xe6,0xdc,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 63
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 64
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x100,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x400,0x0,0x0},
+	{0x400,0x400,0x0,0x400,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 65
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xdc,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 66
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 67
+		0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 68
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0x0,0x1,0xdc,0xdc,0xdc,0xdc,0xdc,0xe6,0xe6,0xdc,0xdc,0xdc,0xdc,	// 69
+		0xe6,0x0,0x1,0x1,0x1,0x1,0x1,0x1,0x1,0x0,0x0,0x0,0x0,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0x0,0x0,0x0,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0xe6,0xe6,0xdc,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xdc,0xe6,0xe6,0xea,0xd6,0xdc,0xca,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,	// 70
+		0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe8,0xe4,0xe4,0xdc,0xda,0xe6,0xe9,0xdc,0xe6,0xdc},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,	// 71
+		0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x400,0x0,0x0,0x0,0x0,	// 72
+		0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,	// 73
+		0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,	// 74
+		0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,	// 75
+		0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x600,0x400,0x600,0x400,0x600,0x400,0x600,0x400,0x600,0x400,0x600,0x400,0x600,0x0,0x0},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,	// 76
+		0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x0,0x400,0x400,0x400,0x400,0x400,0x600,0x400,0x0,0x600,0x0},
+	{0x0,0x400,0x400,0x400,0x400,0x0,0x400,0x400,0x400,0x600,0x400,0x600,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x600,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x600,0x0,0x400,0x400,0x400,	// 77
+		0x400,0x400,0x400,0x600,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x600,0x400,0x400,0x600,0x600,0x0,0x0,0x400,0x400,0x400,0x0,0x400,0x400,0x400,0x600,0x400,0x600,0x400,0x600,0x0,0x0},
+	{0x600,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 78
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0x1,0x1,0xe6,0xe6,0xe6,0xe6,0x1,0x1,0x1,0xe6,0xe6,0x0,0x0,0x0,	// 79
+		0x0,0xe6,0x0,0x0,0x0,0x1,0x1,0xe6,0xdc,0xe6,0x1,0x1,0xdc,0xdc,0xdc,0xdc,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 80
+		0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,0x600,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x0,	// 81
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 82
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 83
+		0x0,0x0,0x0,0x0,0x400,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x400,0x0,0x0,0x400,0x0,0x0,0x400,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 84
+		0x400,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x400,0x0,0x0,0x400,0x400,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x400,0x400,0x0,0x0,0x400,0x400,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 85
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 86
+		0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 87
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x0,0x0,0x0,	// 88
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 89
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 90
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 91
+		0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 92
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xda,0xe4,0xe8,0xde,0xe0,0xe0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,	// 93
+		0x400,0x0,0x400,0x0,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x108,0x108,0x0,0x0,0x0,0x400,0x0,	// 94
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x400,0x0},
+	{0x400,0x0,0x400,0x0,0x0,0x400,0x0,0x400,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x400,0x400,0x0,0x0,	// 95
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x400,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 96
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,	// 97
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 98
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 99
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 100
+		0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 101
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0xdc,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 102
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 103
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 104
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 105
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0x0,0xe6,0xe6,0xdc,0x0,0x0,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6},
+	{0x0,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 106
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 107
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,0x400,	// 108
+		0x400,0x400,0x400,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,	// 109
+		0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600},
+	{0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x0,0x0,0x600,0x0,0x600,0x0,0x0,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x0,	// 110
+		0x600,0x0,0x600,0x0,0x0,0x600,0x600,0x0,0x0,0x0,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600},
+	{0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,	// 111
+		0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x0,0x0,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600},
+	{0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x0,0x0,0x0,0x0,0x0,0x0,	// 112
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x1a,0x600,	// 113
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x0,0x600,0x600,0x600,0x600,0x600,0x0,0x600,0x0},
+	{0x600,0x600,0x0,0x600,0x600,0x0,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 114
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 115
+		0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xdc,0xdc,0xdc,0xdc,0xdc,0xdc,0xdc,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 116
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 117
+		0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 118
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0x0,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 119
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0x1,0xdc,0x0,0x0,0x0,0x0,0x9},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 120
+		0x0,0x0,0x0,0x0,0x0,0xe6,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 121
+		0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 122
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0xdc,0xe6,0xe6,0xe6,0xdc,0xe6,0xdc,0xdc,0xdc,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 123
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0xe6,0xdc,0xe6,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 124
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 125
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x400,0x0,0x0,0x0,	// 126
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x107,0x0,0x0,0x0,0x0,0x0},
+	{0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 127
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x9,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 128
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 129
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 130
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 131
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x7,0x7,0x0,0x100,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 132
+		0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x9,0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0x0,	// 133
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 134
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x400,0x400,0x100,0x400,0x0},
+	{0x0,0x0,0x9,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 135
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 136
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x400,0x0,0x0,0x0,0x9},
+	{0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 137
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 138
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 139
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 140
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x7,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 141
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x100,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x400,0x0,0x0,0x0,0x0,0x9,0x9,0x0},
+	{0x0,0x0,0x0,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 142
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 143
+		0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 144
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 145
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,	// 146
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x7,0x0,0x9,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 147
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x9,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 148
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 149
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x1,0x1,0x1,0x1,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 150
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 151
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x6,0x6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x1,0x0,	// 152
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x600,	// 153
+		0x600,0x600,0x600,0x600,0x600,0xd8,0xd8,0x1,0x1,0x1,0x0,0x0,0x0,0xe2,0xd8,0xd8,0xd8,0xd8,0xd8,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0xdc,0xdc,0xdc,0xdc},
+	{0xdc,0xdc,0xdc,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xdc,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 154
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x600,0x600,0x600,0x600,0x600},
+	{0x600,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 155
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 156
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,	// 157
+		0xe6,0xe6,0x0,0xe6,0xe6,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 158
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 159
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0xdc,0xdc,0xdc,0xdc,0xdc,0xdc,0xdc,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 160
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x0,0x0,0x0,0x0,0xe6,0xe6,0xe6,0xe6,0xe6,0xe6,0x7,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,	// 161
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0},
+	{0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x600,0x0,0x0,	// 162
+		0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0,0x0}
+};
+
+/**
+ * The sorted code points that have a canonical decomposition
+ */
+static const unsigned int normalizationDecomposed[NORMALIZATION_DECOMPOSITIONS] = {
+	0xc0,0xc1,0xc2,0xc3,0xc4,0xc5,0xc7,0xc8,0xc9,0xca,0xcb,0xcc,0xcd,0xce,0xcf,0xd1,
+	0xd2,0xd3,0xd4,0xd5,0xd6,0xd9,0xda,0xdb,0xdc,0xdd,0xe0,0xe1,0xe2,0xe3,0xe4,0xe5,
+	0xe7,0xe8,0xe9,0xea,0xeb,0xec,0xed,0xee,0xef,0xf1,0xf2,0xf3,0xf4,0xf5,0xf6,0xf9,
+	0xfa,0xfb,0xfc,0xfd,0xff,0x100,0x101,0x102,0x103,0x104,0x105,0x106,0x107,0x108,0x109,0x10a,
+	0x10b,0x10c,0x10d,0x10e,0x10f,0x112,0x113,0x114,0x115,0x116,0x117,0x118,0x119,0x11a,0x11b,0x11c,
+	0x11d,0x11e,0x11f,0x120,0x121,0x122,0x123,0x124,0x125,0x128,0x129,0x12a,0x12b,0x12c,0x12d,0x12e,
+	0x12f,0x130,0x134,0x135,0x136,0x137,0x139,0x13a,0x13b,0x13c,0x13d,0x13e,0x143,0x144,0x145,0x146,
+	0x147,0x148,0x14c,0x14d,0x14e,0x14f,0x150,0x151,0x154,0x155,0x156,0x157,0x158,0x159,0x15a,0x15b,
+	0x15c,0x15d,0x15e,0x15f,0x160,0x161,0x162,0x163,0x164,0x165,0x168,0x169,0x16a,0x16b,0x16c,0x16d,
+	0x16e,0x16f,0x170,0x171,0x172,0x173,0x174,0x175,0x176,0x177,0x178,0x179,0x17a,0x17b,0x17c,0x17d,
+	0x17e,0x1a0,0x1a1,0x1af,0x1b0,0x1cd,0x1ce,0x1cf,0x1d0,0x1d1,0x1d2,0x1d3,0x1d4,0x1d5,0x1d6,0x1d7,
+	0x1d8,0x1d9,0x1da,0x1db,0x1dc,0x1de,0x1df,0x1e0,0x1e1,0x1e2,0x1e3,0x1e6,0x1e7,0x1e8,0x1e9,0x1ea,
+	0x1eb,0x1ec,0x1ed,0x1ee,0x1ef,0x1f0,0x1f4,0x1f5,0x1f8,0x1f9,0x1fa,0x1fb,0x1fc,0x1fd,0x1fe,0x1ff,
+	0x200,0x201,0x202,0x203,0x204,0x205,0x206,0x207,0x208,0x209,0x20a,0x20b,0x20c,0x20d,0x20e,0x20f,
+	0x210,0x211,0x212,0x213,0x214,0x215,0x216,0x217,0x218,0x219,0x21a,0x21b,0x21e,0x21f,0x226,0x227,
+	0x228,0x229,0x22a,0x22b,0x22c,0x22d,0x22e,0x22f,0x230,0x231,0x232,0x233,0x340,0x341,0x343,0x344,
+	0x374,0x37e,0x385,0x386,0x387,0x388,0x389,0x38a,0x38c,0x38e,0x38f,0x390,0x3aa,0x3ab,0x3ac,0x3ad,
+	0x3ae,0x3af,0x3b0,0x3ca,0x3cb,0x3cc,0x3cd,0x3ce,0x3d3,0x3d4,0x400,0x401,0x403,0x407,0x40c,0x40d,
+	0x40e,0x419,0x439,0x450,0x451,0x453,0x457,0x45c,0x45d,0x45e,0x476,0x477,0x4c1,0x4c2,0x4d0,0x4d1,
+	0x4d2,0x4d3,0x4d6,0x4d7,0x4da,0x4db,0x4dc,0x4dd,0x4de,0x4df,0x4e2,0x4e3,0x4e4,0x4e5,0x4e6,0x4e7,
+	0x4ea,0x4eb,0x4ec,0x4ed,0x4ee,0x4ef,0x4f0,0x4f1,0x4f2,0x4f3,0x4f4,0x4f5,0x4f8,0x4f9,0x622,0x623,
+	0x624,0x625,0x626,0x6c0,0x6c2,0x6d3,0x929,0x931,0x934,0x958,0x959,0x95a,0x95b,0x95c,0x95d,0x95e,
+	0x95f,0x9cb,0x9cc,0x9dc,0x9dd,0x9df,0xa33,0xa36,0xa59,0xa5a,0xa5b,0xa5e,0xb48,0xb4b,0xb4c,0xb5c,
+	0xb5d,0xb94,0xbca,0xbcb,0xbcc,0xc48,0xcc0,0xcc7,0xcc8,0xcca,0xccb,0xd4a,0xd4b,0xd4c,0xdda,0xddc,
+	0xddd,0xdde,0xf43,0xf4d,0xf52,0xf57,0xf5c,0xf69,0xf73,0xf75,0xf76,0xf78,0xf81,0xf93,0xf9d,0xfa2,
+	0xfa7,0xfac,0xfb9,0x1026,0x1b06,0x1b08,0x1b0a,0x1b0c,0x1b0e,0x1b12,0x1b3b,0x1b3d,0x1b40,0x1b41,0x1b43,0x1e00,
+	0x1e01,0x1e02,0x1e03,0x1e04,0x1e05,0x1e06,0x1e07,0x1e08,0x1e09,0x1e0a,0x1e0b,0x1e0c,0x1e0d,0x1e0e,0x1e0f,0x1e10,
+	0x1e11,0x1e12,0x1e13,0x1e14,0x1e15,0x1e16,0x1e17,0x1e18,0x1e19,0x1e1a,0x1e1b,0x1e1c,0x1e1d,0x1e1e,0x1e1f,0x1e20,
+	0x1e21,0x1e22,0x1e23,0x1e24,0x1e25,0x1e26,0x1e27,0x1e28,0x1e29,0x1e2a,0x1e2b,0x1e2c,0x1e2d,0x1e2e,0x1e2f,0x1e30,
+	0x1e31,0x1e32,0x1e33,0x1e34,0x1e35,0x1e36,0x1e37,0x1e38,0x1e39,0x1e3a,0x1e3b,0x1e3c,0x1e3d,0x1e3e,0x1e3f,0x1e40,
+	0x1e41,0x1e42,0x1e43,0x1e44,0x1e45,0x1e46,0x1e47,0x1e48,0x1e49,0x1e4a,0x1e4b,0x1e4c,0x1e4d,0x1e4e,0x1e4f,0x1e50,
+	0x1e51,0x1e52,0x1e53,0x1e54,0x1e55,0x1e56,0x1e57,0x1e58,0x1e59,0x1e5a,0x1e5b,0x1e5c,0x1e5d,0x1e5e,0x1e5f,0x1e60,
+	0x1e61,0x1e62,0x1e63,0x1e64,0x1e65,0x1e66,0x1e67,0x1e68,0x1e69,0x1e6a,0x1e6b,0x1e6c,0x1e6d,0x1e6e,0x1e6f,0x1e70,
+	0x1e71,0x1e72,0x1e73,0x1e74,0x1e75,0x1e76,0x1e77,0x1e78,0x1e79,0x1e7a,0x1e7b,0x1e7c,0x1e7d,0x1e7e,0x1e7f,0x1e80,
+	0x1e81,0x1e82,0x1e83,0x1e84,0x1e85,0x1e86,0x1e87,0x1e88,0x1e89,0x1e8a,0x1e8b,0x1e8c,0x1e8d,0x1e8e,0x1e8f,0x1e90,
+	0x1e91,0x1e92,0x1e93,0x1e94,0x1e95,0x1e96,0x1e97,0x1e98,0x1e99,0x1e9b,0x1ea0,0x1ea1,0x1ea2,0x1ea3,0x1ea4,0x1ea5,
+	0x1ea6,0x1ea7,0x1ea8,0x1ea9,0x1eaa,0x1eab,0x1eac,0x1ead,0x1eae,0x1eaf,0x1eb0,0x1eb1,0x1eb2,0x1eb3,0x1eb4,0x1eb5,
+	0x1eb6,0x1eb7,0x1eb8,0x1eb9,0x1eba,0x1ebb,0x1ebc,0x1ebd,0x1ebe,0x1ebf,0x1ec0,0x1ec1,0x1ec2,0x1ec3,0x1ec4,0x1ec5,
+	0x1ec6,0x1ec7,0x1ec8,0x1ec9,0x1eca,0x1ecb,0x1ecc,0x1ecd,0x1ece,0x1ecf,0x1ed0,0x1ed1,0x1ed2,0x1ed3,0x1ed4,0x1ed5,
+	0x1ed6,0x1ed7,0x1ed8,0x1ed9,0x1eda,0x1edb,0x1edc,0x1edd,0x1ede,0x1edf,0x1ee0,0x1ee1,0x1ee2,0x1ee3,0x1ee4,0x1ee5,
+	0x1ee6,0x1ee7,0x1ee8,0x1ee9,0x1eea,0x1eeb,0x1eec,0x1eed,0x1eee,0x1eef,0x1ef0,0x1ef1,0x1ef2,0x1ef3,0x1ef4,0x1ef5,
+	0x1ef6,0x1ef7,0x1ef8,0x1ef9,0x1f00,0x1f01,0x1f02,0x1f03,0x1f04,0x1f05,0x1f06,0x1f07,0x1f08,0x1f09,0x1f0a,0x1f0b,
+	0x1f0c,0x1f0d,0x1f0e,0x1f0f,0x1f10,0x1f11,0x1f12,0x1f13,0x1f14,0x1f15,0x1f18,0x1f19,0x1f1a,0x1f1b,0x1f1c,0x1f1d,
+	0x1f20,0x1f21,0x1f22,0x1f23,0x1f24,0x1f25,0x1f26,0x1f27,0x1f28,0x1f29,0x1f2a,0x1f2b,0x1f2c,0x1f2d,0x1f2e,0x1f2f,
+	0x1f30,0x1f31,0x1f32,0x1f33,0x1f34,0x1f35,0x1f36,0x1f37,0x1f38,0x1f39,0x1f3a,0x1f3b,0x1f3c,0x1f3d,0x1f3e,0x1f3f,
+	0x1f40,0x1f41,0x1f42,0x1f43,0x1f44,0x1f45,0x1f48,0x1f49,0x1f4a,0x1f4b,0x1f4c,0x1f4d,0x1f50,0x1f51,0x1f52,0x1f53,
+	0x1f54,0x1f55,0x1f56,0x1f57,0x1f59,0x1f5b,0x1f5d,0x1f5f,0x1f60,0x1f61,0x1f62,0x1f63,0x1f64,0x1f65,0x1f66,0x1f67,
+	0x1f68,0x1f69,0x1f6a,0x1f6b,0x1f6c,0x1f6d,0x1f6e,0x1f6f,0x1f70,0x1f71,0x1f72,0x1f73,0x1f74,0x1f75,0x1f76,0x1f77,
+	0x1f78,0x1f79,0x1f7a,0x1f7b,0x1f7c,0x1f7d,0x1f80,0x1f81,0x1f82,0x1f83,0x1f84,0x1f85,0x1f86,0x1f87,0x1f88,0x1f89,
+	0x1f8a,0x1f8b,0x1f8c,0x1f8d,0x1f8e,0x1f8f,0x1f90,0x1f91,0x1f92,0x1f93,0x1f94,0x1f95,0x1f96,0x1f97,0x1f98,0x1f99,
+	0x1f9a,0x1f9b,0x1f9c,0x1f9d,0x1f9e,0x1f9f,0x1fa0,0x1fa1,0x1fa2,0x1fa3,0x1fa4,0x1fa5,0x1fa6,0x1fa7,0x1fa8,0x1fa9,
+	0x1faa,0x1fab,0x1fac,0x1fad,0x1fae,0x1faf,0x1fb0,0x1fb1,0x1fb2,0x1fb3,0x1fb4,0x1fb6,0x1fb7,0x1fb8,0x1fb9,0x1fba,
+	0x1fbb,0x1fbc,0x1fbe,0x1fc1,0x1fc2,0x1fc3,0x1fc4,0x1fc6,0x1fc7,0x1fc8,0x1fc9,0x1fca,0x1fcb,0x1fcc,0x1fcd,0x1fce,
+	0x1fcf,0x1fd0,0x1fd1,0x1fd2,0x1fd3,0x1fd6,0x1fd7,0x1fd8,0x1fd9,0x1fda,0x1fdb,0x1fdd,0x1fde,0x1fdf,0x1fe0,0x1fe1,
+	0x1fe2,0x1fe3,0x1fe4,0x1fe5,0x1fe6,0x1fe7,0x1fe8,0x1fe9,0x1fea,0x1feb,0x1fec,0x1fed,0x1fee,0x1fef,0x1ff2,0x1ff3,
+	0x1ff4,0x1ff6,0x1ff7,0x1ff8,0x1ff9,0x1ffa,0x1ffb,0x1ffc,0x1ffd,0x2000,0x2001,0x2126,0x212a,0x212b,0x219a,0x219b,
+	0x21ae,0x21cd,0x21ce,0x21cf,0x2204,0x2209,0x220c,0x2224,0x2226,0x2241,0x2244,0x2247,0x2249,0x2260,0x2262,0x226d,
+	0x226e,0x226f,0x2270,0x2271,0x2274,0x2275,0x2278,0x2279,0x2280,0x2281,0x2284,0x2285,0x2288,0x2289,0x22ac,0x22ad,
+	0x22ae,0x22af,0x22e0,0x22e1,0x22e2,0x22e3,0x22ea,0x22eb,0x22ec,0x22ed,0x2329,0x232a,0x2adc,0x304c,0x304e,0x3050,
+	0x3052,0x3054,0x3056,0x3058,0x305a,0x305c,0x305e,0x3060,0x3062,0x3065,0x3067,0x3069,0x3070,0x3071,0x3073,0x3074,
+	0x3076,0x3077,0x3079,0x307a,0x307c,0x307d,0x3094,0x309e,0x30ac,0x30ae,0x30b0,0x30b2,0x30b4,0x30b6,0x30b8,0x30ba,
+	0x30bc,0x30be,0x30c0,0x30c2,0x30c5,0x30c7,0x30c9,0x30d0,0x30d1,0x30d3,0x30d4,0x30d6,0x30d7,0x30d9,0x30da,0x30dc,
+	0x30dd,0x30f4,0x30f7,0x30f8,0x30f9,0x30fa,0x30fe,0xf900,0xf901,0xf902,0xf903,0xf904,0xf905,0xf906,0xf907,0xf908,
+	0xf909,0xf90a,0xf90b,0xf90c,0xf90d,0xf90e,0xf90f,0xf910,0xf911,0xf912,0xf913,0xf914,0xf915,0xf916,0xf917,0xf918,
+	0xf919,0xf91a,0xf91b,0xf91c,0xf91d,0xf91e,0xf91f,0xf920,0xf921,0xf922,0xf923,0xf924,0xf925,0xf926,0xf927,0xf928,
+	0xf929,0xf92a,0xf92b,0xf92c,0xf92d,0xf92e,0xf92f,0xf930,0xf931,0xf932,0xf933,0xf934,0xf935,0xf936,0xf937,0xf938,
+	0xf939,0xf93a,0xf93b,0xf93c,0xf93d,0xf93e,0xf93f,0xf940,0xf941,0xf942,0xf943,0xf944,0xf945,0xf946,0xf947,0xf948,
+	0xf949,0xf94a,0xf94b,0xf94c,0xf94d,0xf94e,0xf94f,0xf950,0xf951,0xf952,0xf953,0xf954,0xf955,0xf956,0xf957,0xf958,
+	0xf959,0xf95a,0xf95b,0xf95c,0xf95d,0xf95e,0xf95f,0xf960,0xf961,0xf962,0xf963,0xf964,0xf965,0xf966,0xf967,0xf968,
+	0xf969,0xf96a,0xf96b,0xf96c,0xf96d,0xf96e,0xf96f,0xf970,0xf971,0xf972,0xf973,0xf974,0xf975,0xf976,0xf977,0xf978,
+	0xf979,0xf97a,0xf97b,0xf97c,0xf97d,0xf97e,0xf97f,0xf980,0xf981,0xf982,0xf983,0xf984,0xf985,0xf986,0xf987,0xf988,
+	0xf989,0xf98a,0xf98b,0xf98c,0xf98d,0xf98e,0xf98f,0xf990,0xf991,0xf992,0xf993,0xf994,0xf995,0xf996,0xf997,0xf998,
+	0xf999,0xf99a,0xf99b,0xf99c,0xf99d,0xf99e,0xf99f,0xf9a0,0xf9a1,0xf9a2,0xf9a3,0xf9a4,0xf9a5,0xf9a6,0xf9a7,0xf9a8,
+	0xf9a9,0xf9aa,0xf9ab,0xf9ac,0xf9ad,0xf9ae,0xf9af,0xf9b0,0xf9b1,0xf9b2,0xf9b3,0xf9b4,0xf9b5,0xf9b6,0xf9b7,0xf9b8,
+	0xf9b9,0xf9ba,0xf9bb,0xf9bc,0xf9bd,0xf9be,0xf9bf,0xf9c0,0xf9c1,0xf9c2,0xf9c3,0xf9c4,0xf9c5,0xf9c6,0xf9c7,0xf9c8,
+	0xf9c9,0xf9ca,0xf9cb,0xf9cc,0xf9cd,0xf9ce,0xf9cf,0xf9d0,0xf9d1,0xf9d2,0xf9d3,0xf9d4,0xf9d5,0xf9d6,0xf9d7,0xf9d8,
+	0xf9d9,0xf9da,0xf9db,0xf9dc,0xf9dd,0xf9de,0xf9df,0xf9e0,0xf9e1,0xf9e2,0xf9e3,0xf9e4,0xf9e5,0xf9e6,0xf9e7,0xf9e8,
+	0xf9e9,0xf9ea,0xf9eb,0xf9ec,0xf9ed,0xf9ee,0xf9ef,0xf9f0,0xf9f1,0xf9f2,0xf9f3,0xf9f4,0xf9f5,0xf9f6,0xf9f7,0xf9f8,
+	0xf9f9,0xf9fa,0xf9fb,0xf9fc,0xf9fd,0xf9fe,0xf9ff,0xfa00,0xfa01,0xfa02,0xfa03,0xfa04,0xfa05,0xfa06,0xfa07,0xfa08,
+	0xfa09,0xfa0a,0xfa0b,0xfa0c,0xfa0d,0xfa10,0xfa12,0xfa15,0xfa16,0xfa17,0xfa18,0xfa19,0xfa1a,0xfa1b,0xfa1c,0xfa1d,
+	0xfa1e,0xfa20,0xfa22,0xfa25,0xfa26,0xfa2a,0xfa2b,0xfa2c,0xfa2d,0xfa2e,0xfa2f,0xfa30,0xfa31,0xfa32,0xfa33,0xfa34,
+	0xfa35,0xfa36,0xfa37,0xfa38,0xfa39,0xfa3a,0xfa3b,0xfa3c,0xfa3d,0xfa3e,0xfa3f,0xfa40,0xfa41,0xfa42,0xfa43,0xfa44,
+	0xfa45,0xfa46,0xfa47,0xfa48,0xfa49,0xfa4a,0xfa4b,0xfa4c,0xfa4d,0xfa4e,0xfa4f,0xfa50,0xfa51,0xfa52,0xfa53,0xfa54,
+	0xfa55,0xfa56,0xfa57,0xfa58,0xfa59,0xfa5a,0xfa5b,0xfa5c,0xfa5d,0xfa5e,0xfa5f,0xfa60,0xfa61,0xfa62,0xfa63,0xfa64,
+	0xfa65,0xfa66,0xfa67,0xfa68,0xfa69,0xfa6a,0xfa6b,0xfa6c,0xfa6d,0xfa70,0xfa71,0xfa72,0xfa73,0xfa74,0xfa75,0xfa76,
+	0xfa77,0xfa78,0xfa79,0xfa7a,0xfa7b,0xfa7c,0xfa7d,0xfa7e,0xfa7f,0xfa80,0xfa81,0xfa82,0xfa83,0xfa84,0xfa85,0xfa86,
+	0xfa87,0xfa88,0xfa89,0xfa8a,0xfa8b,0xfa8c,0xfa8d,0xfa8e,0xfa8f,0xfa90,0xfa91,0xfa92,0xfa93,0xfa94,0xfa95,0xfa96,
+	0xfa97,0xfa98,0xfa99,0xfa9a,0xfa9b,0xfa9c,0xfa9d,0xfa9e,0xfa9f,0xfaa0,0xfaa1,0xfaa2,0xfaa3,0xfaa4,0xfaa5,0xfaa6,
+	0xfaa7,0xfaa8,0xfaa9,0xfaaa,0xfaab,0xfaac,0xfaad,0xfaae,0xfaaf,0xfab0,0xfab1,0xfab2,0xfab3,0xfab4,0xfab5,0xfab6,
+	0xfab7,0xfab8,0xfab9,0xfaba,0xfabb,0xfabc,0xfabd,0xfabe,0xfabf,0xfac0,0xfac1,0xfac2,0xfac3,0xfac4,0xfac5,0xfac6,
+	0xfac7,0xfac8,0xfac9,0xfaca,0xfacb,0xfacc,0xfacd,0xface,0xfacf,0xfad0,0xfad1,0xfad2,0xfad3,0xfad4,0xfad5,0xfad6,
+	0xfad7,0xfad8,0xfad9,0xfb1d,0xfb1f,0xfb2a,0xfb2b,0xfb2c,0xfb2d,0xfb2e,0xfb2f,0xfb30,0xfb31,0xfb32,0xfb33,0xfb34,
+	0xfb35,0xfb36,0xfb38,0xfb39,0xfb3a,0xfb3b,0xfb3c,0xfb3e,0xfb40,0xfb41,0xfb43,0xfb44,0xfb46,0xfb47,0xfb48,0xfb49,
+	0xfb4a,0xfb4b,0xfb4c,0xfb4d,0xfb4e,0x1109a,0x1109c,0x110ab,0x1112e,0x1112f,0x1134b,0x1134c,0x114bb,0x114bc,0x114be,0x115ba,
+	0x115bb,0x11938,0x1d15e,0x1d15f,0x1d160,0x1d161,0x1d162,0x1d163,0x1d164,0x1d1bb,0x1d1bc,0x1d1bd,0x1d1be,0x1d1bf,0x1d1c0,0x2f800,
+	0x2f801,0x2f802,0x2f803,0x2f804,0x2f805,0x2f806,0x2f807,0x2f808,0x2f809,0x2f80a,0x2f80b,0x2f80c,0x2f80d,0x2f80e,0x2f80f,0x2f810,
+	0x2f811,0x2f812,0x2f813,0x2f814,0x2f815,0x2f816,0x2f817,0x2f818,0x2f819,0x2f81a,0x2f81b,0x2f81c,0x2f81d,0x2f81e,0x2f81f,0x2f820,
+	0x2f821,0x2f822,0x2f823,0x2f824,0x2f825,0x2f826,0x2f827,0x2f828,0x2f829,0x2f82a,0x2f82b,0x2f82c,0x2f82d,0x2f82e,0x2f82f,0x2f830,
+	0x2f831,0x2f832,0x2f833,0x2f834,0x2f835,0x2f836,0x2f837,0x2f838,0x2f839,0x2f83a,0x2f83b,0x2f83c,0x2f83d,0x2f83e,0x2f83f,0x2f840,
+	0x2f841,0x2f842,0x2f843,0x2f844,0x2f845,0x2f846,0x2f847,0x2f848,0x2f849,0x2f84a,0x2f84b,0x2f84c,0x2f84d,0x2f84e,0x2f84f,0x2f850,
+	0x2f851,0x2f852,0x2f853,0x2f854,0x2f855,0x2f856,0x2f857,0x2f858,0x2f859,0x2f85a,0x2f85b,0x2f85c,0x2f85d,0x2f85e,0x2f85f,0x2f860,
+	0x2f861,0x2f862,0x2f863,0x2f864,0x2f865,0x2f866,0x2f867,0x2f868,0x2f869,0x2f86a,0x2f86b,0x2f86c,0x2f86d,0x2f86e,0x2f86f,0x2f870,
+	0x2f871,0x2f872,0x2f873,0x2f874,0x2f875,0x2f876,0x2f877,0x2f878,0x2f879,0x2f87a,0x2f87b,0x2f87c,0x2f87d,0x2f87e,0x2f87f,0x2f880,
+	0x2f881,0x2f882,0x2f883,0x2f884,0x2f885,0x2f886,0x2f887,0x2f888,0x2f889,0x2f88a,0x2f88b,0x2f88c,0x2f88d,0x2f88e,0x2f88f,0x2f890,
+	0x2f891,0x2f892,0x2f893,0x2f894,0x2f895,0x2f896,0x2f897,0x2f898,0x2f899,0x2f89a,0x2f89b,0x2f89c,0x2f89d,0x2f89e,0x2f89f,0x2f8a0,
+	0x2f8a1,0x2f8a2,0x2f8a3,0x2f8a4,0x2f8a5,0x2f8a6,0x2f8a7,0x2f8a8,0x2f8a9,0x2f8aa,0x2f8ab,0x2f8ac,0x2f8ad,0x2f8ae,0x2f8af,0x2f8b0,
+	0x2f8b1,0x2f8b2,0x2f8b3,0x2f8b4,0x2f8b5,0x2f8b6,0x2f8b7,0x2f8b8,0x2f8b9,0x2f8ba,0x2f8bb,0x2f8bc,0x2f8bd,0x2f8be,0x2f8bf,0x2f8c0,
+	0x2f8c1,0x2f8c2,0x2f8c3,0x2f8c4,0x2f8c5,0x2f8c6,0x2f8c7,0x2f8c8,0x2f8c9,0x2f8ca,0x2f8cb,0x2f8cc,0x2f8cd,0x2f8ce,0x2f8cf,0x2f8d0,
+	0x2f8d1,0x2f8d2,0x2f8d3,0x2f8d4,0x2f8d5,0x2f8d6,0x2f8d7,0x2f8d8,0x2f8d9,0x2f8da,0x2f8db,0x2f8dc,0x2f8dd,0x2f8de,0x2f8df,0x2f8e0,
+	0x2f8e1,0x2f8e2,0x2f8e3,0x2f8e4,0x2f8e5,0x2f8e6,0x2f8e7,0x2f8e8,0x2f8e9,0x2f8ea,0x2f8eb,0x2f8ec,0x2f8ed,0x2f8ee,0x2f8ef,0x2f8f0,
+	0x2f8f1,0x2f8f2,0x2f8f3,0x2f8f4,0x2f8f5,0x2f8f6,0x2f8f7,0x2f8f8,0x2f8f9,0x2f8fa,0x2f8fb,0x2f8fc,0x2f8fd,0x2f8fe,0x2f8ff,0x2f900,
+	0x2f901,0x2f902,0x2f903,0x2f904,0x2f905,0x2f906,0x2f907,0x2f908,0x2f909,0x2f90a,0x2f90b,0x2f90c,0x2f90d,0x2f90e,0x2f90f,0x2f910,
+	0x2f911,0x2f912,0x2f913,0x2f914,0x2f915,0x2f916,0x2f917,0x2f918,0x2f919,0x2f91a,0x2f91b,0x2f91c,0x2f91d,0x2f91e,0x2f91f,0x2f920,
+	0x2f921,0x2f922,0x2f923,0x2f924,0x2f925,0x2f926,0x2f927,0x2f928,0x2f929,0x2f92a,0x2f92b,0x2f92c,0x2f92d,0x2f92e,0x2f92f,0x2f930,
+	0x2f931,0x2f932,0x2f933,0x2f934,0x2f935,0x2f936,0x2f937,0x2f938,0x2f939,0x2f93a,0x2f93b,0x2f93c,0x2f93d,0x2f93e,0x2f93f,0x2f940,
+	0x2f941,0x2f942,0x2f943,0x2f944,0x2f945,0x2f946,0x2f947,0x2f948,0x2f949,0x2f94a,0x2f94b,0x2f94c,0x2f94d,0x2f94e,0x2f94f,0x2f950,
+	0x2f951,0x2f952,0x2f953,0x2f954,0x2f955,0x2f956,0x2f957,0x2f958,0x2f959,0x2f95a,0x2f95b,0x2f95c,0x2f95d,0x2f95e,0x2f95f,0x2f960,
+	0x2f961,0x2f962,0x2f963,0x2f964,0x2f965,0x2f966,0x2f967,0x2f968,0x2f969,0x2f96a,0x2f96b,0x2f96c,0x2f96d,0x2f96e,0x2f96f,0x2f970,
+	0x2f971,0x2f972,0x2f973,0x2f974,0x2f975,0x2f976,0x2f977,0x2f978,0x2f979,0x2f97a,0x2f97b,0x2f97c,0x2f97d,0x2f97e,0x2f97f,0x2f980,
+	0x2f981,0x2f982,0x2f983,0x2f984,0x2f985,0x2f986,0x2f987,0x2f988,0x2f989,0x2f98a,0x2f98b,0x2f98c,0x2f98d,0x2f98e,0x2f98f,0x2f990,
+	0x2f991,0x2f992,0x2f993,0x2f994,0x2f995,0x2f996,0x2f997,0x2f998,0x2f999,0x2f99a,0x2f99b,0x2f99c,0x2f99d,0x2f99e,0x2f99f,0x2f9a0,
+	0x2f9a1,0x2f9a2,0x2f9a3,0x2f9a4,0x2f9a5,0x2f9a6,0x2f9a7,0x2f9a8,0x2f9a9,0x2f9aa,0x2f9ab,0x2f9ac,0x2f9ad,0x2f9ae,0x2f9af,0x2f9b0,
+	0x2f9b1,0x2f9b2,0x2f9b3,0x2f9b4,0x2f9b5,0x2f9b6,0x2f9b7,0x2f9b8,0x2f9b9,0x2f9ba,0x2f9bb,0x2f9bc,0x2f9bd,0x2f9be,0x2f9bf,0x2f9c0,
+	0x2f9c1,0x2f9c2,0x2f9c3,0x2f9c4,0x2f9c5,0x2f9c6,0x2f9c7,0x2f9c8,0x2f9c9,0x2f9ca,0x2f9cb,0x2f9cc,0x2f9cd,0x2f9ce,0x2f9cf,0x2f9d0,
+	0x2f9d1,0x2f9d2,0x2f9d3,0x2f9d4,0x2f9d5,0x2f9d6,0x2f9d7,0x2f9d8,0x2f9d9,0x2f9da,0x2f9db,0x2f9dc,0x2f9dd,0x2f9de,0x2f9df,0x2f9e0,
+	0x2f9e1,0x2f9e2,0x2f9e3,0x2f9e4,0x2f9e5,0x2f9e6,0x2f9e7,0x2f9e8,0x2f9e9,0x2f9ea,0x2f9eb,0x2f9ec,0x2f9ed,0x2f9ee,0x2f9ef,0x2f9f0,
+	0x2f9f1,0x2f9f2,0x2f9f3,0x2f9f4,0x2f9f5,0x2f9f6,0x2f9f7,0x2f9f8,0x2f9f9,0x2f9fa,0x2f9fb,0x2f9fc,0x2f9fd,0x2f9fe,0x2f9ff,0x2fa00,
+	0x2fa01,0x2fa02,0x2fa03,0x2fa04,0x2fa05,0x2fa06,0x2fa07,0x2fa08,0x2fa09,0x2fa0a,0x2fa0b,0x2fa0c,0x2fa0d,0x2fa0e,0x2fa0f,0x2fa10,
+	0x2fa11,0x2fa12,0x2fa13,0x2fa14,0x2fa15,0x2fa16,0x2fa17,0x2fa18,0x2fa19,0x2fa1a,0x2fa1b,0x2fa1c,0x2fa1d
+};
+
+/**
+ * Where the full decomposition of each code point of normalizationDecomposed
+ * starts in normalizationDecompositions. The last offset is the end of the pool.
+ */
+static const unsigned short normalizationDecompositionOffsets[NORMALIZATION_DECOMPOSITIONS + 1] = {
+	0,2,4,6,8,10,12,14,16,18,20,22,24,26,28,30,32,34,36,38,40,42,44,46,
+	48,50,52,54,56,58,60,62,64,66,68,70,72,74,76,78,80,82,84,86,88,90,92,94,
+	96,98,100,102,104,106,108,110,112,114,116,118,120,122,124,126,128,130,132,134,136,138,140,142,
+	144,146,148,150,152,154,156,158,160,162,164,166,168,170,172,174,176,178,180,182,184,186,188,190,
+	192,194,196,198,200,202,204,206,208,210,212,214,216,218,220,222,224,226,228,230,232,234,236,238,
+	240,242,244,246,248,250,252,254,256,258,260,262,264,266,268,270,272,274,276,278,280,282,284,286,
+	288,290,292,294,296,298,300,302,304,306,308,310,312,314,316,318,320,322,324,326,328,330,332,334,
+	336,338,340,342,344,346,349,352,355,358,361,364,367,370,373,376,379,382,384,386,388,390,392,394,
+	396,398,401,404,406,408,410,412,414,416,418,421,424,426,428,430,432,434,436,438,440,442,444,446,
+	448,450,452,454,456,458,460,462,464,466,468,470,472,474,476,478,480,482,484,486,488,490,492,494,
+	496,498,500,503,506,509,512,514,516,519,522,524,526,527,528,529,531,532,533,535,537,538,540,542,
+	544,546,548,550,553,555,557,559,561,563,565,568,570,572,574,576,578,580,582,584,586,588,590,592,
+	594,596,598,600,602,604,606,608,610,612,614,616,618,620,622,624,626,628,630,632,634,636,638,640,
+	642,644,646,648,650,652,654,656,658,660,662,664,666,668,670,672,674,676,678,680,682,684,686,688,
+	690,692,694,696,698,700,702,704,706,708,710,712,714,716,718,720,722,724,726,728,730,732,734,736,
+	738,740,742,744,746,748,750,752,754,756,758,760,762,764,766,768,770,772,774,777,779,781,783,785,
+	787,790,792,794,796,798,800,802,804,806,808,810,812,814,816,818,820,822,824,826,828,830,832,834,
+	836,838,840,842,844,846,848,850,852,854,856,858,860,862,864,866,869,872,874,876,878,880,882,884,
+	886,888,890,892,895,898,901,904,906,908,910,912,915,918,920,922,924,926,928,930,932,934,936,938,
+	940,942,944,946,948,950,953,956,958,960,962,964,966,968,970,972,975,978,980,982,984,986,988,990,
+	992,994,996,998,1000,1002,1004,1006,1008,1010,1012,1014,1017,1020,1023,1026,1029,1032,1035,1038,1040,1042,1044,1046,
+	1048,1050,1052,1054,1057,1060,1062,1064,1066,1068,1070,1072,1075,1078,1081,1084,1087,1090,1092,1094,1096,1098,1100,1102,
+	1104,1106,1108,1110,1112,1114,1116,1118,1121,1124,1127,1130,1132,1134,1136,1138,1140,1142,1144,1146,1148,1150,1152,1154,
+	1156,1158,1160,1162,1164,1166,1168,1170,1172,1174,1176,1178,1180,1182,1184,1186,1188,1190,1192,1194,1196,1198,1200,1203,
+	1206,1209,1212,1215,1218,1221,1224,1227,1230,1233,1236,1239,1242,1245,1248,1251,1254,1257,1260,1262,1264,1266,1268,1270,
+	1272,1275,1278,1281,1284,1287,1290,1293,1296,1299,1302,1304,1306,1308,1310,1312,1314,1316,1318,1321,1324,1327,1330,1333,
+	1336,1339,1342,1345,1348,1351,1354,1357,1360,1363,1366,1369,1372,1375,1378,1380,1382,1384,1386,1389,1392,1395,1398,1401,
+	1404,1407,1410,1413,1416,1418,1420,1422,1424,1426,1428,1430,1432,1434,1436,1439,1442,1445,1448,1451,1454,1456,1458,1461,
+	1464,1467,1470,1473,1476,1478,1480,1483,1486,1489,1492,1494,1496,1499,1502,1505,1508,1510,1512,1515,1518,1521,1524,1527,
+	1530,1532,1534,1537,1540,1543,1546,1549,1552,1554,1556,1559,1562,1565,1568,1571,1574,1576,1578,1581,1584,1587,1590,1593,
+	1596,1598,1600,1603,1606,1609,1612,1614,1616,1619,1622,1625,1628,1630,1632,1635,1638,1641,1644,1647,1650,1652,1655,1658,
+	1661,1663,1665,1668,1671,1674,1677,1680,1683,1685,1687,1690,1693,1696,1699,1702,1705,1707,1709,1711,1713,1715,1717,1719,
+	1721,1723,1725,1727,1729,1731,1733,1736,1739,1743,1747,1751,1755,1759,1763,1766,1769,1773,1777,1781,1785,1789,1793,1796,
+	1799,1803,1807,1811,1815,1819,1823,1826,1829,1833,1837,1841,1845,1849,1853,1856,1859,1863,1867,1871,1875,1879,1883,1886,
+	1889,1893,1897,1901,1905,1909,1913,1915,1917,1920,1922,1925,1927,1930,1932,1934,1936,1938,1940,1941,1943,1946,1948,1951,
+	1953,1956,1958,1960,1962,1964,1966,1968,1970,1972,1974,1976,1979,1982,1984,1987,1989,1991,1993,1995,1997,1999,2001,2003,
+	2005,2008,2011,2013,2015,2017,2020,2022,2024,2026,2028,2030,2032,2034,2035,2038,2040,2043,2045,2048,2050,2052,2054,2056,
+	2058,2059,2060,2061,2062,2063,2065,2067,2069,2071,2073,2075,2077,2079,2081,2083,2085,2087,2089,2091,2093,2095,2097,2099,
+	2101,2103,2105,2107,2109,2111,2113,2115,2117,2119,2121,2123,2125,2127,2129,2131,2133,2135,2137,2139,2141,2143,2145,2147,
+	2149,2151,2153,2154,2155,2157,2159,2161,2163,2165,2167,2169,2171,2173,2175,2177,2179,2181,2183,2185,2187,2189,2191,2193,
+	2195,2197,2199,2201,2203,2205,2207,2209,2211,2213,2215,2217,2219,2221,2223,2225,2227,2229,2231,2233,2235,2237,2239,2241,
+	2243,2245,2247,2249,2251,2253,2255,2257,2259,2261,2263,2265,2267,2269,2271,2273,2274,2275,2276,2277,2278,2279,2280,2281,
+	2282,2283,2284,2285,2286,2287,2288,2289,2290,2291,2292,2293,2294,2295,2296,2297,2298,2299,2300,2301,2302,2303,2304,2305,
+	2306,2307,2308,2309,2310,2311,2312,2313,2314,2315,2316,2317,2318,2319,2320,2321,2322,2323,2324,2325,2326,2327,2328,2329,
+	2330,2331,2332,2333,2334,2335,2336,2337,2338,2339,2340,2341,2342,2343,2344,2345,2346,2347,2348,2349,2350,2351,2352,2353,
+	2354,2355,2356,2357,2358,2359,2360,2361,2362,2363,2364,2365,2366,2367,2368,2369,2370,2371,2372,2373,2374,2375,2376,2377,
+	2378,2379,2380,2381,2382,2383,2384,2385,2386,2387,2388,2389,2390,2391,2392,2393,2394,2395,2396,2397,2398,2399,2400,2401,
+	2402,2403,2404,2405,2406,2407,2408,2409,2410,2411,2412,2413,2414,2415,2416,2417,2418,2419,2420,2421,2422,2423,2424,2425,
+	2426,2427,2428,2429,2430,2431,2432,2433,2434,2435,2436,2437,2438,2439,2440,2441,2442,2443,2444,2445,2446,2447,2448,2449,
+	2450,2451,2452,2453,2454,2455,2456,2457,2458,2459,2460,2461,2462,2463,2464,2465,2466,2467,2468,2469,2470,2471,2472,2473,
+	2474,2475,2476,2477,2478,2479,2480,2481,2482,2483,2484,2485,2486,2487,2488,2489,2490,2491,2492,2493,2494,2495,2496,2497,
+	2498,2499,2500,2501,2502,2503,2504,2505,2506,2507,2508,2509,2510,2511,2512,2513,2514,2515,2516,2517,2518,2519,2520,2521,
+	2522,2523,2524,2525,2526,2527,2528,2529,2530,2531,2532,2533,2534,2535,2536,2537,2538,2539,2540,2541,2542,2543,2544,2545,
+	2546,2547,2548,2549,2550,2551,2552,2553,2554,2555,2556,2557,2558,2559,2560,2561,2562,2563,2564,2565,2566,2567,2568,2569,
+	2570,2571,2572,2573,2574,2575,2576,2577,2578,2579,2580,2581,2582,2583,2584,2585,2586,2587,2588,2589,2590,2591,2592,2593,
+	2594,2595,2596,2597,2598,2599,2600,2601,2602,2603,2604,2605,2606,2607,2608,2609,2610,2611,2612,2613,2614,2615,2616,2617,
+	2618,2619,2620,2621,2622,2623,2624,2625,2626,2627,2628,2629,2630,2631,2632,2633,2634,2635,2636,2637,2638,2639,2640,2641,
+	2642,2643,2644,2645,2646,2647,2648,2649,2650,2651,2652,2653,2654,2655,2656,2657,2658,2659,2660,2661,2662,2663,2664,2665,
+	2666,2667,2668,2669,2670,2671,2672,2673,2674,2675,2676,2677,2678,2679,2680,2681,2682,2683,2684,2685,2686,2687,2688,2689,
+	2690,2691,2692,2693,2694,2695,2696,2697,2698,2699,2700,2701,2702,2703,2704,2705,2706,2707,2708,2709,2710,2711,2712,2713,
+	2714,2715,2716,2717,2718,2719,2720,2721,2722,2723,2724,2725,2726,2727,2728,2729,2730,2731,2732,2733,2735,2737,2739,2741,
+	2744,2747,2749,2751,2753,2755,2757,2759,2761,2763,2765,2767,2769,2771,2773,2775,2777,2779,2781,2783,2785,2787,2789,2791,
+	2793,2795,2797,2799,2801,2803,2805,2807,2809,2811,2813,2815,2817,2819,2821,2823,2825,2827,2829,2831,2833,2836,2839,2842,
+	2845,2848,2850,2852,2855,2858,2861,2864,2865,2866,2867,2868,2869,2870,2871,2872,2873,2874,2875,2876,2877,2878,2879,2880,
+	2881,2882,2883,2884,2885,2886,2887,2888,2889,2890,2891,2892,2893,2894,2895,2896,2897,2898,2899,2900,2901,2902,2903,2904,
+	2905,2906,2907,2908,2909,2910,2911,2912,2913,2914,2915,2916,2917,2918,2919,2920,2921,2922,2923,2924,2925,2926,2927,2928,
+	2929,2930,2931,2932,2933,2934,2935,2936,2937,2938,2939,2940,2941,2942,2943,2944,2945,2946,2947,2948,2949,2950,2951,2952,
+	2953,2954,2955,2956,2957,2958,2959,2960,2961,2962,2963,2964,2965,2966,2967,2968,2969,2970,2971,2972,2973,2974,2975,2976,
+	2977,2978,2979,2980,2981,2982,2983,2984,2985,2986,2987,2988,2989,2990,2991,2992,2993,2994,2995,2996,2997,2998,2999,3000,
+	3001,3002,3003,3004,3005,3006,3007,3008,3009,3010,3011,3012,3013,3014,3015,3016,3017,3018,3019,3020,3021,3022,3023,3024,
+	3025,3026,3027,3028,3029,3030,3031,3032,3033,3034,3035,3036,3037,3038,3039,3040,3041,3042,3043,3044,3045,3046,3047,3048,
+	3049,3050,3051,3052,3053,3054,3055,3056,3057,3058,3059,3060,3061,3062,3063,3064,3065,3066,3067,3068,3069,3070,3071,3072,
+	3073,3074,3075,3076,3077,3078,3079,3080,3081,3082,3083,3084,3085,3086,3087,3088,3089,3090,3091,3092,3093,3094,3095,3096,
+	3097,3098,3099,3100,3101,3102,3103,3104,3105,3106,3107,3108,3109,3110,3111,3112,3113,3114,3115,3116,3117,3118,3119,3120,
+	3121,3122,3123,3124,3125,3126,3127,3128,3129,3130,3131,3132,3133,3134,3135,3136,3137,3138,3139,3140,3141,3142,3143,3144,
+	3145,3146,3147,3148,3149,3150,3151,3152,3153,3154,3155,3156,3157,3158,3159,3160,3161,3162,3163,3164,3165,3166,3167,3168,
+	3169,3170,3171,3172,3173,3174,3175,3176,3177,3178,3179,3180,3181,3182,3183,3184,3185,3186,3187,3188,3189,3190,3191,3192,
+	3193,3194,3195,3196,3197,3198,3199,3200,3201,3202,3203,3204,3205,3206,3207,3208,3209,3210,3211,3212,3213,3214,3215,3216,
+	3217,3218,3219,3220,3221,3222,3223,3224,3225,3226,3227,3228,3229,3230,3231,3232,3233,3234,3235,3236,3237,3238,3239,3240,
+	3241,3242,3243,3244,3245,3246,3247,3248,3249,3250,3251,3252,3253,3254,3255,3256,3257,3258,3259,3260,3261,3262,3263,3264,
+	3265,3266,3267,3268,3269,3270,3271,3272,3273,3274,3275,3276,3277,3278,3279,3280,3281,3282,3283,3284,3285,3286,3287,3288,
+	3289,3290,3291,3292,3293,3294,3295,3296,3297,3298,3299,3300,3301,3302,3303,3304,3305,3306,3307,3308,3309,3310,3311,3312,
+	3313,3314,3315,3316,3317,3318,3319,3320,3321,3322,3323,3324,3325,3326,3327,3328,3329,3330,3331,3332,3333,3334,3335,3336,
+	3337,3338,3339,3340,3341,3342,3343,3344,3345,3346,3347,3348,3349,3350,3351,3352,3353,3354,3355,3356,3357,3358,3359,3360,
+	3361,3362,3363,3364,3365,3366,3367,3368,3369,3370,3371,3372,3373,3374,3375,3376,3377,3378,3379,3380,3381,3382,3383,3384,
+	3385,3386,3387,3388,3389,3390,3391,3392,3393,3394,3395,3396,3397,3398,3399,3400,3401,3402,3403,3404,3405,3406
+};
+
+/**
+ * The full canonical decompositions, in canonical order
+ */
+static const unsigned int normalizationDecompositions[3406] = {
+	0x41,0x300,0x41,0x301,0x41,0x302,0x41,0x303,0x41,0x308,0x41,0x30a,0x43,0x327,0x45,0x300,
+	0x45,0x301,0x45,0x302,0x45,0x308,0x49,0x300,0x49,0x301,0x49,0x302,0x49,0x308,0x4e,0x303,
+	0x4f,0x300,0x4f,0x301,0x4f,0x302,0x4f,0x303,0x4f,0x308,0x55,0x300,0x55,0x301,0x55,0x302,
+	0x55,0x308,0x59,0x301,0x61,0x300,0x61,0x301,0x61,0x302,0x61,0x303,0x61,0x308,0x61,0x30a,
+	0x63,0x327,0x65,0x300,0x65,0x301,0x65,0x302,0x65,0x308,0x69,0x300,0x69,0x301,0x69,0x302,
+	0x69,0x308,0x6e,0x303,0x6f,0x300,0x6f,0x301,0x6f,0x302,0x6f,0x303,0x6f,0x308,0x75,0x300,
+	0x75,0x301,0x75,0x302,0x75,0x308,0x79,0x301,0x79,0x308,0x41,0x304,0x61,0x304,0x41,0x306,
+	0x61,0x306,0x41,0x328,0x61,0x328,0x43,0x301,0x63,0x301,0x43,0x302,0x63,0x302,0x43,0x307,
+	0x63,0x307,0x43,0x30c,0x63,0x30c,0x44,0x30c,0x64,0x30c,0x45,0x304,0x65,0x304,0x45,0x306,
+	0x65,0x306,0x45,0x307,0x65,0x307,0x45,0x328,0x65,0x328,0x45,0x30c,0x65,0x30c,0x47,0x302,
+	0x67,0x302,0x47,0x306,0x67,0x306,0x47,0x307,0x67,0x307,0x47,0x327,0x67,0x327,0x48,0x302,
+	0x68,0x302,0x49,0x303,0x69,0x303,0x49,0x304,0x69,0x304,0x49,0x306,0x69,0x306,0x49,0x328,
+	0x69,0x328,0x49,0x307,0x4a,0x302,0x6a,0x302,0x4b,0x327,0x6b,0x327,0x4c,0x301,0x6c,0x301,
+	0x4c,0x327,0x6c,0x327,0x4c,0x30c,0x6c,0x30c,0x4e,0x301,0x6e,0x301,0x4e,0x327,0x6e,0x327,
+	0x4e,0x30c,0x6e,0x30c,0x4f,0x304,0x6f,0x304,0x4f,0x306,0x6f,0x306,0x4f,0x30b,0x6f,0x30b,
+	0x52,0x301,0x72,0x301,0x52,0x327,0x72,0x327,0x52,0x30c,0x72,0x30c,0x53,0x301,0x73,0x301,
+	0x53,0x302,0x73,0x302,0x53,0x327,0x73,0x327,0x53,0x30c,0x73,0x30c,0x54,0x327,0x74,0x327,
+	0x54,0x30c,0x74,0x30c,0x55,0x303,0x75,0x303,0x55,0x304,0x75,0x304,0x55,0x306,0x75,0x306,
+	0x55,0x30a,0x75,0x30a,0x55,0x30b,0x75,0x30b,0x55,0x328,0x75,0x328,0x57,0x302,0x77,0x302,
+	0x59,0x302,0x79,0x302,0x59,0x308,0x5a,0x301,0x7a,0x301,0x5a,0x307,0x7a,0x307,0x5a,0x30c,
+	0x7a,0x30c,0x4f,0x31b,0x6f,0x31b,0x55,0x31b,0x75,0x31b,0x41,0x30c,0x61,0x30c,0x49,0x30c,
+	0x69,0x30c,0x4f,0x30c,0x6f,0x30c,0x55,0x30c,0x75,0x30c,0x55,0x308,0x304,0x75,0x308,0x304,
+	0x55,0x308,0x301,0x75,0x308,0x301,0x55,0x308,0x30c,0x75,0x308,0x30c,0x55,0x308,0x300,0x75,
+	0x308,0x300,0x41,0x308,0x304,0x61,0x308,0x304,0x41,0x307,0x304,0x61,0x307,0x304,0xc6,0x304,
+	0xe6,0x304,0x47,0x30c,0x67,0x30c,0x4b,0x30c,0x6b,0x30c,0x4f,0x328,0x6f,0x328,0x4f,0x328,
+	0x304,0x6f,0x328,0x304,0x1b7,0x30c,0x292,0x30c,0x6a,0x30c,0x47,0x301,0x67,0x301,0x4e,0x300,
+	0x6e,0x300,0x41,0x30a,0x301,0x61,0x30a,0x301,0xc6,0x301,0xe6,0x301,0xd8,0x301,0xf8,0x301,
+	0x41,0x30f,0x61,0x30f,0x41,0x311,0x61,0x311,0x45,0x30f,0x65,0x30f,0x45,0x311,0x65,0x311,
+	0x49,0x30f,0x69,0x30f,0x49,0x311,0x69,0x311,0x4f,0x30f,0x6f,0x30f,0x4f,0x311,0x6f,0x311,
+	0x52,0x30f,0x72,0x30f,0x52,0x311,0x72,0x311,0x55,0x30f,0x75,0x30f,0x55,0x311,0x75,0x311,
+	0x53,0x326,0x73,0x326,0x54,0x326,0x74,0x326,0x48,0x30c,0x68,0x30c,0x41,0x307,0x61,0x307,
+	0x45,0x327,0x65,0x327,0x4f,0x308,0x304,0x6f,0x308,0x304,0x4f,0x303,0x304,0x6f,0x303,0x304,
+	0x4f,0x307,0x6f,0x307,0x4f,0x307,0x304,0x6f,0x307,0x304,0x59,0x304,0x79,0x304,0x300,0x301,
+	0x313,0x308,0x301,0x2b9,0x3b,0xa8,0x301,0x391,0x301,0xb7,0x395,0x301,0x397,0x301,0x399,0x301,
+	0x39f,0x301,0x3a5,0x301,0x3a9,0x301,0x3b9,0x308,0x301,0x399,0x308,0x3a5,0x308,0x3b1,0x301,0x3b5,
+	0x301,0x3b7,0x301,0x3b9,0x301,0x3c5,0x308,0x301,0x3b9,0x308,0x3c5,0x308,0x3bf,0x301,0x3c5,0x301,
+	0x3c9,0x301,0x3d2,0x301,0x3d2,0x308,0x415,0x300,0x415,0x308,0x413,0x301,0x406,0x308,0x41a,0x301,
+	0x418,0x300,0x423,0x306,0x418,0x306,0x438,0x306,0x435,0x300,0x435,0x308,0x433,0x301,0x456,0x308,
+	0x43a,0x301,0x438,0x300,0x443,0x306,0x474,0x30f,0x475,0x30f,0x416,0x306,0x436,0x306,0x410,0x306,
+	0x430,0x306,0x410,0x308,0x430,0x308,0x415,0x306,0x435,0x306,0x4d8,0x308,0x4d9,0x308,0x416,0x308,
+	0x436,0x308,0x417,0x308,0x437,0x308,0x418,0x304,0x438,0x304,0x418,0x308,0x438,0x308,0x41e,0x308,
+	0x43e,0x308,0x4e8,0x308,0x4e9,0x308,0x42d,0x308,0x44d,0x308,0x423,0x304,0x443,0x304,0x423,0x308,
+	0x443,0x308,0x423,0x30b,0x443,0x30b,0x427,0x308,0x447,0x308,0x42b,0x308,0x44b,0x308,0x627,0x653,
+	0x627,0x654,0x648,0x654,0x627,0x655,0x64a,0x654,0x6d5,0x654,0x6c1,0x654,0x6d2,0x654,0x928,0x93c,
+	0x930,0x93c,0x933,0x93c,0x915,0x93c,0x916,0x93c,0x917,0x93c,0x91c,0x93c,0x921,0x93c,0x922,0x93c,
+	0x92b,0x93c,0x92f,0x93c,0x9c7,0x9be,0x9c7,0x9d7,0x9a1,0x9bc,0x9a2,0x9bc,0x9af,0x9bc,0xa32,0xa3c,
+	0xa38,0xa3c,0xa16,0xa3c,0xa17,0xa3c,0xa1c,0xa3c,0xa2b,0xa3c,0xb47,0xb56,0xb47,0xb3e,0xb47,0xb57,
+	0xb21,0xb3c,0xb22,0xb3c,0xb92,0xbd7,0xbc6,0xbbe,0xbc7,0xbbe,0xbc6,0xbd7,0xc46,0xc56,0xcbf,0xcd5,
+	0xcc6,0xcd5,0xcc6,0xcd6,0xcc6,0xcc2,0xcc6,0xcc2,0xcd5,0xd46,0xd3e,0xd47,0xd3e,0xd46,0xd57,0xdd9,
+	0xdca,0xdd9,0xdcf,0xdd9,0xdcf,0xdca,0xdd9,0xddf,0xf42,0xfb7,0xf4c,0xfb7,0xf51,0xfb7,0xf56,0xfb7,
+	0xf5b,0xfb7,0xf40,0xfb5,0xf71,0xf72,0xf71,0xf74,0xfb2,0xf80,0xfb3,0xf80,0xf71,0xf80,0xf92,0xfb7,
+	0xf9c,0xfb7,0xfa1,0xfb7,0xfa6,0xfb7,0xfab,0xfb7,0xf90,0xfb5,0x1025,0x102e,0x1b05,0x1b35,0x1b07,0x1b35,
+	0x1b09,0x1b35,0x1b0b,0x1b35,0x1b0d,0x1b35,0x1b11,0x1b35,0x1b3a,0x1b35,0x1b3c,0x1b35,0x1b3e,0x1b35,0x1b3f,0x1b35,
+	0x1b42,0x1b35,0x41,0x325,0x61,0x325,0x42,0x307,0x62,0x307,0x42,0x323,0x62,0x323,0x42,0x331,
+	0x62,0x331,0x43,0x327,0x301,0x63,0x327,0x301,0x44,0x307,0x64,0x307,0x44,0x323,0x64,0x323,
+	0x44,0x331,0x64,0x331,0x44,0x327,0x64,0x327,0x44,0x32d,0x64,0x32d,0x45,0x304,0x300,0x65,
+	0x304,0x300,0x45,0x304,0x301,0x65,0x304,0x301,0x45,0x32d,0x65,0x32d,0x45,0x330,0x65,0x330,
+	0x45,0x327,0x306,0x65,0x327,0x306,0x46,0x307,0x66,0x307,0x47,0x304,0x67,0x304,0x48,0x307,
+	0x68,0x307,0x48,0x323,0x68,0x323,0x48,0x308,0x68,0x308,0x48,0x327,0x68,0x327,0x48,0x32e,
+	0x68,0x32e,0x49,0x330,0x69,0x330,0x49,0x308,0x301,0x69,0x308,0x301,0x4b,0x301,0x6b,0x301,
+	0x4b,0x323,0x6b,0x323,0x4b,0x331,0x6b,0x331,0x4c,0x323,0x6c,0x323,0x4c,0x323,0x304,0x6c,
+	0x323,0x304,0x4c,0x331,0x6c,0x331,0x4c,0x32d,0x6c,0x32d,0x4d,0x301,0x6d,0x301,0x4d,0x307,
+	0x6d,0x307,0x4d,0x323,0x6d,0x323,0x4e,0x307,0x6e,0x307,0x4e,0x323,0x6e,0x323,0x4e,0x331,
+	0x6e,0x331,0x4e,0x32d,0x6e,0x32d,0x4f,0x303,0x301,0x6f,0x303,0x301,0x4f,0x303,0x308,0x6f,
+	0x303,0x308,0x4f,0x304,0x300,0x6f,0x304,0x300,0x4f,0x304,0x301,0x6f,0x304,0x301,0x50,0x301,
+	0x70,0x301,0x50,0x307,0x70,0x307,0x52,0x307,0x72,0x307,0x52,0x323,0x72,0x323,0x52,0x323,
+	0x304,0x72,0x323,0x304,0x52,0x331,0x72,0x331,0x53,0x307,0x73,0x307,0x53,0x323,0x73,0x323,
+	0x53,0x301,0x307,0x73,0x301,0x307,0x53,0x30c,0x307,0x73,0x30c,0x307,0x53,0x323,0x307,0x73,
+	0x323,0x307,0x54,0x307,0x74,0x307,0x54,0x323,0x74,0x323,0x54,0x331,0x74,0x331,0x54,0x32d,
+	0x74,0x32d,0x55,0x324,0x75,0x324,0x55,0x330,0x75,0x330,0x55,0x32d,0x75,0x32d,0x55,0x303,
+	0x301,0x75,0x303,0x301,0x55,0x304,0x308,0x75,0x304,0x308,0x56,0x303,0x76,0x303,0x56,0x323,
+	0x76,0x323,0x57,0x300,0x77,0x300,0x57,0x301,0x77,0x301,0x57,0x308,0x77,0x308,0x57,0x307,
+	0x77,0x307,0x57,0x323,0x77,0x323,0x58,0x307,0x78,0x307,0x58,0x308,0x78,0x308,0x59,0x307,
+	0x79,0x307,0x5a,0x302,0x7a,0x302,0x5a,0x323,0x7a,0x323,0x5a,0x331,0x7a,0x331,0x68,0x331,
+	0x74,0x308,0x77,0x30a,0x79,0x30a,0x17f,0x307,0x41,0x323,0x61,0x323,0x41,0x309,0x61,0x309,
+	0x41,0x302,0x301,0x61,0x302,0x301,0x41,0x302,0x300,0x61,0x302,0x300,0x41,0x302,0x309,0x61,
+	0x302,0x309,0x41,0x302,0x303,0x61,0x302,0x303,0x41,0x323,0x302,0x61,0x323,0x302,0x41,0x306,
+	0x301,0x61,0x306,0x301,0x41,0x306,0x300,0x61,0x306,0x300,0x41,0x306,0x309,0x61,0x306,0x309,
+	0x41,0x306,0x303,0x61,0x306,0x303,0x41,0x323,0x306,0x61,0x323,0x306,0x45,0x323,0x65,0x323,
+	0x45,0x309,0x65,0x309,0x45,0x303,0x65,0x303,0x45,0x302,0x301,0x65,0x302,0x301,0x45,0x302,
+	0x300,0x65,0x302,0x300,0x45,0x302,0x309,0x65,0x302,0x309,0x45,0x302,0x303,0x65,0x302,0x303,
+	0x45,0x323,0x302,0x65,0x323,0x302,0x49,0x309,0x69,0x309,0x49,0x323,0x69,0x323,0x4f,0x323,
+	0x6f,0x323,0x4f,0x309,0x6f,0x309,0x4f,0x302,0x301,0x6f,0x302,0x301,0x4f,0x302,0x300,0x6f,
+	0x302,0x300,0x4f,0x302,0x309,0x6f,0x302,0x309,0x4f,0x302,0x303,0x6f,0x302,0x303,0x4f,0x323,
+	0x302,0x6f,0x323,0x302,0x4f,0x31b,0x301,0x6f,0x31b,0x301,0x4f,0x31b,0x300,0x6f,0x31b,0x300,
+	0x4f,0x31b,0x309,0x6f,0x31b,0x309,0x4f,0x31b,0x303,0x6f,0x31b,0x303,0x4f,0x31b,0x323,0x6f,
+	0x31b,0x323,0x55,0x323,0x75,0x323,0x55,0x309,0x75,0x309,0x55,0x31b,0x301,0x75,0x31b,0x301,
+	0x55,0x31b,0x300,0x75,0x31b,0x300,0x55,0x31b,0x309,0x75,0x31b,0x309,0x55,0x31b,0x303,0x75,
+	0x31b,0x303,0x55,0x31b,0x323,0x75,0x31b,0x323,0x59,0x300,0x79,0x300,0x59,0x323,0x79,0x323,
+	0x59,0x309,0x79,0x309,0x59,0x303,0x79,0x303,0x3b1,0x313,0x3b1,0x314,0x3b1,0x313,0x300,0x3b1,
+	0x314,0x300,0x3b1,0x313,0x301,0x3b1,0x314,0x301,0x3b1,0x313,0x342,0x3b1,0x314,0x342,0x391,0x313,
+	0x391,0x314,0x391,0x313,0x300,0x391,0x314,0x300,0x391,0x313,0x301,0x391,0x314,0x301,0x391,0x313,
+	0x342,0x391,0x314,0x342,0x3b5,0x313,0x3b5,0x314,0x3b5,0x313,0x300,0x3b5,0x314,0x300,0x3b5,0x313,
+	0x301,0x3b5,0x314,0x301,0x395,0x313,0x395,0x314,0x395,0x313,0x300,0x395,0x314,0x300,0x395,0x313,
+	0x301,0x395,0x314,0x301,0x3b7,0x313,0x3b7,0x314,0x3b7,0x313,0x300,0x3b7,0x314,0x300,0x3b7,0x313,
+	0x301,0x3b7,0x314,0x301,0x3b7,0x313,0x342,0x3b7,0x314,0x342,0x397,0x313,0x397,0x314,0x397,0x313,
+	0x300,0x397,0x314,0x300,0x397,0x313,0x301,0x397,0x314,0x301,0x397,0x313,0x342,0x397,0x314,0x342,
+	0x3b9,0x313,0x3b9,0x314,0x3b9,0x313,0x300,0x3b9,0x314,0x300,0x3b9,0x313,0x301,0x3b9,0x314,0x301,
+	0x3b9,0x313,0x342,0x3b9,0x314,0x342,0x399,0x313,0x399,0x314,0x399,0x313,0x300,0x399,0x314,0x300,
+	0x399,0x313,0x301,0x399,0x314,0x301,0x399,0x313,0x342,0x399,0x314,0x342,0x3bf,0x313,0x3bf,0x314,
+	0x3bf,0x313,0x300,0x3bf,0x314,0x300,0x3bf,0x313,0x301,0x3bf,0x314,0x301,0x39f,0x313,0x39f,0x314,
+	0x39f,0x313,0x300,0x39f,0x314,0x300,0x39f,0x313,0x301,0x39f,0x314,0x301,0x3c5,0x313,0x3c5,0x314,
+	0x3c5,0x313,0x300,0x3c5,0x314,0x300,0x3c5,0x313,0x301,0x3c5,0x314,0x301,0x3c5,0x313,0x342,0x3c5,
+	0x314,0x342,0x3a5,0x314,0x3a5,0x314,0x300,0x3a5,0x314,0x301,0x3a5,0x314,0x342,0x3c9,0x313,0x3c9,
+	0x314,0x3c9,0x313,0x300,0x3c9,0x314,0x300,0x3c9,0x313,0x301,0x3c9,0x314,0x301,0x3c9,0x313,0x342,
+	0x3c9,0x314,0x342,0x3a9,0x313,0x3a9,0x314,0x3a9,0x313,0x300,0x3a9,0x314,0x300,0x3a9,0x313,0x301,
+	0x3a9,0x314,0x301,0x3a9,0x313,0x342,0x3a9,0x314,0x342,0x3b1,0x300,0x3b1,0x301,0x3b5,0x300,0x3b5,
+	0x301,0x3b7,0x300,0x3b7,0x301,0x3b9,0x300,0x3b9,0x301,0x3bf,0x300,0x3bf,0x301,0x3c5,0x300,0x3c5,
+	0x301,0x3c9,0x300,0x3c9,0x301,0x3b1,0x313,0x345,0x3b1,0x314,0x345,0x3b1,0x313,0x300,0x345,0x3b1,
+	0x314,0x300,0x345,0x3b1,0x313,0x301,0x345,0x3b1,0x314,0x301,0x345,0x3b1,0x313,0x342,0x345,0x3b1,
+	0x314,0x342,0x345,0x391,0x313,0x345,0x391,0x314,0x345,0x391,0x313,0x300,0x345,0x391,0x314,0x300,
+	0x345,0x391,0x313,0x301,0x345,0x391,0x314,0x301,0x345,0x391,0x313,0x342,0x345,0x391,0x314,0x342,
+	0x345,0x3b7,0x313,0x345,0x3b7,0x314,0x345,0x3b7,0x313,0x300,0x345,0x3b7,0x314,0x300,0x345,0x3b7,
+	0x313,0x301,0x345,0x3b7,0x314,0x301,0x345,0x3b7,0x313,0x342,0x345,0x3b7,0x314,0x342,0x345,0x397,
+	0x313,0x345,0x397,0x314,0x345,0x397,0x313,0x300,0x345,0x397,0x314,0x300,0x345,0x397,0x313,0x301,
+	0x345,0x397,0x314,0x301,0x345,0x397,0x313,0x342,0x345,0x397,0x314,0x342,0x345,0x3c9,0x313,0x345,
+	0x3c9,0x314,0x345,0x3c9,0x313,0x300,0x345,0x3c9,0x314,0x300,0x345,0x3c9,0x313,0x301,0x345,0x3c9,
+	0x314,0x301,0x345,0x3c9,0x313,0x342,0x345,0x3c9,0x314,0x342,0x345,0x3a9,0x313,0x345,0x3a9,0x314,
+	0x345,0x3a9,0x313,0x300,0x345,0x3a9,0x314,0x300,0x345,0x3a9,0x313,0x301,0x345,0x3a9,0x314,0x301,
+	0x345,0x3a9,0x313,0x342,0x345,0x3a9,0x314,0x342,0x345,0x3b1,0x306,0x3b1,0x304,0x3b1,0x300,0x345,
+	0x3b1,0x345,0x3b1,0x301,0x345,0x3b1,0x342,0x3b1,0x342,0x345,0x391,0x306,0x391,0x304,0x391,0x300,
+	0x391,0x301,0x391,0x345,0x3b9,0xa8,0x342,0x3b7,0x300,0x345,0x3b7,0x345,0x3b7,0x301,0x345,0x3b7,
+	0x342,0x3b7,0x342,0x345,0x395,0x300,0x395,0x301,0x397,0x300,0x397,0x301,0x397,0x345,0x1fbf,0x300,
+	0x1fbf,0x301,0x1fbf,0x342,0x3b9,0x306,0x3b9,0x304,0x3b9,0x308,0x300,0x3b9,0x308,0x301,0x3b9,0x342,
+	0x3b9,0x308,0x342,0x399,0x306,0x399,0x304,0x399,0x300,0x399,0x301,0x1ffe,0x300,0x1ffe,0x301,0x1ffe,
+	0x342,0x3c5,0x306,0x3c5,0x304,0x3c5,0x308,0x300,0x3c5,0x308,0x301,0x3c1,0x313,0x3c1,0x314,0x3c5,
+	0x342,0x3c5,0x308,0x342,0x3a5,0x306,0x3a5,0x304,0x3a5,0x300,0x3a5,0x301,0x3a1,0x314,0xa8,0x300,
+	0xa8,0x301,0x60,0x3c9,0x300,0x345,0x3c9,0x345,0x3c9,0x301,0x345,0x3c9,0x342,0x3c9,0x342,0x345,
+	0x39f,0x300,0x39f,0x301,0x3a9,0x300,0x3a9,0x301,0x3a9,0x345,0xb4,0x2002,0x2003,0x3a9,0x4b,0x41,
+	0x30a,0x2190,0x338,0x2192,0x338,0x2194,0x338,0x21d0,0x338,0x21d4,0x338,0x21d2,0x338,0x2203,0x338,0x2208,
+	0x338,0x220b,0x338,0x2223,0x338,0x2225,0x338,0x223c,0x338,0x2243,0x338,0x2245,0x338,0x2248,0x338,0x3d,
+	0x338,0x2261,0x338,0x224d,0x338,0x3c,0x338,0x3e,0x338,0x2264,0x338,0x2265,0x338,0x2272,0x338,0x2273,
+	0x338,0x2276,0x338,0x2277,0x338,0x227a,0x338,0x227b,0x338,0x2282,0x338,0x2283,0x338,0x2286,0x338,0x2287,
+	0x338,0x22a2,0x338,0x22a8,0x338,0x22a9,0x338,0x22ab,0x338,0x227c,0x338,0x227d,0x338,0x2291,0x338,0x2292,
+	0x338,0x22b2,0x338,0x22b3,0x338,0x22b4,0x338,0x22b5,0x338,0x3008,0x3009,0x2add,0x338,0x304b,0x3099,0x304d,
+	0x3099,0x304f,0x3099,0x3051,0x3099,0x3053,0x3099,0x3055,0x3099,0x3057,0x3099,0x3059,0x3099,0x305b,0x3099,0x305d,
+	0x3099,0x305f,0x3099,0x3061,0x3099,0x3064,0x3099,0x3066,0x3099,0x3068,0x3099,0x306f,0x3099,0x306f,0x309a,0x3072,
+	0x3099,0x3072,0x309a,0x3075,0x3099,0x3075,0x309a,0x3078,0x3099,0x3078,0x309a,0x307b,0x3099,0x307b,0x309a,0x3046,
+	0x3099,0x309d,0x3099,0x30ab,0x3099,0x30ad,0x3099,0x30af,0x3099,0x30b1,0x3099,0x30b3,0x3099,0x30b5,0x3099,0x30b7,
+	0x3099,0x30b9,0x3099,0x30bb,0x3099,0x30bd,0x3099,0x30bf,0x3099,0x30c1,0x3099,0x30c4,0x3099,0x30c6,0x3099,0x30c8,
+	0x3099,0x30cf,0x3099,0x30cf,0x309a,0x30d2,0x3099,0x30d2,0x309a,0x30d5,0x3099,0x30d5,0x309a,0x30d8,0x3099,0x30d8,
+	0x309a,0x30db,0x3099,0x30db,0x309a,0x30a6,0x3099,0x30ef,0x3099,0x30f0,0x3099,0x30f1,0x3099,0x30f2,0x3099,0x30fd,
+	0x3099,0x8c48,0x66f4,0x8eca,0x8cc8,0x6ed1,0x4e32,0x53e5,0x9f9c,0x9f9c,0x5951,0x91d1,0x5587,0x5948,0x61f6,0x7669,
+	0x7f85,0x863f,0x87ba,0x88f8,0x908f,0x6a02,0x6d1b,0x70d9,0x73de,0x843d,0x916a,0x99f1,0x4e82,0x5375,0x6b04,0x721b,
+	0x862d,0x9e1e,0x5d50,0x6feb,0x85cd,0x8964,0x62c9,0x81d8,0x881f,0x5eca,0x6717,0x6d6a,0x72fc,0x90ce,0x4f86,0x51b7,
+	0x52de,0x64c4,0x6ad3,0x7210,0x76e7,0x8001,0x8606,0x865c,0x8def,0x9732,0x9b6f,0x9dfa,0x788c,0x797f,0x7da0,0x83c9,
+	0x9304,0x9e7f,0x8ad6,0x58df,0x5f04,0x7c60,0x807e,0x7262,0x78ca,0x8cc2,0x96f7,0x58d8,0x5c62,0x6a13,0x6dda,0x6f0f,
+	0x7d2f,0x7e37,0x964b,0x52d2,0x808b,0x51dc,0x51cc,0x7a1c,0x7dbe,0x83f1,0x9675,0x8b80,0x62cf,0x6a02,0x8afe,0x4e39,
+	0x5be7,0x6012,0x7387,0x7570,0x5317,0x78fb,0x4fbf,0x5fa9,0x4e0d,0x6ccc,0x6578,0x7d22,0x53c3,0x585e,0x7701,0x8449,
+	0x8aaa,0x6bba,0x8fb0,0x6c88,0x62fe,0x82e5,0x63a0,0x7565,0x4eae,0x5169,0x51c9,0x6881,0x7ce7,0x826f,0x8ad2,0x91cf,
+	0x52f5,0x5442,0x5973,0x5eec,0x65c5,0x6ffe,0x792a,0x95ad,0x9a6a,0x9e97,0x9ece,0x529b,0x66c6,0x6b77,0x8f62,0x5e74,
+	0x6190,0x6200,0x649a,0x6f23,0x7149,0x7489,0x79ca,0x7df4,0x806f,0x8f26,0x84ee,0x9023,0x934a,0x5217,0x52a3,0x54bd,
+	0x70c8,0x88c2,0x8aaa,0x5ec9,0x5ff5,0x637b,0x6bae,0x7c3e,0x7375,0x4ee4,0x56f9,0x5be7,0x5dba,0x601c,0x73b2,0x7469,
+	0x7f9a,0x8046,0x9234,0x96f6,0x9748,0x9818,0x4f8b,0x79ae,0x91b4,0x96b8,0x60e1,0x4e86,0x50da,0x5bee,0x5c3f,0x6599,
+	0x6a02,0x71ce,0x7642,0x84fc,0x907c,0x9f8d,0x6688,0x962e,0x5289,0x677b,0x67f3,0x6d41,0x6e9c,0x7409,0x7559,0x786b,
+	0x7d10,0x985e,0x516d,0x622e,0x9678,0x502b,0x5d19,0x6dea,0x8f2a,0x5f8b,0x6144,0x6817,0x7387,0x9686,0x5229,0x540f,
+	0x5c65,0x6613,0x674e,0x68a8,0x6ce5,0x7406,0x75e2,0x7f79,0x88cf,0x88e1,0x91cc,0x96e2,0x533f,0x6eba,0x541d,0x71d0,
+	0x7498,0x85fa,0x96a3,0x9c57,0x9e9f,0x6797,0x6dcb,0x81e8,0x7acb,0x7b20,0x7c92,0x72c0,0x7099,0x8b58,0x4ec0,0x8336,
+	0x523a,0x5207,0x5ea6,0x62d3,0x7cd6,0x5b85,0x6d1e,0x66b4,0x8f3b,0x884c,0x964d,0x898b,0x5ed3,0x5140,0x55c0,0x585a,
+	0x6674,0x51de,0x732a,0x76ca,0x793c,0x795e,0x7965,0x798f,0x9756,0x7cbe,0x7fbd,0x8612,0x8af8,0x9038,0x90fd,0x98ef,
+	0x98fc,0x9928,0x9db4,0x90de,0x96b7,0x4fae,0x50e7,0x514d,0x52c9,0x52e4,0x5351,0x559d,0x5606,0x5668,0x5840,0x58a8,
+	0x5c64,0x5c6e,0x6094,0x6168,0x618e,0x61f2,0x654f,0x65e2,0x6691,0x6885,0x6d77,0x6e1a,0x6f22,0x716e,0x722b,0x7422,
+	0x7891,0x793e,0x7949,0x7948,0x7950,0x7956,0x795d,0x798d,0x798e,0x7a40,0x7a81,0x7bc0,0x7df4,0x7e09,0x7e41,0x7f72,
+	0x8005,0x81ed,0x8279,0x8279,0x8457,0x8910,0x8996,0x8b01,0x8b39,0x8cd3,0x8d08,0x8fb6,0x9038,0x96e3,0x97ff,0x983b,
+	0x6075,0x242ee,0x8218,0x4e26,0x51b5,0x5168,0x4f80,0x5145,0x5180,0x52c7,0x52fa,0x559d,0x5555,0x5599,0x55e2,0x585a,
+	0x58b3,0x5944,0x5954,0x5a62,0x5b28,0x5ed2,0x5ed9,0x5f69,0x5fad,0x60d8,0x614e,0x6108,0x618e,0x6160,0x61f2,0x6234,
+	0x63c4,0x641c,0x6452,0x6556,0x6674,0x6717,0x671b,0x6756,0x6b79,0x6bba,0x6d41,0x6edb,0x6ecb,0x6f22,0x701e,0x716e,
+	0x77a7,0x7235,0x72af,0x732a,0x7471,0x7506,0x753b,0x761d,0x761f,0x76ca,0x76db,0x76f4,0x774a,0x7740,0x78cc,0x7ab1,
+	0x7bc0,0x7c7b,0x7d5b,0x7df4,0x7f3e,0x8005,0x8352,0x83ef,0x8779,0x8941,0x8986,0x8996,0x8abf,0x8af8,0x8acb,0x8b01,
+	0x8afe,0x8aed,0x8b39,0x8b8a,0x8d08,0x8f38,0x9072,0x9199,0x9276,0x967c,0x96e3,0x9756,0x97db,0x97ff,0x980b,0x983b,
+	0x9b12,0x9f9c,0x2284a,0x22844,0x233d5,0x3b9d,0x4018,0x4039,0x25249,0x25cd0,0x27ed3,0x9f43,0x9f8e,0x5d9,0x5b4,0x5f2,
+	0x5b7,0x5e9,0x5c1,0x5e9,0x5c2,0x5e9,0x5bc,0x5c1,0x5e9,0x5bc,0x5c2,0x5d0,0x5b7,0x5d0,0x5b8,0x5d0,
+	0x5bc,0x5d1,0x5bc,0x5d2,0x5bc,0x5d3,0x5bc,0x5d4,0x5bc,0x5d5,0x5bc,0x5d6,0x5bc,0x5d8,0x5bc,0x5d9,
+	0x5bc,0x5da,0x5bc,0x5db,0x5bc,0x5dc,0x5bc,0x5de,0x5bc,0x5e0,0x5bc,0x5e1,0x5bc,0x5e3,0x5bc,0x5e4,
+	0x5bc,0x5e6,0x5bc,0x5e7,0x5bc,0x5e8,0x5bc,0x5e9,0x5bc,0x5ea,0x5bc,0x5d5,0x5b9,0x5d1,0x5bf,0x5db,
+	0x5bf,0x5e4,0x5bf,0x11099,0x110ba,0x1109b,0x110ba,0x110a5,0x110ba,0x11131,0x11127,0x11132,0x11127,0x11347,0x1133e,0x11347,
+	0x11357,0x114b9,0x114ba,0x114b9,0x114b0,0x114b9,0x114bd,0x115b8,0x115af,0x115b9,0x115af,0x11935,0x11930,0x1d157,0x1d165,0x1d158,
+	0x1d165,0x1d158,0x1d165,0x1d16e,0x1d158,0x1d165,0x1d16f,0x1d158,0x1d165,0x1d170,0x1d158,0x1d165,0x1d171,0x1d158,0x1d165,0x1d172,
+	0x1d1b9,0x1d165,0x1d1ba,0x1d165,0x1d1b9,0x1d165,0x1d16e,0x1d1ba,0x1d165,0x1d16e,0x1d1b9,0x1d165,0x1d16f,0x1d1ba,0x1d165,0x1d16f,
+	0x4e3d,0x4e38,0x4e41,0x20122,0x4f60,0x4fae,0x4fbb,0x5002,0x507a,0x5099,0x50e7,0x50cf,0x349e,0x2063a,0x514d,0x5154,
+	0x5164,0x5177,0x2051c,0x34b9,0x5167,0x518d,0x2054b,0x5197,0x51a4,0x4ecc,0x51ac,0x51b5,0x291df,0x51f5,0x5203,0x34df,
+	0x523b,0x5246,0x5272,0x5277,0x3515,0x52c7,0x52c9,0x52e4,0x52fa,0x5305,0x5306,0x5317,0x5349,0x5351,0x535a,0x5373,
+	0x537d,0x537f,0x537f,0x537f,0x20a2c,0x7070,0x53ca,0x53df,0x20b63,0x53eb,0x53f1,0x5406,0x549e,0x5438,0x5448,0x5468,
+	0x54a2,0x54f6,0x5510,0x5553,0x5563,0x5584,0x5584,0x5599,0x55ab,0x55b3,0x55c2,0x5716,0x5606,0x5717,0x5651,0x5674,
+	0x5207,0x58ee,0x57ce,0x57f4,0x580d,0x578b,0x5832,0x5831,0x58ac,0x214e4,0x58f2,0x58f7,0x5906,0x591a,0x5922,0x5962,
+	0x216a8,0x216ea,0x59ec,0x5a1b,0x5a27,0x59d8,0x5a66,0x36ee,0x36fc,0x5b08,0x5b3e,0x5b3e,0x219c8,0x5bc3,0x5bd8,0x5be7,
+	0x5bf3,0x21b18,0x5bff,0x5c06,0x5f53,0x5c22,0x3781,0x5c60,0x5c6e,0x5cc0,0x5c8d,0x21de4,0x5d43,0x21de6,0x5d6e,0x5d6b,
+	0x5d7c,0x5de1,0x5de2,0x382f,0x5dfd,0x5e28,0x5e3d,0x5e69,0x3862,0x22183,0x387c,0x5eb0,0x5eb3,0x5eb6,0x5eca,0x2a392,
+	0x5efe,0x22331,0x22331,0x8201,0x5f22,0x5f22,0x38c7,0x232b8,0x261da,0x5f62,0x5f6b,0x38e3,0x5f9a,0x5fcd,0x5fd7,0x5ff9,
+	0x6081,0x393a,0x391c,0x6094,0x226d4,0x60c7,0x6148,0x614c,0x614e,0x614c,0x617a,0x618e,0x61b2,0x61a4,0x61af,0x61de,
+	0x61f2,0x61f6,0x6210,0x621b,0x625d,0x62b1,0x62d4,0x6350,0x22b0c,0x633d,0x62fc,0x6368,0x6383,0x63e4,0x22bf1,0x6422,
+	0x63c5,0x63a9,0x3a2e,0x6469,0x647e,0x649d,0x6477,0x3a6c,0x654f,0x656c,0x2300a,0x65e3,0x66f8,0x6649,0x3b19,0x6691,
+	0x3b08,0x3ae4,0x5192,0x5195,0x6700,0x669c,0x80ad,0x43d9,0x6717,0x671b,0x6721,0x675e,0x6753,0x233c3,0x3b49,0x67fa,
+	0x6785,0x6852,0x6885,0x2346d,0x688e,0x681f,0x6914,0x3b9d,0x6942,0x69a3,0x69ea,0x6aa8,0x236a3,0x6adb,0x3c18,0x6b21,
+	0x238a7,0x6b54,0x3c4e,0x6b72,0x6b9f,0x6bba,0x6bbb,0x23a8d,0x21d0b,0x23afa,0x6c4e,0x23cbc,0x6cbf,0x6ccd,0x6c67,0x6d16,
+	0x6d3e,0x6d77,0x6d41,0x6d69,0x6d78,0x6d85,0x23d1e,0x6d34,0x6e2f,0x6e6e,0x3d33,0x6ecb,0x6ec7,0x23ed1,0x6df9,0x6f6e,
+	0x23f5e,0x23f8e,0x6fc6,0x7039,0x701e,0x701b,0x3d96,0x704a,0x707d,0x7077,0x70ad,0x20525,0x7145,0x24263,0x719c,0x243ab,
+	0x7228,0x7235,0x7250,0x24608,0x7280,0x7295,0x24735,0x24814,0x737a,0x738b,0x3eac,0x73a5,0x3eb8,0x3eb8,0x7447,0x745c,
+	0x7471,0x7485,0x74ca,0x3f1b,0x7524,0x24c36,0x753e,0x24c92,0x7570,0x2219f,0x7610,0x24fa1,0x24fb8,0x25044,0x3ffc,0x4008,
+	0x76f4,0x250f3,0x250f2,0x25119,0x25133,0x771e,0x771f,0x771f,0x774a,0x4039,0x778b,0x4046,0x4096,0x2541d,0x784e,0x788c,
+	0x78cc,0x40e3,0x25626,0x7956,0x2569a,0x256c5,0x798f,0x79eb,0x412f,0x7a40,0x7a4a,0x7a4f,0x2597c,0x25aa7,0x25aa7,0x7aee,
+	0x4202,0x25bab,0x7bc6,0x7bc9,0x4227,0x25c80,0x7cd2,0x42a0,0x7ce8,0x7ce3,0x7d00,0x25f86,0x7d63,0x4301,0x7dc7,0x7e02,
+	0x7e45,0x4334,0x26228,0x26247,0x4359,0x262d9,0x7f7a,0x2633e,0x7f95,0x7ffa,0x8005,0x264da,0x26523,0x8060,0x265a8,0x8070,
+	0x2335f,0x43d5,0x80b2,0x8103,0x440b,0x813e,0x5ab5,0x267a7,0x267b5,0x23393,0x2339c,0x8201,0x8204,0x8f9e,0x446b,0x8291,
+	0x828b,0x829d,0x52b3,0x82b1,0x82b3,0x82bd,0x82e6,0x26b3c,0x82e5,0x831d,0x8363,0x83ad,0x8323,0x83bd,0x83e7,0x8457,
+	0x8353,0x83ca,0x83cc,0x83dc,0x26c36,0x26d6b,0x26cd5,0x452b,0x84f1,0x84f3,0x8516,0x273ca,0x8564,0x26f2c,0x455d,0x4561,
+	0x26fb1,0x270d2,0x456b,0x8650,0x865c,0x8667,0x8669,0x86a9,0x8688,0x870e,0x86e2,0x8779,0x8728,0x876b,0x8786,0x45d7,
+	0x87e1,0x8801,0x45f9,0x8860,0x8863,0x27667,0x88d7,0x88de,0x4635,0x88fa,0x34bb,0x278ae,0x27966,0x46be,0x46c7,0x8aa0,
+	0x8aed,0x8b8a,0x8c55,0x27ca8,0x8cab,0x8cc1,0x8d1b,0x8d77,0x27f2f,0x20804,0x8dcb,0x8dbc,0x8df0,0x208de,0x8ed4,0x8f38,
+	0x285d2,0x285ed,0x9094,0x90f1,0x9111,0x2872e,0x911b,0x9238,0x92d7,0x92d8,0x927c,0x93f9,0x9415,0x28bfa,0x958b,0x4995,
+	0x95b7,0x28d77,0x49e6,0x96c3,0x5db2,0x9723,0x29145,0x2921a,0x4a6e,0x4a76,0x97e0,0x2940a,0x4ab2,0x29496,0x980b,0x980b,
+	0x9829,0x295b6,0x98e2,0x4b33,0x9929,0x99a7,0x99c2,0x99fe,0x4bce,0x29b30,0x9b12,0x9c40,0x9cfd,0x4cce,0x4ced,0x9d67,
+	0x2a0ce,0x4cf8,0x2a105,0x2a20e,0x2a291,0x9ebb,0x4d56,0x9ef9,0x9efe,0x9f05,0x9f0f,0x9f16,0x9f3b,0x2a600
+};
+
+/**
+ * The sorted pairs of code points that compose, as first << 21 | second
+ */
+static const unsigned long long normalizationCompositionPairs[NORMALIZATION_COMPOSITIONS] = {
+	0x7800338ULL,0x7a00338ULL,0x7c00338ULL,0x8200300ULL,0x8200301ULL,0x8200302ULL,0x8200303ULL,0x8200304ULL,
+	0x8200306ULL,0x8200307ULL,0x8200308ULL,0x8200309ULL,0x820030aULL,0x820030cULL,0x820030fULL,0x8200311ULL,
+	0x8200323ULL,0x8200325ULL,0x8200328ULL,0x8400307ULL,0x8400323ULL,0x8400331ULL,0x8600301ULL,0x8600302ULL,
+	0x8600307ULL,0x860030cULL,0x8600327ULL,0x8800307ULL,0x880030cULL,0x8800323ULL,0x8800327ULL,0x880032dULL,
+	0x8800331ULL,0x8a00300ULL,0x8a00301ULL,0x8a00302ULL,0x8a00303ULL,0x8a00304ULL,0x8a00306ULL,0x8a00307ULL,
+	0x8a00308ULL,0x8a00309ULL,0x8a0030cULL,0x8a0030fULL,0x8a00311ULL,0x8a00323ULL,0x8a00327ULL,0x8a00328ULL,
+	0x8a0032dULL,0x8a00330ULL,0x8c00307ULL,0x8e00301ULL,0x8e00302ULL,0x8e00304ULL,0x8e00306ULL,0x8e00307ULL,
+	0x8e0030cULL,0x8e00327ULL,0x9000302ULL,0x9000307ULL,0x9000308ULL,0x900030cULL,0x9000323ULL,0x9000327ULL,
+	0x900032eULL,0x9200300ULL,0x9200301ULL,0x9200302ULL,0x9200303ULL,0x9200304ULL,0x9200306ULL,0x9200307ULL,
+	0x9200308ULL,0x9200309ULL,0x920030cULL,0x920030fULL,0x9200311ULL,0x9200323ULL,0x9200328ULL,0x9200330ULL,
+	0x9400302ULL,0x9600301ULL,0x960030cULL,0x9600323ULL,0x9600327ULL,0x9600331ULL,0x9800301ULL,0x980030cULL,
+	0x9800323ULL,0x9800327ULL,0x980032dULL,0x9800331ULL,0x9a00301ULL,0x9a00307ULL,0x9a00323ULL,0x9c00300ULL,
+	0x9c00301ULL,0x9c00303ULL,0x9c00307ULL,0x9c0030cULL,0x9c00323ULL,0x9c00327ULL,0x9c0032dULL,0x9c00331ULL,
+	0x9e00300ULL,0x9e00301ULL,0x9e00302ULL,0x9e00303ULL,0x9e00304ULL,0x9e00306ULL,0x9e00307ULL,0x9e00308ULL,
+	0x9e00309ULL,0x9e0030bULL,0x9e0030cULL,0x9e0030fULL,0x9e00311ULL,0x9e0031bULL,0x9e00323ULL,0x9e00328ULL,
+	0xa000301ULL,0xa000307ULL,0xa400301ULL,0xa400307ULL,0xa40030cULL,0xa40030fULL,0xa400311ULL,0xa400323ULL,
+	0xa400327ULL,0xa400331ULL,0xa600301ULL,0xa600302ULL,0xa600307ULL,0xa60030cULL,0xa600323ULL,0xa600326ULL,
+	0xa600327ULL,0xa800307ULL,0xa80030cULL,0xa800323ULL,0xa800326ULL,0xa800327ULL,0xa80032dULL,0xa800331ULL,
+	0xaa00300ULL,0xaa00301ULL,0xaa00302ULL,0xaa00303ULL,0xaa00304ULL,0xaa00306ULL,0xaa00308ULL,0xaa00309ULL,
+	0xaa0030aULL,0xaa0030bULL,0xaa0030cULL,0xaa0030fULL,0xaa00311ULL,0xaa0031bULL,0xaa00323ULL,0xaa00324ULL,
+	0xaa00328ULL,0xaa0032dULL,0xaa00330ULL,0xac00303ULL,0xac00323ULL,0xae00300ULL,0xae00301ULL,0xae00302ULL,
+	0xae00307ULL,0xae00308ULL,0xae00323ULL,0xb000307ULL,0xb000308ULL,0xb200300ULL,0xb200301ULL,0xb200302ULL,
+	0xb200303ULL,0xb200304ULL,0xb200307ULL,0xb200308ULL,0xb200309ULL,0xb200323ULL,0xb400301ULL,0xb400302ULL,
+	0xb400307ULL,0xb40030cULL,0xb400323ULL,0xb400331ULL,0xc200300ULL,0xc200301ULL,0xc200302ULL,0xc200303ULL,
+	0xc200304ULL,0xc200306ULL,0xc200307ULL,0xc200308ULL,0xc200309ULL,0xc20030aULL,0xc20030cULL,0xc20030fULL,
+	0xc200311ULL,0xc200323ULL,0xc200325ULL,0xc200328ULL,0xc400307ULL,0xc400323ULL,0xc400331ULL,0xc600301ULL,
+	0xc600302ULL,0xc600307ULL,0xc60030cULL,0xc600327ULL,0xc800307ULL,0xc80030cULL,0xc800323ULL,0xc800327ULL,
+	0xc80032dULL,0xc800331ULL,0xca00300ULL,0xca00301ULL,0xca00302ULL,0xca00303ULL,0xca00304ULL,0xca00306ULL,
+	0xca00307ULL,0xca00308ULL,0xca00309ULL,0xca0030cULL,0xca0030fULL,0xca00311ULL,0xca00323ULL,0xca00327ULL,
+	0xca00328ULL,0xca0032dULL,0xca00330ULL,0xcc00307ULL,0xce00301ULL,0xce00302ULL,0xce00304ULL,0xce00306ULL,
+	0xce00307ULL,0xce0030cULL,0xce00327ULL,0xd000302ULL,0xd000307ULL,0xd000308ULL,0xd00030cULL,0xd000323ULL,
+	0xd000327ULL,0xd00032eULL,0xd000331ULL,0xd200300ULL,0xd200301ULL,0xd200302ULL,0xd200303ULL,0xd200304ULL,
+	0xd200306ULL,0xd200308ULL,0xd200309ULL,0xd20030cULL,0xd20030fULL,0xd200311ULL,0xd200323ULL,0xd200328ULL,
+	0xd200330ULL,0xd400302ULL,0xd40030cULL,0xd600301ULL,0xd60030cULL,0xd600323ULL,0xd600327ULL,0xd600331ULL,
+	0xd800301ULL,0xd80030cULL,0xd800323ULL,0xd800327ULL,0xd80032dULL,0xd800331ULL,0xda00301ULL,0xda00307ULL,
+	0xda00323ULL,0xdc00300ULL,0xdc00301ULL,0xdc00303ULL,0xdc00307ULL,0xdc0030cULL,0xdc00323ULL,0xdc00327ULL,
+	0xdc0032dULL,0xdc00331ULL,0xde00300ULL,0xde00301ULL,0xde00302ULL,0xde00303ULL,0xde00304ULL,0xde00306ULL,
+	0xde00307ULL,0xde00308ULL,0xde00309ULL,0xde0030bULL,0xde0030cULL,0xde0030fULL,0xde00311ULL,0xde0031bULL,
+	0xde00323ULL,0xde00328ULL,0xe000301ULL,0xe000307ULL,0xe400301ULL,0xe400307ULL,0xe40030cULL,0xe40030fULL,
+	0xe400311ULL,0xe400323ULL,0xe400327ULL,0xe400331ULL,0xe600301ULL,0xe600302ULL,0xe600307ULL,0xe60030cULL,
+	0xe600323ULL,0xe600326ULL,0xe600327ULL,0xe800307ULL,0xe800308ULL,0xe80030cULL,0xe800323ULL,0xe800326ULL,
+	0xe800327ULL,0xe80032dULL,0xe800331ULL,0xea00300ULL,0xea00301ULL,0xea00302ULL,0xea00303ULL,0xea00304ULL,
+	0xea00306ULL,0xea00308ULL,0xea00309ULL,0xea0030aULL,0xea0030bULL,0xea0030cULL,0xea0030fULL,0xea00311ULL,
+	0xea0031bULL,0xea00323ULL,0xea00324ULL,0xea00328ULL,0xea0032dULL,0xea00330ULL,0xec00303ULL,0xec00323ULL,
+	0xee00300ULL,0xee00301ULL,0xee00302ULL,0xee00307ULL,0xee00308ULL,0xee0030aULL,0xee00323ULL,0xf000307ULL,
+	0xf000308ULL,0xf200300ULL,0xf200301ULL,0xf200302ULL,0xf200303ULL,0xf200304ULL,0xf200307ULL,0xf200308ULL,
+	0xf200309ULL,0xf20030aULL,0xf200323ULL,0xf400301ULL,0xf400302ULL,0xf400307ULL,0xf40030cULL,0xf400323ULL,
+	0xf400331ULL,0x15000300ULL,0x15000301ULL,0x15000342ULL,0x18400300ULL,0x18400301ULL,0x18400303ULL,0x18400309ULL,
+	0x18800304ULL,0x18a00301ULL,0x18c00301ULL,0x18c00304ULL,0x18e00301ULL,0x19400300ULL,0x19400301ULL,0x19400303ULL,
+	0x19400309ULL,0x19e00301ULL,0x1a800300ULL,0x1a800301ULL,0x1a800303ULL,0x1a800309ULL,0x1aa00301ULL,0x1aa00304ULL,
+	0x1aa00308ULL,0x1ac00304ULL,0x1b000301ULL,0x1b800300ULL,0x1b800301ULL,0x1b800304ULL,0x1b80030cULL,0x1c400300ULL,
+	0x1c400301ULL,0x1c400303ULL,0x1c400309ULL,0x1c800304ULL,0x1ca00301ULL,0x1cc00301ULL,0x1cc00304ULL,0x1ce00301ULL,
+	0x1d400300ULL,0x1d400301ULL,0x1d400303ULL,0x1d400309ULL,0x1de00301ULL,0x1e800300ULL,0x1e800301ULL,0x1e800303ULL,
+	0x1e800309ULL,0x1ea00301ULL,0x1ea00304ULL,0x1ea00308ULL,0x1ec00304ULL,0x1f000301ULL,0x1f800300ULL,0x1f800301ULL,
+	0x1f800304ULL,0x1f80030cULL,0x20400300ULL,0x20400301ULL,0x20400303ULL,0x20400309ULL,0x20600300ULL,0x20600301ULL,
+	0x20600303ULL,0x20600309ULL,0x22400300ULL,0x22400301ULL,0x22600300ULL,0x22600301ULL,0x29800300ULL,0x29800301ULL,
+	0x29a00300ULL,0x29a00301ULL,0x2b400307ULL,0x2b600307ULL,0x2c000307ULL,0x2c200307ULL,0x2d000301ULL,0x2d200301ULL,
+	0x2d400308ULL,0x2d600308ULL,0x2fe00307ULL,0x34000300ULL,0x34000301ULL,0x34000303ULL,0x34000309ULL,0x34000323ULL,
+	0x34200300ULL,0x34200301ULL,0x34200303ULL,0x34200309ULL,0x34200323ULL,0x35e00300ULL,0x35e00301ULL,0x35e00303ULL,
+	0x35e00309ULL,0x35e00323ULL,0x36000300ULL,0x36000301ULL,0x36000303ULL,0x36000309ULL,0x36000323ULL,0x36e0030cULL,
+	0x3d400304ULL,0x3d600304ULL,0x44c00304ULL,0x44e00304ULL,0x45000306ULL,0x45200306ULL,0x45c00304ULL,0x45e00304ULL,
+	0x5240030cULL,0x72200300ULL,0x72200301ULL,0x72200304ULL,0x72200306ULL,0x72200313ULL,0x72200314ULL,0x72200345ULL,
+	0x72a00300ULL,0x72a00301ULL,0x72a00313ULL,0x72a00314ULL,0x72e00300ULL,0x72e00301ULL,0x72e00313ULL,0x72e00314ULL,
+	0x72e00345ULL,0x73200300ULL,0x73200301ULL,0x73200304ULL,0x73200306ULL,0x73200308ULL,0x73200313ULL,0x73200314ULL,
+	0x73e00300ULL,0x73e00301ULL,0x73e00313ULL,0x73e00314ULL,0x74200314ULL,0x74a00300ULL,0x74a00301ULL,0x74a00304ULL,
+	0x74a00306ULL,0x74a00308ULL,0x74a00314ULL,0x75200300ULL,0x75200301ULL,0x75200313ULL,0x75200314ULL,0x75200345ULL,
+	0x75800345ULL,0x75c00345ULL,0x76200300ULL,0x76200301ULL,0x76200304ULL,0x76200306ULL,0x76200313ULL,0x76200314ULL,
+	0x76200342ULL,0x76200345ULL,0x76a00300ULL,0x76a00301ULL,0x76a00313ULL,0x76a00314ULL,0x76e00300ULL,0x76e00301ULL,
+	0x76e00313ULL,0x76e00314ULL,0x76e00342ULL,0x76e00345ULL,0x77200300ULL,0x77200301ULL,0x77200304ULL,0x77200306ULL,
+	0x77200308ULL,0x77200313ULL,0x77200314ULL,0x77200342ULL,0x77e00300ULL,0x77e00301ULL,0x77e00313ULL,0x77e00314ULL,
+	0x78200313ULL,0x78200314ULL,0x78a00300ULL,0x78a00301ULL,0x78a00304ULL,0x78a00306ULL,0x78a00308ULL,0x78a00313ULL,
+	0x78a00314ULL,0x78a00342ULL,0x79200300ULL,0x79200301ULL,0x79200313ULL,0x79200314ULL,0x79200342ULL,0x79200345ULL,
+	0x79400300ULL,0x79400301ULL,0x79400342ULL,0x79600300ULL,0x79600301ULL,0x79600342ULL,0x79c00345ULL,0x7a400301ULL,
+	0x7a400308ULL,0x80c00308ULL,0x82000306ULL,0x82000308ULL,0x82600301ULL,0x82a00300ULL,0x82a00306ULL,0x82a00308ULL,
+	0x82c00306ULL,0x82c00308ULL,0x82e00308ULL,0x83000300ULL,0x83000304ULL,0x83000306ULL,0x83000308ULL,0x83400301ULL,
+	0x83c00308ULL,0x84600304ULL,0x84600306ULL,0x84600308ULL,0x8460030bULL,0x84e00308ULL,0x85600308ULL,0x85a00308ULL,
+	0x86000306ULL,0x86000308ULL,0x86600301ULL,0x86a00300ULL,0x86a00306ULL,0x86a00308ULL,0x86c00306ULL,0x86c00308ULL,
+	0x86e00308ULL,0x87000300ULL,0x87000304ULL,0x87000306ULL,0x87000308ULL,0x87400301ULL,0x87c00308ULL,0x88600304ULL,
+	0x88600306ULL,0x88600308ULL,0x8860030bULL,0x88e00308ULL,0x89600308ULL,0x89a00308ULL,0x8ac00308ULL,0x8e80030fULL,
+	0x8ea0030fULL,0x9b000308ULL,0x9b200308ULL,0x9d000308ULL,0x9d200308ULL,0xc4e00653ULL,0xc4e00654ULL,0xc4e00655ULL,
+	0xc9000654ULL,0xc9400654ULL,0xd8200654ULL,0xda400654ULL,0xdaa00654ULL,0x12500093cULL,0x12600093cULL,0x12660093cULL,
+	0x138e009beULL,0x138e009d7ULL,0x168e00b3eULL,0x168e00b56ULL,0x168e00b57ULL,0x172400bd7ULL,0x178c00bbeULL,0x178c00bd7ULL,
+	0x178e00bbeULL,0x188c00c56ULL,0x197e00cd5ULL,0x198c00cc2ULL,0x198c00cd5ULL,0x198c00cd6ULL,0x199400cd5ULL,0x1a8c00d3eULL,
+	0x1a8c00d57ULL,0x1a8e00d3eULL,0x1bb200dcaULL,0x1bb200dcfULL,0x1bb200ddfULL,0x1bb800dcaULL,0x204a0102eULL,0x360a01b35ULL,
+	0x360e01b35ULL,0x361201b35ULL,0x361601b35ULL,0x361a01b35ULL,0x362201b35ULL,0x367401b35ULL,0x367801b35ULL,0x367c01b35ULL,
+	0x367e01b35ULL,0x368401b35ULL,0x3c6c00304ULL,0x3c6e00304ULL,0x3cb400304ULL,0x3cb600304ULL,0x3cc400307ULL,0x3cc600307ULL,
+	0x3d4000302ULL,0x3d4000306ULL,0x3d4200302ULL,0x3d4200306ULL,0x3d7000302ULL,0x3d7200302ULL,0x3d9800302ULL,0x3d9a00302ULL,
+	0x3e0000300ULL,0x3e0000301ULL,0x3e0000342ULL,0x3e0000345ULL,0x3e0200300ULL,0x3e0200301ULL,0x3e0200342ULL,0x3e0200345ULL,
+	0x3e0400345ULL,0x3e0600345ULL,0x3e0800345ULL,0x3e0a00345ULL,0x3e0c00345ULL,0x3e0e00345ULL,0x3e1000300ULL,0x3e1000301ULL,
+	0x3e1000342ULL,0x3e1000345ULL,0x3e1200300ULL,0x3e1200301ULL,0x3e1200342ULL,0x3e1200345ULL,0x3e1400345ULL,0x3e1600345ULL,
+	0x3e1800345ULL,0x3e1a00345ULL,0x3e1c00345ULL,0x3e1e00345ULL,0x3e2000300ULL,0x3e2000301ULL,0x3e2200300ULL,0x3e2200301ULL,
+	0x3e3000300ULL,0x3e3000301ULL,0x3e3200300ULL,0x3e3200301ULL,0x3e4000300ULL,0x3e4000301ULL,0x3e4000342ULL,0x3e4000345ULL,
+	0x3e4200300ULL,0x3e4200301ULL,0x3e4200342ULL,0x3e4200345ULL,0x3e4400345ULL,0x3e4600345ULL,0x3e4800345ULL,0x3e4a00345ULL,
+	0x3e4c00345ULL,0x3e4e00345ULL,0x3e5000300ULL,0x3e5000301ULL,0x3e5000342ULL,0x3e5000345ULL,0x3e5200300ULL,0x3e5200301ULL,
+	0x3e5200342ULL,0x3e5200345ULL,0x3e5400345ULL,0x3e5600345ULL,0x3e5800345ULL,0x3e5a00345ULL,0x3e5c00345ULL,0x3e5e00345ULL,
+	0x3e6000300ULL,0x3e6000301ULL,0x3e6000342ULL,0x3e6200300ULL,0x3e6200301ULL,0x3e6200342ULL,0x3e7000300ULL,0x3e7000301ULL,
+	0x3e7000342ULL,0x3e7200300ULL,0x3e7200301ULL,0x3e7200342ULL,0x3e8000300ULL,0x3e8000301ULL,0x3e8200300ULL,0x3e8200301ULL,
+	0x3e9000300ULL,0x3e9000301ULL,0x3e9200300ULL,0x3e9200301ULL,0x3ea000300ULL,0x3ea000301ULL,0x3ea000342ULL,0x3ea200300ULL,
+	0x3ea200301ULL,0x3ea200342ULL,0x3eb200300ULL,0x3eb200301ULL,0x3eb200342ULL,0x3ec000300ULL,0x3ec000301ULL,0x3ec000342ULL,
+	0x3ec000345ULL,0x3ec200300ULL,0x3ec200301ULL,0x3ec200342ULL,0x3ec200345ULL,0x3ec400345ULL,0x3ec600345ULL,0x3ec800345ULL,
+	0x3eca00345ULL,0x3ecc00345ULL,0x3ece00345ULL,0x3ed000300ULL,0x3ed000301ULL,0x3ed000342ULL,0x3ed000345ULL,0x3ed200300ULL,
+	0x3ed200301ULL,0x3ed200342ULL,0x3ed200345ULL,0x3ed400345ULL,0x3ed600345ULL,0x3ed800345ULL,0x3eda00345ULL,0x3edc00345ULL,
+	0x3ede00345ULL,0x3ee000345ULL,0x3ee800345ULL,0x3ef800345ULL,0x3f6c00345ULL,0x3f7e00300ULL,0x3f7e00301ULL,0x3f7e00342ULL,
+	0x3f8c00345ULL,0x3fec00345ULL,0x3ffc00300ULL,0x3ffc00301ULL,0x3ffc00342ULL,0x432000338ULL,0x432400338ULL,0x432800338ULL,
+	0x43a000338ULL,0x43a400338ULL,0x43a800338ULL,0x440600338ULL,0x441000338ULL,0x441600338ULL,0x444600338ULL,0x444a00338ULL,
+	0x447800338ULL,0x448600338ULL,0x448a00338ULL,0x449000338ULL,0x449a00338ULL,0x44c200338ULL,0x44c800338ULL,0x44ca00338ULL,
+	0x44e400338ULL,0x44e600338ULL,0x44ec00338ULL,0x44ee00338ULL,0x44f400338ULL,0x44f600338ULL,0x44f800338ULL,0x44fa00338ULL,
+	0x450400338ULL,0x450600338ULL,0x450c00338ULL,0x450e00338ULL,0x452200338ULL,0x452400338ULL,0x454400338ULL,0x455000338ULL,
+	0x455200338ULL,0x455600338ULL,0x456400338ULL,0x456600338ULL,0x456800338ULL,0x456a00338ULL,0x608c03099ULL,0x609603099ULL,
+	0x609a03099ULL,0x609e03099ULL,0x60a203099ULL,0x60a603099ULL,0x60aa03099ULL,0x60ae03099ULL,0x60b203099ULL,0x60b603099ULL,
+	0x60ba03099ULL,0x60be03099ULL,0x60c203099ULL,0x60c803099ULL,0x60cc03099ULL,0x60d003099ULL,0x60de03099ULL,0x60de0309aULL,
+	0x60e403099ULL,0x60e40309aULL,0x60ea03099ULL,0x60ea0309aULL,0x60f003099ULL,0x60f00309aULL,0x60f603099ULL,0x60f60309aULL,
+	0x613a03099ULL,0x614c03099ULL,0x615603099ULL,0x615a03099ULL,0x615e03099ULL,0x616203099ULL,0x616603099ULL,0x616a03099ULL,
+	0x616e03099ULL,0x617203099ULL,0x617603099ULL,0x617a03099ULL,0x617e03099ULL,0x618203099ULL,0x618803099ULL,0x618c03099ULL,
+	0x619003099ULL,0x619e03099ULL,0x619e0309aULL,0x61a403099ULL,0x61a40309aULL,0x61aa03099ULL,0x61aa0309aULL,0x61b003099ULL,
+	0x61b00309aULL,0x61b603099ULL,0x61b60309aULL,0x61de03099ULL,0x61e003099ULL,0x61e203099ULL,0x61e403099ULL,0x61fa03099ULL,
+	0x22132110baULL,0x22136110baULL,0x2214a110baULL,0x2226211127ULL,0x2226411127ULL,0x2268e1133eULL,0x2268e11357ULL,0x22972114b0ULL,
+	0x22972114baULL,0x22972114bdULL,0x22b70115afULL,0x22b72115afULL,0x2326a11930ULL
+};
+
+/**
+ * The primary composite of each pair of normalizationCompositionPairs
+ */
+static const unsigned int normalizationComposites[NORMALIZATION_COMPOSITIONS] = {
+	0x226e,0x2260,0x226f,0xc0,0xc1,0xc2,0xc3,0x100,0x102,0x226,0xc4,0x1ea2,0xc5,0x1cd,0x200,0x202,
+	0x1ea0,0x1e00,0x104,0x1e02,0x1e04,0x1e06,0x106,0x108,0x10a,0x10c,0xc7,0x1e0a,0x10e,0x1e0c,0x1e10,0x1e12,
+	0x1e0e,0xc8,0xc9,0xca,0x1ebc,0x112,0x114,0x116,0xcb,0x1eba,0x11a,0x204,0x206,0x1eb8,0x228,0x118,
+	0x1e18,0x1e1a,0x1e1e,0x1f4,0x11c,0x1e20,0x11e,0x120,0x1e6,0x122,0x124,0x1e22,0x1e26,0x21e,0x1e24,0x1e28,
+	0x1e2a,0xcc,0xcd,0xce,0x128,0x12a,0x12c,0x130,0xcf,0x1ec8,0x1cf,0x208,0x20a,0x1eca,0x12e,0x1e2c,
+	0x134,0x1e30,0x1e8,0x1e32,0x136,0x1e34,0x139,0x13d,0x1e36,0x13b,0x1e3c,0x1e3a,0x1e3e,0x1e40,0x1e42,0x1f8,
+	0x143,0xd1,0x1e44,0x147,0x1e46,0x145,0x1e4a,0x1e48,0xd2,0xd3,0xd4,0xd5,0x14c,0x14e,0x22e,0xd6,
+	0x1ece,0x150,0x1d1,0x20c,0x20e,0x1a0,0x1ecc,0x1ea,0x1e54,0x1e56,0x154,0x1e58,0x158,0x210,0x212,0x1e5a,
+	0x156,0x1e5e,0x15a,0x15c,0x1e60,0x160,0x1e62,0x218,0x15e,0x1e6a,0x164,0x1e6c,0x21a,0x162,0x1e70,0x1e6e,
+	0xd9,0xda,0xdb,0x168,0x16a,0x16c,0xdc,0x1ee6,0x16e,0x170,0x1d3,0x214,0x216,0x1af,0x1ee4,0x1e72,
+	0x172,0x1e76,0x1e74,0x1e7c,0x1e7e,0x1e80,0x1e82,0x174,0x1e86,0x1e84,0x1e88,0x1e8a,0x1e8c,0x1ef2,0xdd,0x176,
+	0x1ef8,0x232,0x1e8e,0x178,0x1ef6,0x1ef4,0x179,0x1e90,0x17b,0x17d,0x1e92,0x1e94,0xe0,0xe1,0xe2,0xe3,
+	0x101,0x103,0x227,0xe4,0x1ea3,0xe5,0x1ce,0x201,0x203,0x1ea1,0x1e01,0x105,0x1e03,0x1e05,0x1e07,0x107,
+	0x109,0x10b,0x10d,0xe7,0x1e0b,0x10f,0x1e0d,0x1e11,0x1e13,0x1e0f,0xe8,0xe9,0xea,0x1ebd,0x113,0x115,
+	0x117,0xeb,0x1ebb,0x11b,0x205,0x207,0x1eb9,0x229,0x119,0x1e19,0x1e1b,0x1e1f,0x1f5,0x11d,0x1e21,0x11f,
+	0x121,0x1e7,0x123,0x125,0x1e23,0x1e27,0x21f,0x1e25,0x1e29,0x1e2b,0x1e96,0xec,0xed,0xee,0x129,0x12b,
+	0x12d,0xef,0x1ec9,0x1d0,0x209,0x20b,0x1ecb,0x12f,0x1e2d,0x135,0x1f0,0x1e31,0x1e9,0x1e33,0x137,0x1e35,
+	0x13a,0x13e,0x1e37,0x13c,0x1e3d,0x1e3b,0x1e3f,0x1e41,0x1e43,0x1f9,0x144,0xf1,0x1e45,0x148,0x1e47,0x146,
+	0x1e4b,0x1e49,0xf2,0xf3,0xf4,0xf5,0x14d,0x14f,0x22f,0xf6,0x1ecf,0x151,0x1d2,0x20d,0x20f,0x1a1,
+	0x1ecd,0x1eb,0x1e55,0x1e57,0x155,0x1e59,0x159,0x211,0x213,0x1e5b,0x157,0x1e5f,0x15b,0x15d,0x1e61,0x161,
+	0x1e63,0x219,0x15f,0x1e6b,0x1e97,0x165,0x1e6d,0x21b,0x163,0x1e71,0x1e6f,0xf9,0xfa,0xfb,0x169,0x16b,
+	0x16d,0xfc,0x1ee7,0x16f,0x171,0x1d4,0x215,0x217,0x1b0,0x1ee5,0x1e73,0x173,0x1e77,0x1e75,0x1e7d,0x1e7f,
+	0x1e81,0x1e83,0x175,0x1e87,0x1e85,0x1e98,0x1e89,0x1e8b,0x1e8d,0x1ef3,0xfd,0x177,0x1ef9,0x233,0x1e8f,0xff,
+	0x1ef7,0x1e99,0x1ef5,0x17a,0x1e91,0x17c,0x17e,0x1e93,0x1e95,0x1fed,0x385,0x1fc1,0x1ea6,0x1ea4,0x1eaa,0x1ea8,
+	0x1de,0x1fa,0x1fc,0x1e2,0x1e08,0x1ec0,0x1ebe,0x1ec4,0x1ec2,0x1e2e,0x1ed2,0x1ed0,0x1ed6,0x1ed4,0x1e4c,0x22c,
+	0x1e4e,0x22a,0x1fe,0x1db,0x1d7,0x1d5,0x1d9,0x1ea7,0x1ea5,0x1eab,0x1ea9,0x1df,0x1fb,0x1fd,0x1e3,0x1e09,
+	0x1ec1,0x1ebf,0x1ec5,0x1ec3,0x1e2f,0x1ed3,0x1ed1,0x1ed7,0x1ed5,0x1e4d,0x22d,0x1e4f,0x22b,0x1ff,0x1dc,0x1d8,
+	0x1d6,0x1da,0x1eb0,0x1eae,0x1eb4,0x1eb2,0x1eb1,0x1eaf,0x1eb5,0x1eb3,0x1e14,0x1e16,0x1e15,0x1e17,0x1e50,0x1e52,
+	0x1e51,0x1e53,0x1e64,0x1e65,0x1e66,0x1e67,0x1e78,0x1e79,0x1e7a,0x1e7b,0x1e9b,0x1edc,0x1eda,0x1ee0,0x1ede,0x1ee2,
+	0x1edd,0x1edb,0x1ee1,0x1edf,0x1ee3,0x1eea,0x1ee8,0x1eee,0x1eec,0x1ef0,0x1eeb,0x1ee9,0x1eef,0x1eed,0x1ef1,0x1ee,
+	0x1ec,0x1ed,0x1e0,0x1e1,0x1e1c,0x1e1d,0x230,0x231,0x1ef,0x1fba,0x386,0x1fb9,0x1fb8,0x1f08,0x1f09,0x1fbc,
+	0x1fc8,0x388,0x1f18,0x1f19,0x1fca,0x389,0x1f28,0x1f29,0x1fcc,0x1fda,0x38a,0x1fd9,0x1fd8,0x3aa,0x1f38,0x1f39,
+	0x1ff8,0x38c,0x1f48,0x1f49,0x1fec,0x1fea,0x38e,0x1fe9,0x1fe8,0x3ab,0x1f59,0x1ffa,0x38f,0x1f68,0x1f69,0x1ffc,
+	0x1fb4,0x1fc4,0x1f70,0x3ac,0x1fb1,0x1fb0,0x1f00,0x1f01,0x1fb6,0x1fb3,0x1f72,0x3ad,0x1f10,0x1f11,0x1f74,0x3ae,
+	0x1f20,0x1f21,0x1fc6,0x1fc3,0x1f76,0x3af,0x1fd1,0x1fd0,0x3ca,0x1f30,0x1f31,0x1fd6,0x1f78,0x3cc,0x1f40,0x1f41,
+	0x1fe4,0x1fe5,0x1f7a,0x3cd,0x1fe1,0x1fe0,0x3cb,0x1f50,0x1f51,0x1fe6,0x1f7c,0x3ce,0x1f60,0x1f61,0x1ff6,0x1ff3,
+	0x1fd2,0x390,0x1fd7,0x1fe2,0x3b0,0x1fe7,0x1ff4,0x3d3,0x3d4,0x407,0x4d0,0x4d2,0x403,0x400,0x4d6,0x401,
+	0x4c1,0x4dc,0x4de,0x40d,0x4e2,0x419,0x4e4,0x40c,0x4e6,0x4ee,0x40e,0x4f0,0x4f2,0x4f4,0x4f8,0x4ec,
+	0x4d1,0x4d3,0x453,0x450,0x4d7,0x451,0x4c2,0x4dd,0x4df,0x45d,0x4e3,0x439,0x4e5,0x45c,0x4e7,0x4ef,
+	0x45e,0x4f1,0x4f3,0x4f5,0x4f9,0x4ed,0x457,0x476,0x477,0x4da,0x4db,0x4ea,0x4eb,0x622,0x623,0x625,
+	0x624,0x626,0x6c2,0x6d3,0x6c0,0x929,0x931,0x934,0x9cb,0x9cc,0xb4b,0xb48,0xb4c,0xb94,0xbca,0xbcc,
+	0xbcb,0xc48,0xcc0,0xcca,0xcc7,0xcc8,0xccb,0xd4a,0xd4c,0xd4b,0xdda,0xddc,0xdde,0xddd,0x1026,0x1b06,
+	0x1b08,0x1b0a,0x1b0c,0x1b0e,0x1b12,0x1b3b,0x1b3d,0x1b40,0x1b41,0x1b43,0x1e38,0x1e39,0x1e5c,0x1e5d,0x1e68,0x1e69,
+	0x1eac,0x1eb6,0x1ead,0x1eb7,0x1ec6,0x1ec7,0x1ed8,0x1ed9,0x1f02,0x1f04,0x1f06,0x1f80,0x1f03,0x1f05,0x1f07,0x1f81,
+	0x1f82,0x1f83,0x1f84,0x1f85,0x1f86,0x1f87,0x1f0a,0x1f0c,0x1f0e,0x1f88,0x1f0b,0x1f0d,0x1f0f,0x1f89,0x1f8a,0x1f8b,
+	0x1f8c,0x1f8d,0x1f8e,0x1f8f,0x1f12,0x1f14,0x1f13,0x1f15,0x1f1a,0x1f1c,0x1f1b,0x1f1d,0x1f22,0x1f24,0x1f26,0x1f90,
+	0x1f23,0x1f25,0x1f27,0x1f91,0x1f92,0x1f93,0x1f94,0x1f95,0x1f96,0x1f97,0x1f2a,0x1f2c,0x1f2e,0x1f98,0x1f2b,0x1f2d,
+	0x1f2f,0x1f99,0x1f9a,0x1f9b,0x1f9c,0x1f9d,0x1f9e,0x1f9f,0x1f32,0x1f34,0x1f36,0x1f33,0x1f35,0x1f37,0x1f3a,0x1f3c,
+	0x1f3e,0x1f3b,0x1f3d,0x1f3f,0x1f42,0x1f44,0x1f43,0x1f45,0x1f4a,0x1f4c,0x1f4b,0x1f4d,0x1f52,0x1f54,0x1f56,0x1f53,
+	0x1f55,0x1f57,0x1f5b,0x1f5d,0x1f5f,0x1f62,0x1f64,0x1f66,0x1fa0,0x1f63,0x1f65,0x1f67,0x1fa1,0x1fa2,0x1fa3,0x1fa4,
+	0x1fa5,0x1fa6,0x1fa7,0x1f6a,0x1f6c,0x1f6e,0x1fa8,0x1f6b,0x1f6d,0x1f6f,0x1fa9,0x1faa,0x1fab,0x1fac,0x1fad,0x1fae,
+	0x1faf,0x1fb2,0x1fc2,0x1ff2,0x1fb7,0x1fcd,0x1fce,0x1fcf,0x1fc7,0x1ff7,0x1fdd,0x1fde,0x1fdf,0x219a,0x219b,0x21ae,
+	0x21cd,0x21cf,0x21ce,0x2204,0x2209,0x220c,0x2224,0x2226,0x2241,0x2244,0x2247,0x2249,0x226d,0x2262,0x2270,0x2271,
+	0x2274,0x2275,0x2278,0x2279,0x2280,0x2281,0x22e0,0x22e1,0x2284,0x2285,0x2288,0x2289,0x22e2,0x22e3,0x22ac,0x22ad,
+	0x22ae,0x22af,0x22ea,0x22eb,0x22ec,0x22ed,0x3094,0x304c,0x304e,0x3050,0x3052,0x3054,0x3056,0x3058,0x305a,0x305c,
+	0x305e,0x3060,0x3062,0x3065,0x3067,0x3069,0x3070,0x3071,0x3073,0x3074,0x3076,0x3077,0x3079,0x307a,0x307c,0x307d,
+	0x309e,0x30f4,0x30ac,0x30ae,0x30b0,0x30b2,0x30b4,0x30b6,0x30b8,0x30ba,0x30bc,0x30be,0x30c0,0x30c2,0x30c5,0x30c7,
+	0x30c9,0x30d0,0x30d1,0x30d3,0x30d4,0x30d6,0x30d7,0x30d9,0x30da,0x30dc,0x30dd,0x30f7,0x30f8,0x30f9,0x30fa,0x30fe,
+	0x1109a,0x1109c,0x110ab,0x1112e,0x1112f,0x1134b,0x1134c,0x114bc,0x114bb,0x114be,0x115ba,0x115bb,0x11938
+};
+
+#endif
@@ -0,0 +1,297 @@
+//Copyright 2014 by Daniel Ortiz
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#ifndef __LANGUAGE_PARALLEL_STRINGUTILS_H__
+#define __LANGUAGE_PARALLEL_STRINGUTILS_H__
+
+#include <limits.h>
+#include <pthread.h>
+#include <unistd.h>
+#include "stringUtils.h"
+
+#ifdef __cplusplus
+extern "C"{
+#endif
+
+#define PARALLEL_DEFAULT_SERIAL_CUTOFF (4 << 20)	// Buffers below 4MB stay on the calling thread
+#define PARALLEL_DEFAULT_CHUNK_SIZE (1 << 20)		// The bytes handed to a thread at a time
+#define PARALLEL_MAX_THREADS 64						// The most threads used by a call
+#define PARALLEL_MAX_CHUNK_SIZE (1 << 30)			// The largest chunk, so that its length fits the int of lenBounded
+
+/**
+ * The knobs of the parallel functions. A NULL options pointer, or a field
+ * left at 0, uses the default.
+ */
+typedef struct{
+	int numberOfThreads;		// The number of threads, 0 for one per online processor
+	size_t serialCutoff;		// Buffers smaller than this are processed on the calling thread
+	size_t chunkSize;			// The number of bytes a thread takes at a time
+} parallelOptions;
+
+/**
+ * The state shared by the threads of a parallel call. The threads take
+ * chunks of the buffer until it runs out or the result is known.
+ */
+typedef struct{
+	const char * buffer;										// The buffer
+	size_t numberOfBytes;										// The number of bytes in the buffer
+	int encoding;												// The encoding of the buffer
+	int language;												// The language of the buffer
+	int (*sequenceFunc)(const char *, size_t, int);				// The bounded sequence check, or NULL
+	int (*languageSequenceFunc)(const char *, size_t, int, int);	// The bounded language sequence check, or NULL
+	size_t chunkSize;											// The number of bytes in a chunk
+	pthread_mutex_t lock;										// Guards the fields below
+	size_t nextChunk;											// The start of the next chunk
+	int done;													// Set when the result is known
+	long long length;											// The length counted so far
+	int result;													// The result of the call
+} _parallelJob;
+
+/**
+ * Get the number of threads to use for a call
+ * @param options The parallel options
+ */
+static int _parallelThreadCount(const parallelOptions * options){
+	long numberOfThreads = 0;
+	if(options != NULL){
+		numberOfThreads = options->numberOfThreads;
+	}
+	if(numberOfThreads <= 0){
+		numberOfThreads = sysconf(_SC_NPROCESSORS_ONLN);
+	}
+	if(numberOfThreads < 1){
+		return 1;
+	}
+	return numberOfThreads > PARALLEL_MAX_THREADS ? PARALLEL_MAX_THREADS : (int)numberOfThreads;
+}
+
+/**
+ * Check if a call should stay on the calling thread
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param options The parallel options
+ * @returns {0 = false, 1 = true}
+ */
+static int _parallelIsSerial(size_t numberOfBytes, const parallelOptions * options){
+	size_t serialCutoff = PARALLEL_DEFAULT_SERIAL_CUTOFF;
+	if(options != NULL && options->serialCutoff != 0){
+		serialCutoff = options->serialCutoff;
+	}
+	return numberOfBytes < serialCutoff || _parallelThreadCount(options) == 1;
+}
+
+/**
+ * Take the next chunk of the buffer. A utf8 or utf16 chunk ends at the start
+ * of a character, so no character is split between two threads.
+ * @param job The shared state of the call
+ * @param start Set to the start of the chunk
+ * @param end Set to the end of the chunk
+ * @returns {0 = no chunk left, 1 = a chunk}
+ */
+static int _parallelNextChunk(_parallelJob * job, size_t * start, size_t * end){
+	pthread_mutex_lock(&job->lock);
+	*start = job->nextChunk;
+	if(job->done || *start >= job->numberOfBytes){
+		pthread_mutex_unlock(&job->lock);
+		return 0;
+	}
+	size_t chunkEnd = job->numberOfBytes - *start > job->chunkSize ? *start + job->chunkSize : job->numberOfBytes;
+	if(job->encoding == UTF8_BINARY){
+		int l;
+		for(l = 0; l < 3 && chunkEnd < job->numberOfBytes && (job->buffer[chunkEnd] & 0xc0) == 0x80; l++){
+			chunkEnd++;
+		}
+	}else if(job->encoding == UTF16 && chunkEnd < job->numberOfBytes){
+		// Keep the code units and the surrogate pairs whole
+		chunkEnd += (chunkEnd - *start) % 2;
+		unsigned int unit = _getUTF16CodeUnit(job->buffer + chunkEnd - 2);
+		if(unit >= 0xd800 && unit <= 0xdbff && chunkEnd < job->numberOfBytes){
+			chunkEnd += 2;
+		}
+	}
+	*end = chunkEnd;
+	job->nextChunk = chunkEnd;
+	pthread_mutex_unlock(&job->lock);
+	return 1;
+}
+
+/**
+ * The body of every thread of a parallel call. The length is summed over the
+ * chunks, and a sequence check stops all of the threads at the first chunk
+ * that fails.
+ * @param argument The shared state of the call
+ */
+static void * _parallelWorker(void * argument){
+	_parallelJob * job = (_parallelJob *)argument;
+	size_t start;
+	size_t end;
+	while(_parallelNextChunk(job, &start, &end)){
+		const char * chunk = job->buffer + start;
+		if(job->sequenceFunc != NULL || job->languageSequenceFunc != NULL){
+			int result = job->sequenceFunc != NULL ? job->sequenceFunc(chunk, end - start, job->encoding) :
+					job->languageSequenceFunc(chunk, end - start, job->encoding, job->language);
+			if(result == 0){
+				pthread_mutex_lock(&job->lock);
+				job->result = 0;
+				job->done = 1;
+				pthread_mutex_unlock(&job->lock);
+			}
+		}else{
+			int length = lenBounded(chunk, end - start, job->encoding);
+			pthread_mutex_lock(&job->lock);
+			if(length < 0){
+				job->result = -1;
+				job->done = 1;
+			}else{
+				job->length += length;
+			}
+			pthread_mutex_unlock(&job->lock);
+		}
+	}
+	return NULL;
+}
+
+/**
+ * Run a parallel call. The calling thread works on the chunks as well, so
+ * the call still finishes if no thread can be started.
+ * @param job The shared state of the call
+ * @param options The parallel options
+ */
+static void _parallelRun(_parallelJob * job, const parallelOptions * options){
+	pthread_t threads[PARALLEL_MAX_THREADS];
+	int numberOfThreads = _parallelThreadCount(options);
+	int started = 0;
+	int t;
+
+	job->chunkSize = PARALLEL_DEFAULT_CHUNK_SIZE;
+	if(options != NULL && options->chunkSize != 0){
+		job->chunkSize = options->chunkSize;
+	}
+	if(job->chunkSize > PARALLEL_MAX_CHUNK_SIZE){
+		job->chunkSize = PARALLEL_MAX_CHUNK_SIZE;
+	}
+	job->nextChunk = 0;
+	job->done = 0;
+	job->length = 0;
+	pthread_mutex_init(&job->lock, NULL);
+
+	// There is no point in more threads than chunks
+	if((size_t)numberOfThreads > job->numberOfBytes / job->chunkSize + 1){
+		numberOfThreads = (int)(job->numberOfBytes / job->chunkSize + 1);
+	}
+	for(t = 1; t < numberOfThreads; t++){
+		if(pthread_create(&threads[started], NULL, _parallelWorker, job) == 0){
+			started++;
+		}
+	}
+	_parallelWorker(job);
+	for(t = 0; t < started; t++){
+		pthread_join(threads[t], NULL);
+	}
+	pthread_mutex_destroy(&job->lock);
+}
+
+/**
+ * The length of a buffer counted on several threads. The buffer is split on
+ * character boundaries and the lengths of the pieces are summed. A buffer past
+ * INT_MAX bytes is always split, as lenBounded counts in an int.
+ * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param encoding The encoding of the buffer
+ * @param options The parallel options, or NULL for the defaults
+ * @returns {The length of the string, or -1 for an error}
+ */
+static long long lenParallel(const char * buffer, size_t numberOfBytes, int encoding, const parallelOptions * options){
+	if(buffer == NULL){
+		return 0;
+	}
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		// The single byte encodings are just the number of bytes
+		return (long long)numberOfBytes;
+	}
+	if(encoding != UTF8_BINARY && encoding != UTF16){
+		// The grapheme clusters are only counted on the calling thread
+		return numberOfBytes > INT_MAX ? -1 : lenBounded(buffer, numberOfBytes, encoding);
+	}
+	if(numberOfBytes <= INT_MAX && _parallelIsSerial(numberOfBytes, options)){
+		return lenBounded(buffer, numberOfBytes, encoding);
+	}
+	_parallelJob job;
+	memset(&job, 0, sizeof(_parallelJob));
+	job.buffer = buffer;
+	job.numberOfBytes = numberOfBytes;
+	job.encoding = encoding;
+	job.result = 1;
+	_parallelRun(&job, options);
+	return job.result == -1 ? -1 : job.length;
+}
+
+/**
+ * Check a sequence of characters on several threads. All of the threads
+ * stop once a piece of the buffer fails the check.
+ * @param func The bounded sequence check, e.g. isNumberSequenceBounded
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the string
+ * @param options The parallel options, or NULL for the defaults
+ * @returns {0 = false, 1 = true}
+ */
+static int isSequenceParallel(int (*func)(const char *, size_t, int), const char * charSequence,
+		size_t numberOfBytes, int encoding, const parallelOptions * options){
+	if(charSequence == NULL || _parallelIsSerial(numberOfBytes, options)){
+		return charSequence != NULL && func(charSequence, numberOfBytes, encoding);
+	}
+	_parallelJob job;
+	memset(&job, 0, sizeof(_parallelJob));
+	job.buffer = charSequence;
+	job.numberOfBytes = numberOfBytes;
+	job.encoding = encoding;
+	job.sequenceFunc = func;
+	job.result = 1;
+	_parallelRun(&job, options);
+	return job.result;
+}
+
+/**
+ * Check a sequence of characters in a language on several threads. All of
+ * the threads stop once a piece of the buffer fails the check.
+ * @param func The bounded language sequence check, e.g. isInAlphabetSequenceBounded
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @param options The parallel options, or NULL for the defaults
+ * @returns {0 = false, 1 = true}
+ */
+static int isLanguageSequenceParallel(int (*func)(const char *, size_t, int, int), const char * charSequence,
+		size_t numberOfBytes, int encoding, int language, const parallelOptions * options){
+	if(charSequence == NULL || _parallelIsSerial(numberOfBytes, options)){
+		return charSequence != NULL && func(charSequence, numberOfBytes, encoding, language);
+	}
+	_parallelJob job;
+	memset(&job, 0, sizeof(_parallelJob));
+	job.buffer = charSequence;
+	job.numberOfBytes = numberOfBytes;
+	job.encoding = encoding;
+	job.language = language;
+	job.languageSequenceFunc = func;
+	job.result = 1;
+	_parallelRun(&job, options);
+	return job.result;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
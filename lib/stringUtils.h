@@ -18,6 +18,20 @@
 #include <string.h>
 #include <stdlib.h>
 
+// The vector extensions used by the bulk kernels. The widest instruction set
+// enabled by the compiler is used, and LANGUAGE_DISABLE_SIMD forces the
+// scalar paths.
+#if !defined(LANGUAGE_DISABLE_SIMD)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define LANGUAGE_AVX2 1
+#endif
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define LANGUAGE_SSE2 1
+#endif
+#endif
+
 #ifdef __cplusplus
 extern "C"{
 #endif
@@ -32,17 +46,18 @@ typedef enum {
 						// to guess the information associated with the string.
 	ASCII = 1,
 	ISO_8859_1 = 2,
+	UTF16 = 3,			// Utf16 code units in the byte order of the machine, the native
+						// string representation of V8, Java and narrow Python builds.
 } baseEncodings;
 
-/**
- * An enum that encapsulates the different encodings and their
- * alphabets
- */
-typedef enum{
-	ENGLISH = 0,
-	SPANISH = 1,
-	FRENCH = 2
-} Languages;
+// The languages and their character class tables, generated from languages.json
+#include "languageTables.h"
+
+// The grapheme cluster break properties, generated from the unicode data
+#include "graphemeTables.h"
+
+// The canonical decompositions and compositions, generated from the unicode data
+#include "normalizationTables.h"
 
 /**
  * An enum that encapsulates the different escape encodings
@@ -53,6 +68,40 @@ typedef enum {
 	ASCII_DECIMAL_UTF_ESCAPE = 1
 } escapedEncodings;
 
+/**
+ * The flags of the encoding of len and lenBounded
+ */
+typedef enum {
+	LEN_GRAPHEME_CLUSTERS = 0x100		// Count the extended grapheme clusters of UAX #29, the
+										// characters a reader sees, as len(buffer, UTF8_BINARY | LEN_GRAPHEME_CLUSTERS)
+} lenModes;
+
+/**
+ * The unicode normalization forms of normalizeUTF8Into
+ */
+typedef enum {
+	NORMALIZATION_NFC = 0,		// Canonical composition, the precomposed characters of the language tables
+	NORMALIZATION_NFD = 1		// Canonical decomposition, a base letter followed by its combining marks
+} normalizationForms;
+
+/**
+ * The results of quickCheckNormalizationUTF8
+ */
+typedef enum {
+	NORMALIZATION_NO = 0,
+	NORMALIZATION_YES = 1,
+	NORMALIZATION_MAYBE = 2		// Only normalizing tells, see normalizeUTF8Into
+} normalizationQuickChecks;
+
+/**
+ * The case of the text that foldDiacriticsInto writes
+ */
+typedef enum {
+	FOLD_KEEP_CASE = 0,
+	FOLD_UPPER_CASE = 1,		// The upper case of the alphabet, as toUpperInAlphabet
+	FOLD_LOWER_CASE = 2			// The lower case of the alphabet, as toLowerInAlphabet
+} foldCases;
+
 /**
  * An enum that encpasulates the different parsing states
  * needed by the utf8 binary parsing
@@ -81,6 +130,269 @@ typedef enum{
 
 
 
+/**
+ * The accept and reject states of the table driven utf8 decoder. The
+ * states in between are row offsets into utf8DecoderTransitions and only
+ * mean something to the decoder itself
+ */
+typedef enum{
+	UTF8_DECODER_ACCEPT = 0,	// A whole character has been decoded
+	UTF8_DECODER_REJECT = 14	// The bytes are not valid utf8
+} utf8DecoderStates;
+
+/**
+ * The number of byte classes of the utf8 decoder, which is also the width
+ * of a row of the transition table
+ */
+#define UTF8_DECODER_CLASSES 14
+
+/**
+ * The utf8 class of every byte.
+ *  0: 00-7f ascii
+ *  1: 80-8f continuation byte
+ *  2: 90-9f continuation byte
+ *  3: a0-bf continuation byte
+ *  4: c2-df lead of a two byte character
+ *  5: e0 lead of a three byte character, must be followed by a0-bf
+ *  6: e1-ec and ee-ef lead of a three byte character
+ *  7: ed lead of a three byte character, must be followed by 80-9f (no surrogates)
+ *  8: f0 lead of a four byte character, must be followed by 90-bf
+ *  9: f1-f3 lead of a four byte character
+ * 10: f4 lead of a four byte character, must be followed by 80-8f (no code points past 0x10ffff)
+ * 11: c0-c1 overlong two byte lead
+ * 12: f5-f7 four byte lead past 0x10ffff
+ * 13: f8-ff never part of utf8
+ */
+static const unsigned char utf8CharacterClasses[256] = {
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 00-0f
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 10-1f
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 20-2f
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 30-3f
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 40-4f
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 50-5f
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 60-6f
+	0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,	// 70-7f
+	1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,	// 80-8f
+	2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,	// 90-9f
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,	// a0-af
+	3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,	// b0-bf
+	11,11,4,4,4,4,4,4,4,4,4,4,4,4,4,4,	// c0-cf
+	4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,	// d0-df
+	5,6,6,6,6,6,6,6,6,6,6,6,6,7,6,6,	// e0-ef
+	8,9,9,9,10,12,12,12,13,13,13,13,13,13,13,13	// f0-ff
+};
+
+/**
+ * The transitions of the utf8 decoder, indexed by the current state plus
+ * the class of the next byte. Every state is the offset of its own row.
+ */
+static const unsigned char utf8DecoderTransitions[9 * UTF8_DECODER_CLASSES] = {
+	 0,14,14,14,28,56,42,70,84,98,112,14,14,14,	// 0: accept
+	14,14,14,14,14,14,14,14,14,14,14,14,14,14,	// 14: reject
+	14, 0, 0, 0,14,14,14,14,14,14,14,14,14,14,	// 28: one continuation byte left
+	14,28,28,28,14,14,14,14,14,14,14,14,14,14,	// 42: two continuation bytes left
+	14,14,14,28,14,14,14,14,14,14,14,14,14,14,	// 56: after e0
+	14,28,28,14,14,14,14,14,14,14,14,14,14,14,	// 70: after ed
+	14,14,42,42,14,14,14,14,14,14,14,14,14,14,	// 84: after f0
+	14,42,42,42,14,14,14,14,14,14,14,14,14,14,	// 98: three continuation bytes left
+	14,42,14,14,14,14,14,14,14,14,14,14,14,14	// 112: after f4
+};
+
+/**
+ * The code point bits carried by a lead byte of each class
+ */
+static const unsigned char utf8ClassLeadMasks[UTF8_DECODER_CLASSES] = {
+	0x7f,0,0,0,0x1f,0x0f,0x0f,0x0f,0x07,0x07,0x07,0,0,0
+};
+
+/**
+ * The utf8 parser state announced by a lead byte of each class
+ */
+static const signed char utf8ClassParserStates[UTF8_DECODER_CLASSES] = {
+	UTF8_BINARY_7BIT_STATE, UTF8_BINARY_ERROR_STATE, UTF8_BINARY_ERROR_STATE, UTF8_BINARY_ERROR_STATE,
+	UTF8_BINARY_11BIT_STATE, UTF8_BINARY_16BIT_STATE, UTF8_BINARY_16BIT_STATE, UTF8_BINARY_16BIT_STATE,
+	UTF8_BINARY_21BIT_STATE, UTF8_BINARY_21BIT_STATE, UTF8_BINARY_21BIT_STATE, UTF8_BINARY_11BIT_STATE,
+	UTF8_BINARY_21BIT_STATE, UTF8_BINARY_ERROR_STATE
+};
+
+/**
+ * The number of bytes announced by a lead byte of each class
+ */
+static const unsigned char utf8ClassStrideLengths[UTF8_DECODER_CLASSES] = {
+	1,1,1,1,2,3,3,3,4,4,4,2,4,1
+};
+
+/**
+ * The character classes of the language predicates. Every byte of ASCII and
+ * ISO-8859-1 has a bitmask of its classes in the table of each language, and
+ * every code point has one in the unicode class trie, so a predicate on a
+ * character is one lookup and one AND.
+ */
+typedef enum{
+	CHARACTER_CLASS_ALPHA = 0x001,		// Part of the alphabet of the language, isInAlphabet
+	CHARACTER_CLASS_UPPER = 0x002,		// An upper case letter of the language
+	CHARACTER_CLASS_LOWER = 0x004,		// A lower case letter of the language
+	CHARACTER_CLASS_DIGIT = 0x008,		// 0-9
+	CHARACTER_CLASS_HEX = 0x010,		// 0-9, a-f, A-F
+	CHARACTER_CLASS_PUNCT = 0x020,		// A punctuation mark of the language
+	CHARACTER_CLASS_EXTENDED = 0x040,	// A letter of the language beyond the romance core
+	CHARACTER_CLASS_VALID = 0x080,		// A valid character of the encoding, isValidCharacter
+	CHARACTER_CLASS_ROMANCE = 0x100,	// a-z, A-Z
+	CHARACTER_CLASS_ALL = 0x1ff			// Every class, the classification of an empty sequence
+} characterClasses;
+
+/**
+ * Get the character class table of a single byte encoding in a language. The
+ * table can also be used as the lookup source of vector kernels.
+ * @param encoding The encoding
+ * @param language The language
+ * @returns {The 256 entry table, or NULL for the multi byte encodings and unknown languages}
+ */
+static const unsigned short * getCharacterClassTable(int encoding, int language){
+	if((encoding != ASCII && encoding != ISO_8859_1) || language < ENGLISH || language >= NUMBER_OF_LANGUAGES){
+		return NULL;
+	}
+	return singleByteCharacterClasses[encoding - ASCII][language];
+}
+
+/**
+ * Check the classes of a single byte character
+ * @param charValue The character to check
+ * @param encoding ASCII or ISO_8859_1
+ * @param language The language of the character
+ * @param characterClass The classes to look for
+ * @returns {0 = false, 1 = true}
+ */
+static int _isSingleByteClass(const char * charValue, int encoding, int language, int characterClass){
+	return (singleByteCharacterClasses[encoding - ASCII][language][(unsigned char)*charValue] & characterClass) != 0;
+}
+
+/**
+ * Get the classes of a code point in a language from the unicode class trie
+ * @param codePoint The code point
+ * @param language The language
+ * @returns {The characterClasses bits of the code point, 0 for an unknown language}
+ */
+static int getUnicodeCharacterClasses(int codePoint, int language){
+	if(codePoint < 0 || (codePoint >> 8) >= UNICODE_CLASS_PAGES || language < ENGLISH || language >= NUMBER_OF_LANGUAGES){
+		return 0;
+	}
+	int block = unicodeClassPages[codePoint >> 8];
+	if(block == 0){
+		return 0;
+	}
+	return unicodeClassBlocks[language][block - 1][codePoint & 0xff];
+}
+
+/**
+ * Feed one byte to the utf8 decoder
+ * @param state The decoder state, UTF8_DECODER_ACCEPT before the first byte of a character
+ * @param codePoint The code point decoded so far
+ * @param byte The next byte of the buffer
+ * @returns {The new decoder state}
+ */
+static unsigned int decodeUTF8Byte(unsigned int * state, unsigned int * codePoint, unsigned char byte){
+	unsigned int characterClass = utf8CharacterClasses[byte];
+	*codePoint = (*state == UTF8_DECODER_ACCEPT) ? (byte & utf8ClassLeadMasks[characterClass])
+		: ((*codePoint << 6) | (byte & 0x3f));
+	*state = utf8DecoderTransitions[*state + characterClass];
+	return *state;
+}
+
+/**
+ * Decode the utf8 character at the start of a buffer, validating the lead
+ * byte and every continuation byte
+ * @param charValue The first byte of the character
+ * @param numberOfBytes The number of bytes left in the buffer
+ * @param codePoint Set to the code point of the character
+ * @returns {The number of bytes of the character, or -1 for a malformed or cut off character}
+ */
+static int decodeUTF8Character(const char * charValue, size_t numberOfBytes, int * codePoint){
+	unsigned int state = UTF8_DECODER_ACCEPT;
+	unsigned int value = 0;
+	size_t index;
+	for(index = 0; index < numberOfBytes; index++){
+		decodeUTF8Byte(&state, &value, (unsigned char)charValue[index]);
+		if(state == UTF8_DECODER_ACCEPT){
+			*codePoint = (int)value;
+			return (int)index + 1;
+		}else if(state == UTF8_DECODER_REJECT){
+			return -1;
+		}
+	}
+	return -1;
+}
+
+/**
+ * Read a utf16 code unit from a buffer that does not need to be aligned
+ * @param charValue The first byte of the code unit
+ */
+static unsigned int _getUTF16CodeUnit(const char * charValue){
+	unsigned short unit;
+	memcpy(&unit, charValue, sizeof(unit));
+	return unit;
+}
+
+/**
+ * Decode the utf16 character at the start of a bounded buffer. A surrogate
+ * that is not part of a pair is an error.
+ * @param charValue The first byte of the character
+ * @param numberOfBytes The number of bytes left in the buffer
+ * @param codePoint Set to the code point of the character
+ * @returns {The number of bytes in the character, or -1 for a malformed or cut off character}
+ */
+static int decodeUTF16Character(const char * charValue, size_t numberOfBytes, int * codePoint){
+	if(numberOfBytes < 2){
+		return -1;
+	}
+	unsigned int unit = _getUTF16CodeUnit(charValue);
+	if(unit < 0xd800 || unit > 0xdfff){
+		*codePoint = (int)unit;
+		return 2;
+	}
+	if(unit > 0xdbff || numberOfBytes < 4){
+		return -1;
+	}
+	unsigned int trail = _getUTF16CodeUnit(charValue + 2);
+	if(trail < 0xdc00 || trail > 0xdfff){
+		return -1;
+	}
+	*codePoint = (int)(0x10000 + ((unit - 0xd800) << 10) + (trail - 0xdc00));
+	return 4;
+}
+
+/**
+ * Get the first code unit of a character. The single byte encodings and utf8
+ * return the first byte, so the ascii range is the same in every encoding.
+ * @param charValue The character
+ * @param encoding The encoding of the character
+ */
+static int _getFirstCodeUnit(const char * charValue, int encoding){
+	if(encoding == UTF16){
+		return (int)_getUTF16CodeUnit(charValue);
+	}else{
+		return *charValue;
+	}
+}
+
+/**
+ * Get the number of bytes in a NUL terminated string. A utf16 string ends
+ * with a zero code unit.
+ * @param buffer The string
+ * @param encoding The encoding of the string
+ */
+static size_t _getStringByteLength(const char * buffer, int encoding){
+	if(encoding == UTF16){
+		size_t numberOfBytes = 0;
+		while(buffer[numberOfBytes] != '\0' || buffer[numberOfBytes + 1] != '\0'){
+			numberOfBytes += 2;
+		}
+		return numberOfBytes;
+	}else{
+		return strlen(buffer);
+	}
+}
+
 /**
  * A function that returns the utf8 state associated with a control
  * character. The control character is the first character after
@@ -88,18 +400,7 @@ typedef enum{
  * @param controlChar The control char to check
  */
 static int getUTF8State(const char controlChar){
-	// Check the control character is
-	if(!(controlChar & ((0x01) << 7))){
-		return UTF8_BINARY_7BIT_STATE;
-	}else if(controlChar & ((0x03) << 6) && !(controlChar & ((0x01) << 5))){
-		return UTF8_BINARY_11BIT_STATE;
-	}else if(controlChar & ((0x07) << 5) && !(controlChar & ((0x01) << 4))){
-		return UTF8_BINARY_16BIT_STATE;
-	}else if(controlChar & ((0x0f) << 4) && !(controlChar & ((0x01) << 3))){
-		return UTF8_BINARY_21BIT_STATE;
-	}else{
-		return UTF8_BINARY_ERROR_STATE;
-	}
+	return utf8ClassParserStates[utf8CharacterClasses[(unsigned char)controlChar]];
 }
 
 /**
@@ -109,18 +410,30 @@ static int getUTF8State(const char controlChar){
  */
 static int getCharacterStrideLength(const char * trialCharacter, int encoding){
 	if(encoding == UTF8_BINARY){
-		int utf8State = getUTF8State(*trialCharacter);
-		if(utf8State == UTF8_BINARY_7BIT_STATE){
-			return 1;
-		}else if(utf8State == UTF8_BINARY_11BIT_STATE){
-			return 2;
-		}else if(utf8State == UTF8_BINARY_16BIT_STATE){
-			return 3;
-		}else if(utf8State == UTF8_BINARY_21BIT_STATE){
-			return 4;
-		}else{
-			return 1;
-		}
+		return utf8ClassStrideLengths[utf8CharacterClasses[(unsigned char)*trialCharacter]];
+	}else if(encoding == UTF16){
+		unsigned int unit = _getUTF16CodeUnit(trialCharacter);
+		return (unit >= 0xd800 && unit <= 0xdbff) ? 4 : 2;
+	}else{
+		return 1;
+	}
+}
+
+/**
+ * Get the number of bytes of the character at the start of a bounded buffer.
+ * Utf8 and utf16 characters are validated by the decoders on the way.
+ * @param trialCharacter The character to check
+ * @param numberOfBytes The number of bytes left in the buffer
+ * @param encoding The encoding to check the character
+ * @returns {The stride length, or -1 for a malformed or cut off character}
+ */
+static int _getCharacterStrideLengthBounded(const char * trialCharacter, size_t numberOfBytes, int encoding){
+	if(encoding == UTF8_BINARY){
+		int codePoint;
+		return decodeUTF8Character(trialCharacter, numberOfBytes, &codePoint);
+	}else if(encoding == UTF16){
+		int codePoint;
+		return decodeUTF16Character(trialCharacter, numberOfBytes, &codePoint);
 	}else{
 		return 1;
 	}
@@ -146,6 +459,155 @@ static int isDiacriticalMark(int codePoint){
 	}
 }
 
+/**
+ * Get the grapheme cluster break property of a code point
+ * @param codePoint The code point
+ * @returns {The graphemeBreakProperties value of the code point}
+ */
+static int getGraphemeBreakProperty(int codePoint){
+	if(codePoint < 0){
+		return GRAPHEME_BREAK_OTHER;
+	}else if(codePoint < GRAPHEME_BREAK_CODE_POINTS){
+		return graphemeBreakBlocks[graphemeBreakPages[codePoint / GRAPHEME_BREAK_BLOCK_SIZE]][codePoint % GRAPHEME_BREAK_BLOCK_SIZE];
+	}else if(codePoint >= 0xe0000 && codePoint <= 0xe0fff){
+		// The tags and the variation selectors of plane 14 extend a character,
+		// and the rest of the plane is default ignorable
+		if((codePoint >= 0xe0020 && codePoint <= 0xe007f) || (codePoint >= 0xe0100 && codePoint <= 0xe01ef)){
+			return GRAPHEME_BREAK_EXTEND;
+		}
+		return GRAPHEME_BREAK_CONTROL;
+	}
+	return GRAPHEME_BREAK_OTHER;
+}
+
+/**
+ * Get the number of bytes in the utf8 encoding of a code point. Surrogates
+ * and code points past U+10FFFF are not encoded.
+ * @param codePoint The code point
+ * @returns {The number of bytes, or -1 for an invalid code point}
+ */
+static int _getCodePointUTF8Length(int codePoint){
+	if(codePoint < 0){
+		return -1;
+	}else if(codePoint < 0x80){
+		return 1;
+	}else if(codePoint < 0x800){
+		return 2;
+	}else if(codePoint < 0x10000){
+		return (codePoint >= 0xd800 && codePoint <= 0xdfff) ? -1 : 3;
+	}else if(codePoint <= 0x10ffff){
+		return 4;
+	}else{
+		return -1;
+	}
+}
+
+/**
+ * Write the utf8 encoding of a valid code point
+ * @param buffer The buffer that receives the bytes
+ * @param codePoint The code point
+ * @param numberOfBytes The length given by _getCodePointUTF8Length
+ */
+static void _encodeUTF8Character(char * buffer, int codePoint, int numberOfBytes){
+	switch(numberOfBytes){
+	case 1:
+		buffer[0] = (char)codePoint;
+		break;
+	case 2:
+		buffer[0] = (char)(0xc0 | (codePoint >> 6));
+		buffer[1] = (char)(0x80 | (codePoint & 0x3f));
+		break;
+	case 3:
+		buffer[0] = (char)(0xe0 | (codePoint >> 12));
+		buffer[1] = (char)(0x80 | ((codePoint >> 6) & 0x3f));
+		buffer[2] = (char)(0x80 | (codePoint & 0x3f));
+		break;
+	default:
+		buffer[0] = (char)(0xf0 | (codePoint >> 18));
+		buffer[1] = (char)(0x80 | ((codePoint >> 12) & 0x3f));
+		buffer[2] = (char)(0x80 | ((codePoint >> 6) & 0x3f));
+		buffer[3] = (char)(0x80 | (codePoint & 0x3f));
+		break;
+	}
+}
+
+#if defined(LANGUAGE_SSE2)
+/**
+ * Pack 16 ascii code points into 16 bytes
+ * @param buffer The buffer that receives the bytes
+ * @param codePoints The code points
+ * @returns {0 = a code point is not ascii and nothing was written, 1 = written}
+ */
+static int _encodeASCIIBlockSSE2(char * buffer, const int * codePoints){
+	__m128i first = _mm_loadu_si128((const __m128i *)codePoints);
+	__m128i second = _mm_loadu_si128((const __m128i *)(codePoints + 4));
+	__m128i third = _mm_loadu_si128((const __m128i *)(codePoints + 8));
+	__m128i fourth = _mm_loadu_si128((const __m128i *)(codePoints + 12));
+
+	// Negative code points have their high bits set as well
+	__m128i bits = _mm_or_si128(_mm_or_si128(first, second), _mm_or_si128(third, fourth));
+	__m128i high = _mm_and_si128(bits, _mm_set1_epi32(~0x7f));
+	if(_mm_movemask_epi8(_mm_cmpeq_epi32(high, _mm_setzero_si128())) != 0xffff){
+		return 0;
+	}
+	__m128i packed = _mm_packus_epi16(_mm_packs_epi32(first, second), _mm_packs_epi32(third, fourth));
+	_mm_storeu_si128((__m128i *)buffer, packed);
+	return 1;
+}
+#endif
+
+/**
+ * Encode a list of code points as utf8 into a buffer owned by the caller.
+ * Only whole characters are written, and no end of string is added. When
+ * the buffer is too small the characters that fit are written and the full
+ * size is still returned, so a NULL buffer asks for the size.
+ * @param buffer The buffer that receives the bytes, or NULL
+ * @param bufferCapacity The number of bytes in the buffer
+ * @param codePoints A list of utf8 code points
+ * @param numberOfCodePoints The number of code points in the list
+ * @returns {The number of bytes in the encoding, or -1 for an invalid code point}
+ */
+static long long encodeUTF8Into(char * buffer, size_t bufferCapacity, const int * codePoints, size_t numberOfCodePoints){
+	size_t r = 0;
+	size_t numberOfBytes = 0;
+	if(codePoints == NULL){
+		return numberOfCodePoints == 0 ? 0 : -1;
+	}
+	if(buffer == NULL){
+		bufferCapacity = 0;
+	}
+	while(r < numberOfCodePoints){
+		int codePoint = codePoints[r];
+#if defined(LANGUAGE_SSE2)
+		// Runs of ascii are packed a block at a time
+		if(codePoint >= 0 && codePoint < 0x80){
+			while(r + 16 <= numberOfCodePoints && numberOfBytes + 16 <= bufferCapacity &&
+					_encodeASCIIBlockSSE2(buffer + numberOfBytes, codePoints + r)){
+				r += 16;
+				numberOfBytes += 16;
+			}
+			if(r == numberOfCodePoints){
+				break;
+			}
+			codePoint = codePoints[r];
+		}
+#endif
+		int length = _getCodePointUTF8Length(codePoint);
+		if(length < 0){
+			return -1;
+		}
+		if(numberOfBytes + length <= bufferCapacity){
+			_encodeUTF8Character(buffer + numberOfBytes, codePoint, length);
+		}else{
+			// Keep what is written a prefix of the encoding
+			bufferCapacity = 0;
+		}
+		numberOfBytes += length;
+		r++;
+	}
+	return (long long)numberOfBytes;
+}
+
 /**
  * Convert a sequence of code points to a utf8 binary character. If there
  * are any invalid code points NULL is returned.
@@ -153,72 +615,23 @@ static int isDiacriticalMark(int codePoint){
  * @param numberOfCodePoints The number of code points in the list
  */
 static const char * converListOfCodePointsToUTF8Binary(const int * codePoints, int numberOfCodePoints){
-	int r;
+	if(numberOfCodePoints < 0){
+		return NULL;
+	}
 
-	// Find out how large the array needs to be to contain the
-	// information
-	const int * codePointIndex = codePoints;
-	int numberOfCharacters = 0;
-	for(r = 0; r < numberOfCodePoints; r++){
-		int codePoint = *codePointIndex;
-		if(codePoint < 0){
-			return NULL;
-		}else if(codePoint < 128){
-			numberOfCharacters++;
-		}else if(codePoint < 2048){
-			numberOfCharacters+= 2;
-		}else if(codePoint < 65536){
-			numberOfCharacters+= 3;
-		}else if(codePoint < 0x200000){
-			numberOfCharacters += 4;
-		}
-		codePointIndex++;
-	}
-
-	// Assign memory for the character array
-	numberOfCharacters++;		// For the end of the C-style string
-	char * buffer = (char*)(malloc(numberOfCharacters * sizeof(char)));
-
-	// Iterateve through the array
-	codePointIndex = codePoints;
-	int charCount = 0;
-	for(r = 0; r < numberOfCodePoints; r++){
-		int codePoint = *codePointIndex;
-		if(codePoint < 0){
-			return NULL;
-		}else if(codePoint < 128){
-			char c =  (char)codePoint;
-			buffer[charCount] = c;
-			charCount++;
-		}else if(codePoint < 2048){
-			int firstByte = 0x000007c0 & codePoint;
-			int secondByte = 0x0000003f & codePoint;
-			buffer[charCount] = (char)(0xc0 | (firstByte >> 6));
-			buffer[charCount + 1] = (char)(0x80 | secondByte);
-
-			charCount+= 2;
-		}else if(codePoint < 65536){
-			int firstByte = 0x0000f000 & codePoint;
-			int secondByte = 0x00000fc0 & codePoint;
-			int thirdByte = 0x0000003f & codePoint;
-			buffer[charCount] = (char)(0xe0 | (firstByte >> 12));
-			buffer[charCount + 1] = (char)(0x80 | (secondByte >> 6));
-			buffer[charCount + 2] = (char)(0x80 | thirdByte);
-			charCount+= 3;
-		}else if(codePoint < 0x200000){
-			int firstByte = 0x001c0000 & codePoint;
-			int secondByte = 0x0003f000 & codePoint;
-			int thirdByte = 0x00000fc0 & codePoint;
-			int fourthByte = 0x0000003f & codePoint;
-			buffer[charCount] = (char)(0xf0 | (firstByte >> 18));
-			buffer[charCount + 1] = (char)(0x80 | (secondByte >> 12));
-			buffer[charCount + 2] = (char)(0x80 | (thirdByte >> 6));
-			buffer[charCount + 3] = (char)(0x80 | fourthByte);
-			charCount += 4;
-		}
-		codePointIndex++;
-	}
-	buffer[numberOfCharacters - 1] = '\0';
+	// A code point takes at most 4 bytes, so the list is encoded in a
+	// single pass
+	size_t bufferCapacity = 4 * (size_t)numberOfCodePoints;
+	char * buffer = (char*)(malloc((bufferCapacity + 1) * sizeof(char)));
+	if(buffer == NULL){
+		return NULL;
+	}
+	long long numberOfBytes = encodeUTF8Into(buffer, bufferCapacity, codePoints, numberOfCodePoints);
+	if(numberOfBytes < 0){
+		free(buffer);
+		return NULL;
+	}
+	buffer[numberOfBytes] = '\0';
 	return buffer;
 }
 
@@ -228,50 +641,17 @@ static const char * converListOfCodePointsToUTF8Binary(const int * codePoints, i
  * @param codePoint The UTF8 code point
  */
 static const char * convertCodePointToUTF8Binary(int codePoint){
-	if(codePoint < 0){
+	int numberOfBytes = _getCodePointUTF8Length(codePoint);
+	if(numberOfBytes < 0){
 		return NULL;
-	}else if(codePoint < 128){
-
-		// Get the ascii range of utf8
-		char c =  (char)codePoint;
-		char * buffer = (char*)(malloc(2 * sizeof(char)));
-		buffer[0] = c;
-		buffer[1] = '\0';
-		return buffer;
-	}else if(codePoint < 2048){
-		int firstByte = 0x000007c0 & codePoint;
-		int secondByte = 0x0000003f & codePoint;
-		char * buffer = (char*)(malloc(3 * sizeof(char)));
-		buffer[0] = (char)(0xc0 | (firstByte >> 6));
-		buffer[1] = (char)(0x80 | secondByte);
-		buffer[2] = '\0';
-		return buffer;
-	}else if(codePoint < 65536){
-		// Setup the first 3 bytes
-		int firstByte = 0x0000f000 & codePoint;
-		int secondByte = 0x00000fc0 & codePoint;
-		int thirdByte = 0x0000003f & codePoint;
-		char * buffer = (char*)(malloc(4 * sizeof(char)));
-		buffer[0] = (char)(0xe0 | (firstByte >> 12));
-		buffer[1] = (char)(0x80 | (secondByte >> 6));
-		buffer[2] = (char)(0x80 | thirdByte);
-		buffer[3] = '\0';
-		return buffer;
-	}else if(codePoint < 0x200000){
-		int firstByte = 0x001c0000 & codePoint;
-		int secondByte = 0x0003f000 & codePoint;
-		int thirdByte = 0x00000fc0 & codePoint;
-		int fourthByte = 0x0000003f & codePoint;
-		char * buffer = (char*)(malloc(5 * sizeof(char)));
-		buffer[0] = (char)(0xf0 | (firstByte >> 18));
-		buffer[1] = (char)(0x80 | (secondByte >> 12));
-		buffer[2] = (char)(0x80 | (thirdByte >> 6));
-		buffer[4] = (char)(0x80 | fourthByte);
-		buffer[5] = '\0';
-		return buffer;
-	}else{
+	}
+	char * buffer = (char*)(malloc((numberOfBytes + 1) * sizeof(char)));
+	if(buffer == NULL){
 		return NULL;
 	}
+	_encodeUTF8Character(buffer, codePoint, numberOfBytes);
+	buffer[numberOfBytes] = '\0';
+	return buffer;
 }
 
 /**
@@ -280,53 +660,28 @@ static const char * convertCodePointToUTF8Binary(int codePoint){
  * @returns {A utf8 code point, or -1 for error}
  */
 static int convertUTF8BinaryToCodePoint(const char * charValue){
-	char c = *charValue;
-	const char * characterPointer = charValue;
-	int utf8ParseState = getUTF8State(c);
-	if(utf8ParseState == UTF8_BINARY_7BIT_STATE){
-		return c;
-	}else if(utf8ParseState == UTF8_BINARY_11BIT_STATE){
-		characterPointer++;
-		if(characterPointer == '\0'){
-			return -1;
-		}
-		char firstBit = *characterPointer;
-		return ((c & 0x1f) << 6) + (firstBit & 0x3f);
-	}else if(utf8ParseState == UTF8_BINARY_16BIT_STATE){
-		characterPointer++;
-		if(characterPointer == '\0'){
-			return -1;
-		}
-		char secondBit = *characterPointer;
-
-		characterPointer++;
-		if(characterPointer == '\0'){
-			return -1;
-		}
-		char firstBit = *characterPointer;
-		return ((c & 0xf) << 12) + ((secondBit & 0x3f) << 6) + (firstBit & 0x3f);
-	}else if(utf8ParseState == UTF8_BINARY_21BIT_STATE){
-		characterPointer++;
-		if(characterPointer == '\0'){
-			return -1;
-		}
-		char thirdBit = *characterPointer;
-
-		characterPointer++;
-		if(characterPointer == '\0'){
-			return -1;
-		}
-		char secondBit = *characterPointer;
+	// A utf8 character is at most four bytes long and the decoder rejects the
+	// null terminator as a continuation byte, so it never reads past the string
+	int codePoint;
+	if(decodeUTF8Character(charValue, 4, &codePoint) == -1){
+		return -1;
+	}
+	return codePoint;
+}
 
-		characterPointer++;
-		if(characterPointer == '\0'){
-			return -1;
-		}
-		char firstBit = *characterPointer;
-		return ((c & 0x7) << 18) + ((thirdBit & 0x3f) << 12) + ((secondBit & 0x3f) << 6) + (firstBit & 0x3f);
-	}else{
+/**
+ * Covert a utf binary character into a code point without reading past the
+ * end of the buffer
+ * @param charValue The first character of a buffer to convert into a codepoint
+ * @param numberOfBytes The number of bytes left in the buffer
+ * @returns {A utf8 code point, or -1 for error}
+ */
+static int convertUTF8BinaryToCodePointBounded(const char * charValue, size_t numberOfBytes){
+	int codePoint;
+	if(charValue == NULL || decodeUTF8Character(charValue, numberOfBytes, &codePoint) == -1){
 		return -1;
 	}
+	return codePoint;
 }
 
 /**
@@ -368,6 +723,40 @@ static int isUTF8BinaryCharacterInUTFSet(const char * charValue, int *codePoints
 	return 0;
 }
 
+/**
+ * Get the classes of a utf8 or utf16 character in a language. The character
+ * is decoded once, and not at all when it is ascii.
+ * @param charValue The character
+ * @param encoding UTF8_BINARY or UTF16
+ * @param language The language of the character
+ * @returns {The characterClasses bits of the character, 0 for an invalid character}
+ */
+static int _getUnicodeCharacterClasses(const char * charValue, int encoding, int language){
+	int codePoint = _getFirstCodeUnit(charValue, encoding);
+	if(codePoint < 0 || codePoint >= 0x80){
+		if(encoding == UTF16){
+			if(decodeUTF16Character(charValue, 4, &codePoint) == -1){
+				return 0;
+			}
+		}else{
+			codePoint = convertUTF8BinaryToCodePoint(charValue);
+		}
+	}
+	return getUnicodeCharacterClasses(codePoint, language);
+}
+
+/**
+ * Check the classes of a utf8 or utf16 character
+ * @param charValue The character to check
+ * @param encoding UTF8_BINARY or UTF16
+ * @param language The language of the character
+ * @param characterClass The classes to look for
+ * @returns {0 = false, 1 = true}
+ */
+static int _isUnicodeClass(const char * charValue, int encoding, int language, int characterClass){
+	return (_getUnicodeCharacterClasses(charValue, encoding, language) & characterClass) != 0;
+}
+
 
 
 /**
@@ -378,11 +767,14 @@ static int isUTF8BinaryCharacterInUTFSet(const char * charValue, int *codePoints
  * @returns {0 = false, 1 = true}
  */
 static int isInRomanceAlphabet(const char * charValue, int encoding){
-	if(encoding == UTF8_BINARY || encoding == ASCII || encoding == ISO_8859_1){
-		if(*charValue >= 65 && *charValue <= 90){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_ROMANCE);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		int value = _getFirstCodeUnit(charValue, encoding);
+		if(value >= 65 && value <= 90){
 			return 1; // a-z
 		}
-		if(*charValue >= 97 && *charValue <= 122){
+		if(value >= 97 && value <= 122){
 			return 1; // A-Z
 		}
 		return 0;
@@ -394,916 +786,4009 @@ static int isInRomanceAlphabet(const char * charValue, int encoding){
 
 
 /**
- * Return the UTF8 binary string length
+ * Return the UTF8 binary string length with the table driven utf8 decoder
  * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
  */
-static int _lenUTF8Binary(const char * buffer){
-	// Handle the UTF8 encoding
+static int _lenUTF8BinaryScalar(const char * buffer, size_t numberOfBytes){
 	int stringLength = 0;								// The current length of the string
-	int effectiveUTFValue = 0;							// The effective utf8 value as an integer
-	int utf8ParseState = UTF8_BINARY_START_PARSE_STATE;	// The utf8 parser state
-	const char * characterPointer = buffer;				// A pointer to the correct position in the buffer
-	while(*characterPointer != '\0'){
-
-		// Grab our character
-		char c = *characterPointer;
-
-		// Enter the UTF8 character state machine. The first portion of the
-		// state machine is the extraction of the
-		if(utf8ParseState == UTF8_BINARY_START_PARSE_STATE){
-			utf8ParseState = getUTF8State(c);
-		}
-		// Switch between all of the different binary states for the UTF8
-		// standard
-		if(utf8ParseState == UTF8_BINARY_7BIT_STATE){
-			// This state is simple as it an ASCII character. Increment the string length by one,
-			// and return to the start parse state
-			stringLength++;
-			utf8ParseState = UTF8_BINARY_START_PARSE_STATE;
-		}else if(utf8ParseState == UTF8_BINARY_11BIT_STATE){
-			// This portion of UTF8 encodes the code points between 0x0080 and 0x7ff
-			// This portion of the UTF8 contains the combining diacritical marks specified
-			// in unicode version 1.0(0x0300 - 0x036f)
-			characterPointer++;
-			if(characterPointer == '\0'){
-				return UTF8_BINARY_ERROR_STATE;
-			}
-			char firstBit = *characterPointer;
-
-			effectiveUTFValue = ((c & 0x1f) << 6) + (firstBit & 0x3f);
-			if(!isDiacriticalMark(effectiveUTFValue)){
-				stringLength++;
-			}
+	unsigned int decoderState = UTF8_DECODER_ACCEPT;	// The utf8 decoder state
+	unsigned int codePoint = 0;							// The code point decoded so far
+	size_t index;
+	for(index = 0; index < numberOfBytes; index++){
+		decodeUTF8Byte(&decoderState, &codePoint, (unsigned char)buffer[index]);
+		if(decoderState == UTF8_DECODER_ACCEPT){
+			// Combining diacritical marks are part of the previous character, and
+			// the four byte characters are not counted by len
+			stringLength += (codePoint < 0x10000) & !isDiacriticalMark((int)codePoint);
+		}else if(decoderState == UTF8_DECODER_REJECT){
+			return UTF8_BINARY_ERROR_STATE;
+		}
+	}
 
-			utf8ParseState = UTF8_BINARY_START_PARSE_STATE;
-		}else if(utf8ParseState == UTF8_BINARY_16BIT_STATE){
-			// This portion of UTF8 encodes the code points between 0x0800 and 0xffff
-			// This portion of the UTF8 contains the combining diacritical marks specified
-			// in unicode version 7.0(0x1ab0-0x1aff), 1.0(0x20d0-0x20ff), 1.0(0xfe20-0xfe2f)
-			characterPointer++;
-			if(characterPointer == '\0'){
-				return UTF8_BINARY_ERROR_STATE;
-			}
-			char secondBit = *characterPointer;
+	// The buffer ended in the middle of a character
+	if(decoderState != UTF8_DECODER_ACCEPT){
+		return UTF8_BINARY_ERROR_STATE;
+	}
+	return stringLength;
+}
 
-			characterPointer++;
-			if(characterPointer == '\0'){
-				return UTF8_BINARY_ERROR_STATE;
+/**
+ * Count the set bits of a vector comparison mask
+ * @param mask The mask returned by a movemask instruction
+ */
+static int _popCount(unsigned int mask){
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_popcount(mask);
+#else
+	int count = 0;
+	while(mask){
+		mask &= mask - 1;
+		count++;
+	}
+	return count;
+#endif
+}
+
+/**
+ * Count the zero bits below the lowest set bit of a mask
+ * @param mask The mask, which must not be 0
+ */
+static int _countTrailingZeros(unsigned int mask){
+#if defined(__GNUC__) || defined(__clang__)
+	return __builtin_ctz(mask);
+#else
+	int count = 0;
+	while((mask & 1) == 0){
+		mask >>= 1;
+		count++;
+	}
+	return count;
+#endif
+}
+
+#if defined(LANGUAGE_SSE2)
+/**
+ * Check which bytes of a vector are in an unsigned range
+ * @param value The bytes to check
+ * @param low The lower bound(inclusive)
+ * @param high The upper bound(inclusive)
+ */
+static __m128i _inRangeSSE2(__m128i value, unsigned char low, unsigned char high){
+	__m128i clamped = _mm_min_epu8(_mm_max_epu8(value, _mm_set1_epi8((char)low)), _mm_set1_epi8((char)high));
+	return _mm_cmpeq_epi8(clamped, value);
+}
+
+/**
+ * Find the combining diacritical marks that start in a vector of bytes. The
+ * marks are found through the utf8 encoding of their ranges:
+ * 0x0300-0x036f = cc 80-bf, cd 80-af
+ * 0x1ab0-0x1aff = e1 aa b0-bf, e1 ab 80-bf
+ * 0x20d0-0x20ff = e2 83 90-bf
+ * 0xfe20-0xfe2f = ef b8 a0-af
+ * @param first The bytes to check
+ * @param second The bytes following first
+ * @param third The bytes following second
+ */
+static __m128i _diacriticalMarksSSE2(__m128i first, __m128i second, __m128i third){
+	__m128i marks = _mm_cmpeq_epi8(first, _mm_set1_epi8((char)0xcc));
+	marks = _mm_or_si128(marks, _mm_and_si128(_mm_cmpeq_epi8(first, _mm_set1_epi8((char)0xcd)),
+			_inRangeSSE2(second, 0x80, 0xaf)));
+
+	__m128i e1 = _mm_cmpeq_epi8(first, _mm_set1_epi8((char)0xe1));
+	__m128i e1Second = _mm_or_si128(_mm_and_si128(_mm_cmpeq_epi8(second, _mm_set1_epi8((char)0xaa)),
+			_inRangeSSE2(third, 0xb0, 0xbf)), _mm_cmpeq_epi8(second, _mm_set1_epi8((char)0xab)));
+	marks = _mm_or_si128(marks, _mm_and_si128(e1, e1Second));
+
+	__m128i e2 = _mm_and_si128(_mm_cmpeq_epi8(first, _mm_set1_epi8((char)0xe2)),
+			_mm_cmpeq_epi8(second, _mm_set1_epi8((char)0x83)));
+	marks = _mm_or_si128(marks, _mm_and_si128(e2, _inRangeSSE2(third, 0x90, 0xbf)));
+
+	__m128i ef = _mm_and_si128(_mm_cmpeq_epi8(first, _mm_set1_epi8((char)0xef)),
+			_mm_cmpeq_epi8(second, _mm_set1_epi8((char)0xb8)));
+	return _mm_or_si128(marks, _mm_and_si128(ef, _inRangeSSE2(third, 0xa0, 0xaf)));
+}
+
+/**
+ * Find the bytes of a vector that break the utf8 encoding. Every continuation
+ * byte must be claimed by exactly one lead byte one to three bytes back, the
+ * byte after e0, ed, f0 and f4 has a narrower range, and c0, c1 and f5-ff are
+ * never valid. Like the lookup tables of the AVX2 kernel, a bad lead byte is
+ * found from the byte after it, so the last byte of a vector is checked with
+ * the next vector.
+ * @param input The bytes to check
+ * @param previousInput The 16 bytes before input
+ * @returns {A vector that is not zero where the encoding is broken}
+ */
+static __m128i _utf8ErrorsSSE2(__m128i input, __m128i previousInput){
+	// Flip the sign bits so that the signed compares of SSE2 order the bytes
+	// as unsigned values, 0x80 becomes 0x00
+	const __m128i signBits = _mm_set1_epi8((char)0x80);
+	__m128i flipped = _mm_xor_si128(input, signBits);
+	__m128i flippedPrevious = _mm_xor_si128(previousInput, signBits);
+	__m128i previous1 = _mm_or_si128(_mm_slli_si128(flipped, 1), _mm_srli_si128(flippedPrevious, 15));
+	__m128i previous2 = _mm_or_si128(_mm_slli_si128(flipped, 2), _mm_srli_si128(flippedPrevious, 14));
+	__m128i previous3 = _mm_or_si128(_mm_slli_si128(flipped, 3), _mm_srli_si128(flippedPrevious, 13));
+
+	// Continuation bytes against the lead bytes c0-ff, e0-ff and f0-ff
+	__m128i continuation = _mm_cmpeq_epi8(_mm_and_si128(input, _mm_set1_epi8((char)0xc0)), signBits);
+	__m128i claimed = _mm_or_si128(_mm_cmpgt_epi8(previous1, _mm_set1_epi8(0x3f)),
+			_mm_or_si128(_mm_cmpgt_epi8(previous2, _mm_set1_epi8(0x5f)), _mm_cmpgt_epi8(previous3, _mm_set1_epi8(0x6f))));
+	__m128i errors = _mm_xor_si128(continuation, claimed);
+
+	// The lead bytes c0, c1 and f5-ff
+	errors = _mm_or_si128(errors, _mm_and_si128(_mm_cmpgt_epi8(previous1, _mm_set1_epi8(0x3f)),
+			_mm_cmplt_epi8(previous1, _mm_set1_epi8(0x42))));
+	errors = _mm_or_si128(errors, _mm_cmpgt_epi8(previous1, _mm_set1_epi8(0x74)));
+
+	// The byte after e0 must be a0-bf, after ed 80-9f, after f0 90-bf and after
+	// f4 80-8f. Anything that is not a continuation byte is already an error.
+	errors = _mm_or_si128(errors, _mm_and_si128(_mm_cmpeq_epi8(previous1, _mm_set1_epi8(0x60)),
+			_mm_cmplt_epi8(flipped, _mm_set1_epi8(0x20))));
+	errors = _mm_or_si128(errors, _mm_and_si128(_mm_cmpeq_epi8(previous1, _mm_set1_epi8(0x6d)),
+			_mm_cmpgt_epi8(flipped, _mm_set1_epi8(0x1f))));
+	errors = _mm_or_si128(errors, _mm_and_si128(_mm_cmpeq_epi8(previous1, _mm_set1_epi8(0x70)),
+			_mm_cmplt_epi8(flipped, _mm_set1_epi8(0x10))));
+	return _mm_or_si128(errors, _mm_and_si128(_mm_cmpeq_epi8(previous1, _mm_set1_epi8(0x74)),
+			_mm_cmpgt_epi8(flipped, _mm_set1_epi8(0x0f))));
+}
+
+/**
+ * Find the lead bytes at the end of a vector whose characters continue in the
+ * next vector
+ * @param input The bytes to check
+ * @returns {A vector that is not zero where a character is cut off}
+ */
+static __m128i _utf8IncompleteSSE2(__m128i input){
+	const __m128i maximum = _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			(char)(0xf0 - 1), (char)(0xe0 - 1), (char)(0xc0 - 1));
+	return _mm_subs_epu8(input, maximum);
+}
+#endif
+
+#if defined(LANGUAGE_AVX2)
+/**
+ * Check which bytes of a vector are in an unsigned range
+ * @param value The bytes to check
+ * @param low The lower bound(inclusive)
+ * @param high The upper bound(inclusive)
+ */
+static __m256i _inRangeAVX2(__m256i value, unsigned char low, unsigned char high){
+	__m256i clamped = _mm256_min_epu8(_mm256_max_epu8(value, _mm256_set1_epi8((char)low)), _mm256_set1_epi8((char)high));
+	return _mm256_cmpeq_epi8(clamped, value);
+}
+
+/**
+ * Find the combining diacritical marks that start in a vector of bytes. See
+ * _diacriticalMarksSSE2 for the byte ranges.
+ * @param first The bytes to check
+ * @param second The bytes following first
+ * @param third The bytes following second
+ */
+static __m256i _diacriticalMarksAVX2(__m256i first, __m256i second, __m256i third){
+	__m256i marks = _mm256_cmpeq_epi8(first, _mm256_set1_epi8((char)0xcc));
+	marks = _mm256_or_si256(marks, _mm256_and_si256(_mm256_cmpeq_epi8(first, _mm256_set1_epi8((char)0xcd)),
+			_inRangeAVX2(second, 0x80, 0xaf)));
+
+	__m256i e1 = _mm256_cmpeq_epi8(first, _mm256_set1_epi8((char)0xe1));
+	__m256i e1Second = _mm256_or_si256(_mm256_and_si256(_mm256_cmpeq_epi8(second, _mm256_set1_epi8((char)0xaa)),
+			_inRangeAVX2(third, 0xb0, 0xbf)), _mm256_cmpeq_epi8(second, _mm256_set1_epi8((char)0xab)));
+	marks = _mm256_or_si256(marks, _mm256_and_si256(e1, e1Second));
+
+	__m256i e2 = _mm256_and_si256(_mm256_cmpeq_epi8(first, _mm256_set1_epi8((char)0xe2)),
+			_mm256_cmpeq_epi8(second, _mm256_set1_epi8((char)0x83)));
+	marks = _mm256_or_si256(marks, _mm256_and_si256(e2, _inRangeAVX2(third, 0x90, 0xbf)));
+
+	__m256i ef = _mm256_and_si256(_mm256_cmpeq_epi8(first, _mm256_set1_epi8((char)0xef)),
+			_mm256_cmpeq_epi8(second, _mm256_set1_epi8((char)0xb8)));
+	return _mm256_or_si256(marks, _mm256_and_si256(ef, _inRangeAVX2(third, 0xa0, 0xaf)));
+}
+
+/**
+ * Find the bytes of a vector that break the utf8 encoding with the nibble
+ * lookup tables of Keiser and Lemire. The high and low nibble of every byte
+ * and the high nibble of the byte after it each select the errors they allow,
+ * and an error is left where all three agree. The third and fourth bytes of
+ * a character are checked against the lead byte two and three bytes back.
+ * @param input The bytes to check
+ * @param previousInput The 32 bytes before input
+ * @returns {A vector that is not zero where the encoding is broken}
+ */
+static __m256i _utf8ErrorsAVX2(__m256i input, __m256i previousInput){
+	// The error bits of the tables
+	const char tooShort = 1 << 0;		// A lead byte or ascii followed by a lead byte or ascii
+	const char tooLong = 1 << 1;		// Ascii followed by a continuation byte
+	const char overlong3 = 1 << 2;		// e0 80-9f
+	const char tooLarge = 1 << 3;		// f4 90-bf, f5-ff 90-bf
+	const char surrogate = 1 << 4;		// ed a0-bf
+	const char overlong2 = 1 << 5;		// c0-c1 80-bf
+	const char tooLarge1000 = 1 << 6;	// f5-ff 80-8f
+	const char overlong4 = 1 << 6;		// f0 80-8f
+	const char twoContinuations = (char)(1 << 7);	// A continuation byte followed by a continuation byte
+	const char carry = tooShort | tooLong | twoContinuations;
+
+	const __m256i byte1High = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+			tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong, tooLong,
+			twoContinuations, twoContinuations, twoContinuations, twoContinuations,
+			tooShort | overlong2, tooShort, tooShort | overlong3 | surrogate,
+			tooShort | tooLarge | tooLarge1000 | overlong4));
+	const __m256i byte1Low = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+			carry | overlong3 | overlong2 | overlong4, carry | overlong2, carry, carry,
+			carry | tooLarge, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000, carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000 | surrogate, carry | tooLarge | tooLarge1000,
+			carry | tooLarge | tooLarge1000));
+	const __m256i byte2High = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+			tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort, tooShort,
+			tooLong | overlong2 | twoContinuations | overlong3 | tooLarge1000 | overlong4,
+			tooLong | overlong2 | twoContinuations | overlong3 | tooLarge,
+			tooLong | overlong2 | twoContinuations | surrogate | tooLarge,
+			tooLong | overlong2 | twoContinuations | surrogate | tooLarge,
+			tooShort, tooShort, tooShort, tooShort));
+
+	// The bytes one to three positions back
+	__m256i shifted = _mm256_permute2x128_si256(previousInput, input, 0x21);
+	__m256i previous1 = _mm256_alignr_epi8(input, shifted, 15);
+	__m256i previous2 = _mm256_alignr_epi8(input, shifted, 14);
+	__m256i previous3 = _mm256_alignr_epi8(input, shifted, 13);
+
+	const __m256i nibbleMask = _mm256_set1_epi8(0x0f);
+	__m256i errors = _mm256_and_si256(
+			_mm256_shuffle_epi8(byte1High, _mm256_and_si256(_mm256_srli_epi16(previous1, 4), nibbleMask)),
+			_mm256_shuffle_epi8(byte1Low, _mm256_and_si256(previous1, nibbleMask)));
+	errors = _mm256_and_si256(errors,
+			_mm256_shuffle_epi8(byte2High, _mm256_and_si256(_mm256_srli_epi16(input, 4), nibbleMask)));
+
+	// Only the third byte after an e0-ff lead and the fourth byte after an f0-ff
+	// lead may be a continuation byte following a continuation byte
+	__m256i thirdByte = _mm256_subs_epu8(previous2, _mm256_set1_epi8((char)(0xe0 - 0x80)));
+	__m256i fourthByte = _mm256_subs_epu8(previous3, _mm256_set1_epi8((char)(0xf0 - 0x80)));
+	__m256i expected = _mm256_and_si256(_mm256_or_si256(thirdByte, fourthByte), _mm256_set1_epi8((char)0x80));
+	return _mm256_xor_si256(errors, expected);
+}
+
+/**
+ * Find the lead bytes at the end of a vector whose characters continue in the
+ * next vector
+ * @param input The bytes to check
+ * @returns {A vector that is not zero where a character is cut off}
+ */
+static __m256i _utf8IncompleteAVX2(__m256i input){
+	const __m256i maximum = _mm256_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			(char)(0xf0 - 1), (char)(0xe0 - 1), (char)(0xc0 - 1));
+	return _mm256_subs_epu8(input, maximum);
+}
+#endif
+
+/**
+ * Count the characters of a utf8 binary buffer a vector at a time. Every byte
+ * that starts a 1-3 byte character is counted, and the combining diacritical
+ * marks are subtracted. The encoding is validated along the way. Only whole
+ * vectors are processed, and the last character of the vectors may continue
+ * past the processed bytes.
+ * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param processed The number of bytes consumed by the vectors
+ * @returns {The character count, or -1 for invalid utf8}
+ */
+static int _lenUTF8BinaryBlocks(const char * buffer, size_t numberOfBytes, size_t * processed){
+	int stringLength = 0;
+	size_t index = 0;
+
+	// The two bytes after a vector are needed to find the diacritical marks, and
+	// three bytes to make sure the last character of the vector is complete.
+#if defined(LANGUAGE_AVX2)
+	const __m256i continuationMask = _mm256_set1_epi8((char)0xc0);
+	const __m256i continuationBits = _mm256_set1_epi8((char)0x80);
+	__m256i previous = _mm256_setzero_si256();
+	__m256i incomplete = _mm256_setzero_si256();
+	__m256i errors = _mm256_setzero_si256();
+	for(; index + 32 + 3 <= numberOfBytes; index += 32){
+		__m256i first = _mm256_loadu_si256((const __m256i *)(buffer + index));
+		unsigned int highBits = (unsigned int)_mm256_movemask_epi8(first);
+		if(highBits == 0){
+			errors = _mm256_or_si256(errors, incomplete);
+			incomplete = _mm256_setzero_si256();
+			previous = first;
+			stringLength += 32;
+			continue;
+		}
+		__m256i second = _mm256_loadu_si256((const __m256i *)(buffer + index + 1));
+		__m256i third = _mm256_loadu_si256((const __m256i *)(buffer + index + 2));
+		errors = _mm256_or_si256(errors, _utf8ErrorsAVX2(first, previous));
+		incomplete = _utf8IncompleteAVX2(first);
+		previous = first;
+
+		// Find the lead bytes of the characters that are counted
+		__m256i continuation = _mm256_cmpeq_epi8(_mm256_and_si256(first, continuationMask), continuationBits);
+		__m256i fourByte = _inRangeAVX2(first, 0xf0, 0xff);
+		unsigned int leads = ~(unsigned int)_mm256_movemask_epi8(_mm256_or_si256(continuation, fourByte));
+		unsigned int marks = (unsigned int)_mm256_movemask_epi8(_diacriticalMarksAVX2(first, second, third));
+		stringLength += _popCount(leads) - _popCount(marks);
+	}
+	if(!_mm256_testz_si256(errors, errors)){
+		return UTF8_BINARY_ERROR_STATE;
+	}
+#endif
+#if defined(LANGUAGE_SSE2)
+	const __m128i continuationMask128 = _mm_set1_epi8((char)0xc0);
+	const __m128i continuationBits128 = _mm_set1_epi8((char)0x80);
+	__m128i previous128 = index >= 16 ? _mm_loadu_si128((const __m128i *)(buffer + index - 16)) : _mm_setzero_si128();
+	__m128i incomplete128 = _utf8IncompleteSSE2(previous128);
+	__m128i errors128 = _mm_setzero_si128();
+	for(; index + 16 + 3 <= numberOfBytes; index += 16){
+		__m128i first = _mm_loadu_si128((const __m128i *)(buffer + index));
+		unsigned int highBits = (unsigned int)_mm_movemask_epi8(first);
+		if(highBits == 0){
+			errors128 = _mm_or_si128(errors128, incomplete128);
+			incomplete128 = _mm_setzero_si128();
+			previous128 = first;
+			stringLength += 16;
+			continue;
+		}
+		__m128i second = _mm_loadu_si128((const __m128i *)(buffer + index + 1));
+		__m128i third = _mm_loadu_si128((const __m128i *)(buffer + index + 2));
+		errors128 = _mm_or_si128(errors128, _utf8ErrorsSSE2(first, previous128));
+		incomplete128 = _utf8IncompleteSSE2(first);
+		previous128 = first;
+
+		// Find the lead bytes of the characters that are counted
+		__m128i continuation = _mm_cmpeq_epi8(_mm_and_si128(first, continuationMask128), continuationBits128);
+		__m128i fourByte = _inRangeSSE2(first, 0xf0, 0xff);
+		unsigned int leads = ~(unsigned int)_mm_movemask_epi8(_mm_or_si128(continuation, fourByte)) & 0xffff;
+		unsigned int marks = (unsigned int)_mm_movemask_epi8(_diacriticalMarksSSE2(first, second, third));
+		stringLength += _popCount(leads) - _popCount(marks);
+	}
+	if(_mm_movemask_epi8(_mm_cmpeq_epi8(errors128, _mm_setzero_si128())) != 0xffff){
+		return UTF8_BINARY_ERROR_STATE;
+	}
+#else
+	(void)buffer;
+	(void)numberOfBytes;
+#endif
+	*processed = index;
+	return stringLength;
+}
+
+/**
+ * Find the lead byte of the character that a block boundary cuts in two. The
+ * vector kernels find a bad lead byte from the byte after it, so a bad lead
+ * byte right before the boundary is returned as well.
+ * @param buffer The buffer that contains the string
+ * @param index The block boundary
+ * @returns {The index of the lead byte, or index when no character is cut}
+ */
+static size_t _utf8CharacterStart(const char * buffer, size_t index){
+	size_t lead = index;
+	while(lead > 0 && index - lead < 3){
+		lead--;
+		if((buffer[lead] & 0xc0) != 0x80){
+			if(lead + getCharacterStrideLength(buffer + lead, UTF8_BINARY) > index ||
+					getUTF8State(buffer[lead]) == UTF8_BINARY_ERROR_STATE){
+				return lead;
+			}
+			return index;
+		}
+	}
+	return index;
+}
+
+/**
+ * Return the UTF8 binary string length of a bounded buffer. The bulk of the
+ * string is counted by the vector kernels and the remainder by the utf8 decoder.
+ * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
+ */
+static int _lenUTF8BinaryBounded(const char * buffer, size_t numberOfBytes){
+	size_t index = 0;
+	int stringLength = _lenUTF8BinaryBlocks(buffer, numberOfBytes, &index);
+	if(stringLength < 0){
+		return UTF8_BINARY_ERROR_STATE;
+	}
+
+	// The last character counted in the vectors may continue past them. Its
+	// continuation bytes have not been validated yet.
+	size_t lead = _utf8CharacterStart(buffer, index);
+	if(lead != index){
+		int codePoint;
+		int strideLength = decodeUTF8Character(buffer + lead, numberOfBytes - lead, &codePoint);
+		if(strideLength == -1){
+			return UTF8_BINARY_ERROR_STATE;
+		}
+		index = lead + strideLength;
+	}
+	int remainingLength = _lenUTF8BinaryScalar(buffer + index, numberOfBytes - index);
+	if(remainingLength < 0){
+		return UTF8_BINARY_ERROR_STATE;
+	}
+	return stringLength + remainingLength;
+}
+
+#if defined(LANGUAGE_SSE2)
+/**
+ * Compare every code unit of a vector with an unsigned range. SSE2 has no
+ * unsigned 16 bit compares, so the range is moved to the bottom of the signed
+ * range first.
+ * @param value The code units to check
+ * @param low The low end of the range
+ * @param high The high end of the range
+ */
+static __m128i _inRangeUTF16SSE2(__m128i value, unsigned short low, unsigned short high){
+	__m128i offset = _mm_xor_si128(_mm_sub_epi16(value, _mm_set1_epi16((short)low)), _mm_set1_epi16((short)0x8000));
+	return _mm_cmplt_epi16(offset, _mm_set1_epi16((short)((high - low + 1) ^ 0x8000)));
+}
+
+/**
+ * Count the characters of a vector of utf16 code units without surrogates
+ * @param input The code units to count
+ */
+static int _lenUTF16BlockSSE2(__m128i input){
+	__m128i marks = _mm_or_si128(_mm_or_si128(_inRangeUTF16SSE2(input, 0x300, 0x36f), _inRangeUTF16SSE2(input, 0x1ab0, 0x1aff)),
+			_mm_or_si128(_inRangeUTF16SSE2(input, 0x20d0, 0x20ff), _inRangeUTF16SSE2(input, 0xfe20, 0xfe2f)));
+	return 8 - _popCount(_mm_movemask_epi8(marks)) / 2;
+}
+#endif
+
+#if defined(LANGUAGE_AVX2)
+/**
+ * Compare every code unit of a vector with an unsigned range
+ * @param value The code units to check
+ * @param low The low end of the range
+ * @param high The high end of the range
+ */
+static __m256i _inRangeUTF16AVX2(__m256i value, unsigned short low, unsigned short high){
+	__m256i clamped = _mm256_min_epu16(_mm256_max_epu16(value, _mm256_set1_epi16((short)low)), _mm256_set1_epi16((short)high));
+	return _mm256_cmpeq_epi16(clamped, value);
+}
+
+/**
+ * Count the characters of a vector of utf16 code units without surrogates
+ * @param input The code units to count
+ */
+static int _lenUTF16BlockAVX2(__m256i input){
+	__m256i marks = _mm256_or_si256(_mm256_or_si256(_inRangeUTF16AVX2(input, 0x300, 0x36f), _inRangeUTF16AVX2(input, 0x1ab0, 0x1aff)),
+			_mm256_or_si256(_inRangeUTF16AVX2(input, 0x20d0, 0x20ff), _inRangeUTF16AVX2(input, 0xfe20, 0xfe2f)));
+	return 16 - _popCount((unsigned int)_mm256_movemask_epi8(marks)) / 2;
+}
+#endif
+
+/**
+ * Count the characters of a utf16 buffer a vector at a time, up to the first
+ * vector that holds a surrogate
+ * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param stringLength The length that the characters are added to
+ * @returns {The number of bytes that were counted}
+ */
+static size_t _lenUTF16Blocks(const char * buffer, size_t numberOfBytes, int * stringLength){
+	size_t index = 0;
+#if defined(LANGUAGE_AVX2)
+	const __m256i surrogateMask256 = _mm256_set1_epi16((short)0xf800);
+	const __m256i surrogates256 = _mm256_set1_epi16((short)0xd800);
+	for(; index + 32 <= numberOfBytes; index += 32){
+		__m256i input = _mm256_loadu_si256((const __m256i *)(buffer + index));
+		if(_mm256_movemask_epi8(_mm256_cmpeq_epi16(_mm256_and_si256(input, surrogateMask256), surrogates256)) != 0){
+			return index;
+		}
+		*stringLength += _lenUTF16BlockAVX2(input);
+	}
+#endif
+#if defined(LANGUAGE_SSE2)
+	const __m128i surrogateMask = _mm_set1_epi16((short)0xf800);
+	const __m128i surrogates = _mm_set1_epi16((short)0xd800);
+	for(; index + 16 <= numberOfBytes; index += 16){
+		__m128i input = _mm_loadu_si128((const __m128i *)(buffer + index));
+		if(_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(input, surrogateMask), surrogates)) != 0){
+			return index;
+		}
+		*stringLength += _lenUTF16BlockSSE2(input);
+	}
+#else
+	(void)buffer;
+	(void)numberOfBytes;
+	(void)stringLength;
+#endif
+	return index;
+}
+
+/**
+ * Return the length of a bounded utf16 string. Like utf8, combining
+ * diacritical marks and the characters past U+FFFF are not counted, so a
+ * string has the same length in both encodings. The vectors with a surrogate
+ * are decoded a character at a time.
+ * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
+ * @returns {The length of the string, or -1 for an unpaired surrogate or a cut off code unit}
+ */
+static int _lenUTF16Bounded(const char * buffer, size_t numberOfBytes){
+	int stringLength = 0;
+	size_t index = 0;
+	if(numberOfBytes % 2 != 0){
+		return UTF8_BINARY_ERROR_STATE;
+	}
+	while(index < numberOfBytes){
+		index += _lenUTF16Blocks(buffer + index, numberOfBytes - index, &stringLength);
+
+		// The vector with a surrogate, or the tail
+		size_t blockEnd = numberOfBytes - index > 32 ? index + 32 : numberOfBytes;
+		while(index < blockEnd){
+			int codePoint;
+			int strideLength = decodeUTF16Character(buffer + index, numberOfBytes - index, &codePoint);
+			if(strideLength == -1){
+				return UTF8_BINARY_ERROR_STATE;
+			}
+			stringLength += (codePoint < 0x10000) & !isDiacriticalMark(codePoint);
+			index += strideLength;
+		}
+	}
+	return stringLength;
+}
+
+/**
+ * Find the first block of a utf8 buffer that breaks the encoding a vector at
+ * a time
+ * @param data The buffer to validate
+ * @param numberOfBytes The number of bytes in the buffer
+ * @returns {The start of the first block with an error, or the end of the vectors}
+ */
+static size_t _validateUTF8Blocks(const char * data, size_t numberOfBytes){
+	size_t index = 0;
+#if defined(LANGUAGE_AVX2)
+	__m256i previous = _mm256_setzero_si256();
+	__m256i incomplete = _mm256_setzero_si256();
+	for(; index + 32 <= numberOfBytes; index += 32){
+		__m256i input = _mm256_loadu_si256((const __m256i *)(data + index));
+		__m256i errors = incomplete;
+		if(_mm256_movemask_epi8(input) != 0){
+			errors = _utf8ErrorsAVX2(input, previous);
+		}
+		if(!_mm256_testz_si256(errors, errors)){
+			return index;
+		}
+		incomplete = _utf8IncompleteAVX2(input);
+		previous = input;
+	}
+#endif
+#if defined(LANGUAGE_SSE2)
+	__m128i previous128 = index >= 16 ? _mm_loadu_si128((const __m128i *)(data + index - 16)) : _mm_setzero_si128();
+	__m128i incomplete128 = _utf8IncompleteSSE2(previous128);
+	for(; index + 16 <= numberOfBytes; index += 16){
+		__m128i input = _mm_loadu_si128((const __m128i *)(data + index));
+		__m128i errors = incomplete128;
+		if(_mm_movemask_epi8(input) != 0){
+			errors = _utf8ErrorsSSE2(input, previous128);
+		}
+		if(_mm_movemask_epi8(_mm_cmpeq_epi8(errors, _mm_setzero_si128())) != 0xffff){
+			return index;
+		}
+		incomplete128 = _utf8IncompleteSSE2(input);
+		previous128 = input;
+	}
+#else
+	(void)data;
+	(void)numberOfBytes;
+#endif
+	return index;
+}
+
+/**
+ * Check that a buffer is well formed utf8. Overlong forms, surrogates, code
+ * points past 0x10ffff, stray continuation bytes and characters cut off by the
+ * end of the buffer are all errors. The buffer is checked a vector at a time
+ * and the tail, or the block with the first error, with the utf8 decoder.
+ * @param data The buffer to validate
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param errorOffset Set to the offset of the first malformed character when
+ * the buffer is invalid. May be NULL.
+ * @returns {0 = false, 1 = true}
+ */
+static int validateUTF8(const char * data, size_t numberOfBytes, size_t * errorOffset){
+	if(data == NULL){
+		return numberOfBytes == 0;
+	}
+	size_t index = _utf8CharacterStart(data, _validateUTF8Blocks(data, numberOfBytes));
+	while(index < numberOfBytes){
+		// Skip the ascii quickly
+		if((unsigned char)data[index] < 0x80){
+			index++;
+			continue;
+		}
+		int codePoint;
+		int strideLength = decodeUTF8Character(data + index, numberOfBytes - index, &codePoint);
+		if(strideLength == -1){
+			if(errorOffset != NULL){
+				*errorOffset = index;
+			}
+			return 0;
+		}
+		index += strideLength;
+	}
+	return 1;
+}
+
+/**
+ * Widen the ascii at the start of a buffer into code points, a vector at a
+ * time. The vectors that hold a byte past 0x7f are left for the decoder.
+ * @param buffer The buffer to decode
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param codePoints The array that receives the code points
+ * @returns {The number of bytes that were widened}
+ */
+static size_t _widenASCIIBlocks(const char * buffer, size_t numberOfBytes, int * codePoints){
+	size_t index = 0;
+#if defined(LANGUAGE_AVX2)
+	for(; index + 32 <= numberOfBytes; index += 32){
+		__m256i input = _mm256_loadu_si256((const __m256i *)(buffer + index));
+		if(_mm256_movemask_epi8(input) != 0){
+			break;
+		}
+		int block;
+		for(block = 0; block < 4; block++){
+			__m128i bytes = _mm_loadl_epi64((const __m128i *)(buffer + index + 8 * block));
+			_mm256_storeu_si256((__m256i *)(codePoints + index + 8 * block), _mm256_cvtepu8_epi32(bytes));
+		}
+	}
+#endif
+#if defined(LANGUAGE_SSE2)
+	for(; index + 16 <= numberOfBytes; index += 16){
+		__m128i input = _mm_loadu_si128((const __m128i *)(buffer + index));
+		if(_mm_movemask_epi8(input) != 0){
+			break;
+		}
+		__m128i zero = _mm_setzero_si128();
+		__m128i low = _mm_unpacklo_epi8(input, zero);
+		__m128i high = _mm_unpackhi_epi8(input, zero);
+		_mm_storeu_si128((__m128i *)(codePoints + index), _mm_unpacklo_epi16(low, zero));
+		_mm_storeu_si128((__m128i *)(codePoints + index + 4), _mm_unpackhi_epi16(low, zero));
+		_mm_storeu_si128((__m128i *)(codePoints + index + 8), _mm_unpacklo_epi16(high, zero));
+		_mm_storeu_si128((__m128i *)(codePoints + index + 12), _mm_unpackhi_epi16(high, zero));
+	}
+#else
+	(void)buffer;
+	(void)numberOfBytes;
+	(void)codePoints;
+#endif
+	return index;
+}
+
+/**
+ * Decode a utf8 buffer into an array of code points. The decoding stops at
+ * the first malformed character, with the same errors as validateUTF8.
+ * @param buffer The buffer to decode
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param codePoints The array that receives the code points. It must have
+ * room for numberOfBytes code points.
+ * @param errorOffset Set to the offset of the first malformed character, or
+ * to numberOfBytes when the buffer is valid. May be NULL.
+ * @returns {The number of code points written}
+ */
+static size_t decodeUTF8ToCodePoints(const char * buffer, size_t numberOfBytes, int * codePoints, size_t * errorOffset){
+	size_t index = 0;
+	size_t numberOfCodePoints = 0;
+	if(buffer == NULL){
+		numberOfBytes = 0;
+	}
+	while(index < numberOfBytes){
+		if((unsigned char)buffer[index] < 0x80){
+			size_t widened = _widenASCIIBlocks(buffer + index, numberOfBytes - index, codePoints + numberOfCodePoints);
+			index += widened;
+			numberOfCodePoints += widened;
+
+			// The rest of the ascii run
+			while(index < numberOfBytes && (unsigned char)buffer[index] < 0x80){
+				codePoints[numberOfCodePoints++] = buffer[index++];
+			}
+			continue;
+		}
+		int codePoint;
+		int strideLength = decodeUTF8Character(buffer + index, numberOfBytes - index, &codePoint);
+		if(strideLength == -1){
+			break;
+		}
+		codePoints[numberOfCodePoints++] = codePoint;
+		index += strideLength;
+	}
+	if(errorOffset != NULL){
+		*errorOffset = index;
+	}
+	return numberOfCodePoints;
+}
+
+/**
+ * Transcode utf16 code units into utf8 in a buffer owned by the caller. Like
+ * encodeUTF8Into, only whole characters that fit are written and the full
+ * size is always returned, so a NULL buffer asks for the size. Runs of ascii
+ * are narrowed a vector at a time.
+ * @param buffer The buffer that receives the utf8 bytes, or NULL
+ * @param bufferCapacity The number of bytes in the buffer
+ * @param units The utf16 code units
+ * @param numberOfUnits The number of code units
+ * @param errorOffset Set to the offset of the first unpaired surrogate, or to
+ * numberOfUnits when the code units are valid. May be NULL.
+ * @returns {The number of bytes in the utf8 encoding, or -1 for an unpaired surrogate}
+ */
+static long long transcodeUTF16ToUTF8Into(char * buffer, size_t bufferCapacity, const unsigned short * units,
+		size_t numberOfUnits, size_t * errorOffset){
+	size_t r = 0;
+	size_t numberOfBytes = 0;
+	if(units == NULL){
+		numberOfUnits = 0;
+	}
+	if(buffer == NULL){
+		bufferCapacity = 0;
+	}
+	while(r < numberOfUnits){
+		int codePoint = units[r];
+#if defined(LANGUAGE_SSE2)
+		if(codePoint < 0x80){
+			while(r + 8 <= numberOfUnits && numberOfBytes + 8 <= bufferCapacity){
+				__m128i input = _mm_loadu_si128((const __m128i *)(units + r));
+				__m128i high = _mm_and_si128(input, _mm_set1_epi16((short)0xff80));
+				if(_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_setzero_si128())) != 0xffff){
+					break;
+				}
+				_mm_storel_epi64((__m128i *)(buffer + numberOfBytes), _mm_packus_epi16(input, input));
+				r += 8;
+				numberOfBytes += 8;
+			}
+			if(r == numberOfUnits){
+				break;
+			}
+			codePoint = units[r];
+		}
+#endif
+		size_t unitLength = 1;
+		if(codePoint >= 0xd800 && codePoint <= 0xdfff){
+			if(codePoint > 0xdbff || r + 1 == numberOfUnits || units[r + 1] < 0xdc00 || units[r + 1] > 0xdfff){
+				if(errorOffset != NULL){
+					*errorOffset = r;
+				}
+				return -1;
+			}
+			codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (units[r + 1] - 0xdc00);
+			unitLength = 2;
+		}
+		int length = _getCodePointUTF8Length(codePoint);
+		if(numberOfBytes + length <= bufferCapacity){
+			_encodeUTF8Character(buffer + numberOfBytes, codePoint, length);
+		}else{
+			// Keep what is written a prefix of the encoding
+			bufferCapacity = 0;
+		}
+		numberOfBytes += length;
+		r += unitLength;
+	}
+	if(errorOffset != NULL){
+		*errorOffset = numberOfUnits;
+	}
+	return (long long)numberOfBytes;
+}
+
+/**
+ * Transcode utf8 into utf16 code units in a buffer owned by the caller. Only
+ * whole characters that fit are written and the full size is always
+ * returned, so a NULL buffer asks for the size. Runs of ascii are widened a
+ * vector at a time.
+ * @param units The buffer that receives the code units, or NULL
+ * @param unitCapacity The number of code units in the buffer
+ * @param buffer The utf8 bytes
+ * @param numberOfBytes The number of bytes
+ * @param errorOffset Set to the offset of the first malformed character, or
+ * to numberOfBytes when the buffer is valid. May be NULL.
+ * @returns {The number of code units in the utf16 encoding, or -1 for malformed utf8}
+ */
+static long long transcodeUTF8ToUTF16Into(unsigned short * units, size_t unitCapacity, const char * buffer,
+		size_t numberOfBytes, size_t * errorOffset){
+	size_t index = 0;
+	size_t numberOfUnits = 0;
+	if(buffer == NULL){
+		numberOfBytes = 0;
+	}
+	if(units == NULL){
+		unitCapacity = 0;
+	}
+	while(index < numberOfBytes){
+#if defined(LANGUAGE_SSE2)
+		if((unsigned char)buffer[index] < 0x80){
+			while(index + 16 <= numberOfBytes && numberOfUnits + 16 <= unitCapacity){
+				__m128i input = _mm_loadu_si128((const __m128i *)(buffer + index));
+				if(_mm_movemask_epi8(input) != 0){
+					break;
+				}
+				_mm_storeu_si128((__m128i *)(units + numberOfUnits), _mm_unpacklo_epi8(input, _mm_setzero_si128()));
+				_mm_storeu_si128((__m128i *)(units + numberOfUnits + 8), _mm_unpackhi_epi8(input, _mm_setzero_si128()));
+				index += 16;
+				numberOfUnits += 16;
+			}
+			if(index == numberOfBytes){
+				break;
+			}
+		}
+#endif
+		int codePoint;
+		int strideLength = decodeUTF8Character(buffer + index, numberOfBytes - index, &codePoint);
+		if(strideLength == -1){
+			if(errorOffset != NULL){
+				*errorOffset = index;
+			}
+			return -1;
+		}
+		size_t length = codePoint < 0x10000 ? 1 : 2;
+		if(numberOfUnits + length <= unitCapacity){
+			if(length == 1){
+				units[numberOfUnits] = (unsigned short)codePoint;
+			}else{
+				units[numberOfUnits] = (unsigned short)(0xd800 + ((codePoint - 0x10000) >> 10));
+				units[numberOfUnits + 1] = (unsigned short)(0xdc00 + ((codePoint - 0x10000) & 0x3ff));
+			}
+		}else{
+			// Keep what is written a prefix of the encoding
+			unitCapacity = 0;
+		}
+		numberOfUnits += length;
+		index += strideLength;
+	}
+	if(errorOffset != NULL){
+		*errorOffset = numberOfBytes;
+	}
+	return (long long)numberOfUnits;
+}
+
+// The hangul syllables of unicode chapter 3.12, which are decomposed and
+// composed by arithmetic rather than the tables
+#define HANGUL_S_BASE 0xac00
+#define HANGUL_L_BASE 0x1100
+#define HANGUL_V_BASE 0x1161
+#define HANGUL_T_BASE 0x11a7
+#define HANGUL_L_COUNT 19
+#define HANGUL_V_COUNT 21
+#define HANGUL_T_COUNT 28
+#define HANGUL_N_COUNT (HANGUL_V_COUNT * HANGUL_T_COUNT)
+#define HANGUL_S_COUNT (HANGUL_L_COUNT * HANGUL_N_COUNT)
+
+/**
+ * The most code points of a starter and its combining marks that
+ * normalizeUTF8Into reorders at once. Stream-safe text has at most 31.
+ */
+#define NORMALIZATION_SEGMENT_SIZE 64
+
+/**
+ * Get the entry of a code point in the normalization property table, its
+ * canonical combining class and the NORMALIZATION_NFC_MAYBE,
+ * NORMALIZATION_NFC_NO and NORMALIZATION_NFD_NO bits
+ * @param codePoint The code point
+ */
+static int _getNormalizationProperties(int codePoint){
+	if(codePoint < 0 || codePoint >= NORMALIZATION_CODE_POINTS){
+		return 0;
+	}
+	return normalizationBlocks[normalizationPages[codePoint / NORMALIZATION_BLOCK_SIZE]][codePoint % NORMALIZATION_BLOCK_SIZE];
+}
+
+/**
+ * Get the canonical combining class of a code point, which orders the
+ * combining marks of a character. Starters are class 0.
+ * @param codePoint The code point
+ * @returns {The class, from 0 to 254}
+ */
+static int getCanonicalCombiningClass(int codePoint){
+	return _getNormalizationProperties(codePoint) & NORMALIZATION_COMBINING_CLASS_MASK;
+}
+
+/**
+ * Write the full canonical decomposition of a code point
+ * @param codePoint The code point
+ * @param decomposition The NORMALIZATION_MAX_DECOMPOSITION code points that
+ * receive the decomposition
+ * @returns {The number of code points in the decomposition}
+ */
+static int _decomposeCodePoint(int codePoint, int * decomposition){
+	int syllable = codePoint - HANGUL_S_BASE;
+	if(syllable >= 0 && syllable < HANGUL_S_COUNT){
+		decomposition[0] = HANGUL_L_BASE + syllable / HANGUL_N_COUNT;
+		decomposition[1] = HANGUL_V_BASE + (syllable % HANGUL_N_COUNT) / HANGUL_T_COUNT;
+		if(syllable % HANGUL_T_COUNT == 0){
+			return 2;
+		}
+		decomposition[2] = HANGUL_T_BASE + syllable % HANGUL_T_COUNT;
+		return 3;
+	}
+	if(_getNormalizationProperties(codePoint) & NORMALIZATION_NFD_NO){
+		int low = 0;
+		int high = NORMALIZATION_DECOMPOSITIONS - 1;
+		while(low <= high){
+			int middle = (low + high) / 2;
+			if((int)normalizationDecomposed[middle] < codePoint){
+				low = middle + 1;
+			}else if((int)normalizationDecomposed[middle] > codePoint){
+				high = middle - 1;
+			}else{
+				int length = 0;
+				int r;
+				for(r = normalizationDecompositionOffsets[middle]; r < normalizationDecompositionOffsets[middle + 1]; r++){
+					decomposition[length++] = (int)normalizationDecompositions[r];
+				}
+				return length;
+			}
+		}
+	}
+	decomposition[0] = codePoint;
+	return 1;
+}
+
+/**
+ * Get the primary composite of a pair of code points
+ * @param first The starter
+ * @param second The code point that follows it
+ * @returns {The composite, or -1 when the pair does not compose}
+ */
+static int _composeCodePoints(int first, int second){
+	int syllable = first - HANGUL_S_BASE;
+	if(first >= HANGUL_L_BASE && first < HANGUL_L_BASE + HANGUL_L_COUNT &&
+			second >= HANGUL_V_BASE && second < HANGUL_V_BASE + HANGUL_V_COUNT){
+		return HANGUL_S_BASE + ((first - HANGUL_L_BASE) * HANGUL_V_COUNT + second - HANGUL_V_BASE) * HANGUL_T_COUNT;
+	}else if(syllable >= 0 && syllable < HANGUL_S_COUNT && syllable % HANGUL_T_COUNT == 0 &&
+			second > HANGUL_T_BASE && second < HANGUL_T_BASE + HANGUL_T_COUNT){
+		return first + second - HANGUL_T_BASE;
+	}
+	// Only the code points that may compose with the one before them are the
+	// second of a pair
+	if(!(_getNormalizationProperties(second) & NORMALIZATION_NFC_MAYBE)){
+		return -1;
+	}
+	unsigned long long pair = ((unsigned long long)first << 21) | (unsigned long long)second;
+	int low = 0;
+	int high = NORMALIZATION_COMPOSITIONS - 1;
+	while(low <= high){
+		int middle = (low + high) / 2;
+		if(normalizationCompositionPairs[middle] < pair){
+			low = middle + 1;
+		}else if(normalizationCompositionPairs[middle] > pair){
+			high = middle - 1;
+		}else{
+			return (int)normalizationComposites[middle];
+		}
+	}
+	return -1;
+}
+
+/**
+ * Get the utf8 byte below which every lead byte starts a starter that is
+ * already in a normalization form
+ * @param form The normalizationForms value
+ */
+static unsigned char _getNormalizationLeadLimit(int form){
+	// Both limits are two byte code points
+	int limit = form == NORMALIZATION_NFC ? NORMALIZATION_NFC_QUICK_CHECK_LIMIT : NORMALIZATION_NFD_QUICK_CHECK_LIMIT;
+	return (unsigned char)(0xc0 | (limit >> 6));
+}
+
+/**
+ * Find the first character of a valid utf8 buffer that is not known to be
+ * normalized, and where the text that normalization may change starts. Runs
+ * of bytes below the lead limit are skipped a vector at a time.
+ * @param data The utf8 bytes, which must be valid
+ * @param numberOfBytes The number of bytes
+ * @param form The normalizationForms value
+ * @param stableOffset Set to the start of the last starter before the first
+ * character that is not known to be normalized, or to numberOfBytes when
+ * the buffer is normalized. Normalization leaves the bytes before it alone.
+ * @param stopAtMaybe 1 to return at the first character that may not be
+ * normalized, 0 to scan on for one that is not
+ * @returns {The normalizationQuickChecks value}
+ */
+static int _quickCheckNormalizationUTF8(const char * data, size_t numberOfBytes, int form, size_t * stableOffset,
+		int stopAtMaybe){
+	int noBits = form == NORMALIZATION_NFC ? NORMALIZATION_NFC_NO : NORMALIZATION_NFD_NO;
+	unsigned char leadLimit = _getNormalizationLeadLimit(form);
+	size_t index = 0;
+	size_t starter = 0;
+	int lastClass = 0;
+	int result = NORMALIZATION_YES;
+	*stableOffset = numberOfBytes;
+	while(index < numberOfBytes){
+		size_t start = index;
+#if defined(LANGUAGE_AVX2)
+		const __m256i lead256 = _mm256_set1_epi8((char)leadLimit);
+		while(index + 32 <= numberOfBytes){
+			__m256i input = _mm256_loadu_si256((const __m256i *)(data + index));
+			if(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(input, lead256), input)) != 0){
+				break;
+			}
+			index += 32;
+		}
+#endif
+#if defined(LANGUAGE_SSE2)
+		const __m128i lead128 = _mm_set1_epi8((char)leadLimit);
+		while(index + 16 <= numberOfBytes){
+			__m128i input = _mm_loadu_si128((const __m128i *)(data + index));
+			if(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(input, lead128), input)) != 0){
+				break;
+			}
+			index += 16;
+		}
+#endif
+		if(index != start){
+			// Step back to the start of a character cut by the last vector
+			index = _utf8CharacterStart(data, index);
+		}
+		if(index == numberOfBytes){
+			break;
+		}
+		unsigned char byte = (unsigned char)data[index];
+		if(byte < leadLimit){
+			if((byte & 0xc0) != 0x80){
+				starter = index;
+				lastClass = 0;
+			}
+			index++;
+			continue;
+		}
+		int codePoint;
+		int strideLength = decodeUTF8Character(data + index, numberOfBytes - index, &codePoint);
+		int properties = _getNormalizationProperties(codePoint);
+		int combiningClass = properties & NORMALIZATION_COMBINING_CLASS_MASK;
+		int maybe = form == NORMALIZATION_NFC && (properties & NORMALIZATION_NFC_MAYBE);
+		if((combiningClass != 0 && lastClass > combiningClass) || (properties & noBits) || maybe){
+			if(*stableOffset == numberOfBytes){
+				*stableOffset = starter;
+			}
+			if(!maybe){
+				return NORMALIZATION_NO;
+			}else if(stopAtMaybe){
+				return NORMALIZATION_MAYBE;
+			}
+			result = NORMALIZATION_MAYBE;
+		}else if(combiningClass == 0){
+			starter = index;
+		}
+		lastClass = combiningClass;
+		index += strideLength;
+	}
+	return result;
+}
+
+/**
+ * Check if a utf8 buffer is in a normalization form without normalizing it.
+ * Text below U+0300 for NFC, or U+00C0 for NFD, is skipped a vector at a
+ * time, so the common case of normalized Latin text returns after one scan.
+ * @param data The utf8 bytes
+ * @param numberOfBytes The number of bytes
+ * @param form The normalizationForms value
+ * @param errorOffset Set to the offset of the first malformed character when
+ * the buffer is invalid. May be NULL.
+ * @returns {The normalizationQuickChecks value, or -1 for malformed utf8 and an unknown form}
+ */
+static int quickCheckNormalizationUTF8(const char * data, size_t numberOfBytes, int form, size_t * errorOffset){
+	size_t stableOffset;
+	if(form != NORMALIZATION_NFC && form != NORMALIZATION_NFD){
+		return -1;
+	}
+	if(!validateUTF8(data, numberOfBytes, errorOffset)){
+		return -1;
+	}
+	if(data == NULL){
+		return NORMALIZATION_YES;
+	}
+	return _quickCheckNormalizationUTF8(data, numberOfBytes, form, &stableOffset, 0);
+}
+
+/**
+ * Put the combining marks of a segment in canonical order, a stable sort on
+ * their combining classes
+ * @param codePoints The code points of the segment
+ * @param combiningClasses The combining class of each code point
+ * @param length The number of code points
+ */
+static void _canonicalOrder(int * codePoints, int * combiningClasses, int length){
+	int r;
+	for(r = 1; r < length; r++){
+		int codePoint = codePoints[r];
+		int combiningClass = combiningClasses[r];
+		int s = r;
+		while(s > 0 && combiningClasses[s - 1] > combiningClass){
+			codePoints[s] = codePoints[s - 1];
+			combiningClasses[s] = combiningClasses[s - 1];
+			s--;
+		}
+		codePoints[s] = codePoint;
+		combiningClasses[s] = combiningClass;
+	}
+}
+
+/**
+ * Compose the combining marks of a segment in canonical order with its
+ * starter. A mark is blocked from the starter by an earlier mark of the
+ * same or a higher class that did not compose.
+ * @param codePoints The code points of the segment
+ * @param combiningClasses The combining class of each code point
+ * @param length The number of code points
+ * @returns {The number of code points left}
+ */
+static int _composeSegment(int * codePoints, int * combiningClasses, int length){
+	int lastClass = 0;
+	int composedLength = 1;
+	int r;
+	if(length == 0 || combiningClasses[0] != 0){
+		return length;
+	}
+	for(r = 1; r < length; r++){
+		int composite = _composeCodePoints(codePoints[0], codePoints[r]);
+		if(composite >= 0 && (lastClass == 0 || lastClass < combiningClasses[r])){
+			codePoints[0] = composite;
+		}else{
+			lastClass = combiningClasses[r];
+			codePoints[composedLength] = codePoints[r];
+			combiningClasses[composedLength] = combiningClasses[r];
+			composedLength++;
+		}
+	}
+	return composedLength;
+}
+
+/**
+ * Append code points to a utf8 buffer, keeping what is written a prefix of
+ * the encoding
+ * @param buffer The buffer that receives the bytes
+ * @param bufferCapacity The number of bytes left for whole characters, set
+ * to 0 once a character does not fit
+ * @param numberOfBytes The length of the encoding so far
+ * @param codePoints The code points
+ * @param length The number of code points
+ */
+static void _appendUTF8(char * buffer, size_t * bufferCapacity, size_t * numberOfBytes, const int * codePoints, int length){
+	int r;
+	for(r = 0; r < length; r++){
+		int characterLength = _getCodePointUTF8Length(codePoints[r]);
+		if(*numberOfBytes + characterLength <= *bufferCapacity){
+			_encodeUTF8Character(buffer + *numberOfBytes, codePoints[r], characterLength);
+		}else{
+			*bufferCapacity = 0;
+		}
+		*numberOfBytes += characterLength;
+	}
+}
+
+/**
+ * Append bytes to a utf8 buffer, keeping what is written a prefix of the
+ * encoding. The bytes can be further on in the same buffer.
+ * @param buffer The buffer that receives the bytes
+ * @param bufferCapacity The number of bytes left for whole characters, set
+ * to 0 once the bytes do not fit
+ * @param numberOfBytes The length of the encoding so far
+ * @param data The whole characters to append
+ * @param length The number of bytes to append
+ */
+static void _appendUTF8Bytes(char * buffer, size_t * bufferCapacity, size_t * numberOfBytes, const char * data, size_t length){
+	if(*numberOfBytes + length <= *bufferCapacity){
+		if(length > 0){
+			memmove(buffer + *numberOfBytes, data, length);
+		}
+	}else{
+		if(*bufferCapacity > *numberOfBytes){
+			memmove(buffer + *numberOfBytes, data, _utf8CharacterStart(data, *bufferCapacity - *numberOfBytes));
+		}
+		*bufferCapacity = 0;
+	}
+	*numberOfBytes += length;
+}
+
+/**
+ * Normalize utf8 into NFC or NFD in a buffer owned by the caller. Only whole
+ * characters that fit are written and the full size is always returned, so
+ * a NULL buffer asks for the size. The quick check finds the runs of text
+ * that are already normalized, which are copied as they are. Between them
+ * each starter is decomposed with its combining marks, which are put in
+ * canonical order and, for NFC, composed again. Normalizing once
+ * lets the precomposed characters of the alphabet checks match decomposed
+ * input.
+ * @param buffer The buffer that receives the bytes, or NULL
+ * @param bufferCapacity The number of bytes in the buffer
+ * @param data The utf8 bytes
+ * @param numberOfBytes The number of bytes
+ * @param form The normalizationForms value
+ * @param errorOffset Set to the offset of the first malformed character, or
+ * of a character with more than NORMALIZATION_SEGMENT_SIZE code points of
+ * combining marks, or to numberOfBytes when the buffer is normalized. May be
+ * NULL.
+ * @returns {The number of bytes in the normalized utf8, or -1 for malformed utf8, too many marks and an unknown form}
+ */
+static long long normalizeUTF8Into(char * buffer, size_t bufferCapacity, const char * data, size_t numberOfBytes,
+		int form, size_t * errorOffset){
+	int segment[NORMALIZATION_SEGMENT_SIZE];
+	int combiningClasses[NORMALIZATION_SEGMENT_SIZE];
+	int decomposition[NORMALIZATION_MAX_DECOMPOSITION];
+	int length = 0;
+	size_t index = 0;
+	size_t normalizedBytes = 0;
+	unsigned char leadLimit = _getNormalizationLeadLimit(form);
+	if(form != NORMALIZATION_NFC && form != NORMALIZATION_NFD){
+		return -1;
+	}
+	if(!validateUTF8(data, numberOfBytes, errorOffset)){
+		return -1;
+	}
+	if(data == NULL){
+		numberOfBytes = 0;
+	}
+	if(buffer == NULL){
+		bufferCapacity = 0;
+	}
+	while(index < numberOfBytes){
+		int codePoint = (unsigned char)data[index];
+		int strideLength = 1;
+		int decompositionLength = 1;
+		int r;
+		if(codePoint < leadLimit){
+			// A normalized starter composes with nothing before it, so the
+			// segment is done and the run of normalized text from here is
+			// copied in one go
+			size_t stableOffset;
+			_canonicalOrder(segment, combiningClasses, length);
+			if(form == NORMALIZATION_NFC){
+				length = _composeSegment(segment, combiningClasses, length);
+			}
+			_appendUTF8(buffer, &bufferCapacity, &normalizedBytes, segment, length);
+			length = 0;
+			_quickCheckNormalizationUTF8(data + index, numberOfBytes - index, form, &stableOffset, 1);
+			_appendUTF8Bytes(buffer, &bufferCapacity, &normalizedBytes, data + index, stableOffset);
+			index += stableOffset;
+			if(index == numberOfBytes){
+				break;
+			}
+			codePoint = (unsigned char)data[index];
+		}
+		if(codePoint < 0x80){
+			decomposition[0] = codePoint;
+		}else{
+			strideLength = decodeUTF8Character(data + index, numberOfBytes - index, &codePoint);
+			decompositionLength = _decomposeCodePoint(codePoint, decomposition);
+		}
+		for(r = 0; r < decompositionLength; r++){
+			int combiningClass = getCanonicalCombiningClass(decomposition[r]);
+			if(combiningClass == 0 && length > 0){
+				// A starter ends the segment, unless it composes with a
+				// starter that has nothing left after it
+				_canonicalOrder(segment, combiningClasses, length);
+				if(form == NORMALIZATION_NFC){
+					length = _composeSegment(segment, combiningClasses, length);
+					if(length == 1 && combiningClasses[0] == 0){
+						int composite = _composeCodePoints(segment[0], decomposition[r]);
+						if(composite >= 0){
+							segment[0] = composite;
+							continue;
+						}
+					}
+				}
+				_appendUTF8(buffer, &bufferCapacity, &normalizedBytes, segment, length);
+				length = 0;
+			}
+			if(length == NORMALIZATION_SEGMENT_SIZE){
+				if(errorOffset != NULL){
+					*errorOffset = index;
+				}
+				return -1;
+			}
+			segment[length] = decomposition[r];
+			combiningClasses[length] = combiningClass;
+			length++;
+		}
+		index += strideLength;
+	}
+	_canonicalOrder(segment, combiningClasses, length);
+	if(form == NORMALIZATION_NFC){
+		length = _composeSegment(segment, combiningClasses, length);
+	}
+	_appendUTF8(buffer, &bufferCapacity, &normalizedBytes, segment, length);
+	if(errorOffset != NULL){
+		*errorOffset = numberOfBytes;
+	}
+	return (long long)normalizedBytes;
+}
+
+/**
+ * Check if a character is a number in different encodings
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isNumber(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_DIGIT);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		int value = _getFirstCodeUnit(charValue, encoding);
+		if(value >= 48 && value <= 57){
+			return 1;
+		}else{
+			return 0;
+		}
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * The most byte ranges that the ascii characters of a class can be split into
+ * for the vector sequence checks
+ */
+#define ASCII_CLASS_MAX_RANGES 16
+
+/**
+ * The ascii characters of a character class as a list of byte ranges
+ */
+typedef struct{
+	int numberOfRanges;							// The number of ranges
+	unsigned char low[ASCII_CLASS_MAX_RANGES];	// The first byte of each range
+	unsigned char high[ASCII_CLASS_MAX_RANGES];	// The last byte of each range
+} _asciiClassRanges;
+
+/**
+ * Split the ascii characters of a class into byte ranges. Every ascii byte is a
+ * whole character in the single byte encodings and utf8, so a run of ascii bytes
+ * can be checked against the ranges a vector at a time.
+ * @param ranges Set to the ranges of the class
+ * @param encoding ASCII, ISO_8859_1 or UTF8_BINARY
+ * @param language The language of the class
+ * @param characterClass The characterClasses bit to split
+ * @returns {0 = the class has no ranges or too many, 1 = the ranges are set}
+ */
+static int _getASCIIClassRanges(_asciiClassRanges * ranges, int encoding, int language, int characterClass){
+	const unsigned short * table = getCharacterClassTable(encoding, language);
+	int byte;
+	ranges->numberOfRanges = 0;
+#if !defined(LANGUAGE_SSE2) && !defined(LANGUAGE_AVX2)
+	// There are no vectors to check the ranges with
+	return 0;
+#endif
+	if(table == NULL && (encoding != UTF8_BINARY || language < ENGLISH || language >= NUMBER_OF_LANGUAGES)){
+		return 0;
+	}
+	for(byte = 0; byte < 0x80; byte++){
+		// Every ascii byte is a valid utf8 character
+		int classes = table != NULL ? table[byte] : getUnicodeCharacterClasses(byte, language) | CHARACTER_CLASS_VALID;
+		if((classes & characterClass) == 0){
+			continue;
+		}
+		if(ranges->numberOfRanges > 0 && ranges->high[ranges->numberOfRanges - 1] == byte - 1){
+			ranges->high[ranges->numberOfRanges - 1] = (unsigned char)byte;
+		}else if(ranges->numberOfRanges == ASCII_CLASS_MAX_RANGES){
+			return 0;
+		}else{
+			ranges->low[ranges->numberOfRanges] = (unsigned char)byte;
+			ranges->high[ranges->numberOfRanges] = (unsigned char)byte;
+			ranges->numberOfRanges++;
+		}
+	}
+	return ranges->numberOfRanges > 0;
+}
+
+/**
+ * Get the number of bytes at the start of a buffer that are in a set of ascii
+ * byte ranges, a vector at a time. The count stops at the first byte that is not
+ * in a range, which includes every byte past 0x7f, or at the last whole vector.
+ * @param ranges The ranges of the class
+ * @param buffer The buffer to check
+ * @param numberOfBytes The number of bytes in the buffer
+ */
+static size_t _asciiClassSpan(const _asciiClassRanges * ranges, const char * buffer, size_t numberOfBytes){
+	size_t index = 0;
+	int r;
+#if defined(LANGUAGE_AVX2)
+	for(; index + 32 <= numberOfBytes; index += 32){
+		__m256i input = _mm256_loadu_si256((const __m256i *)(buffer + index));
+		__m256i matches = _mm256_setzero_si256();
+		for(r = 0; r < ranges->numberOfRanges; r++){
+			matches = _mm256_or_si256(matches, _inRangeAVX2(input, ranges->low[r], ranges->high[r]));
+		}
+		unsigned int misses = ~(unsigned int)_mm256_movemask_epi8(matches);
+		if(misses != 0){
+			return index + _countTrailingZeros(misses);
+		}
+	}
+#endif
+#if defined(LANGUAGE_SSE2)
+	for(; index + 16 <= numberOfBytes; index += 16){
+		__m128i input = _mm_loadu_si128((const __m128i *)(buffer + index));
+		__m128i matches = _mm_setzero_si128();
+		for(r = 0; r < ranges->numberOfRanges; r++){
+			matches = _mm_or_si128(matches, _inRangeSSE2(input, ranges->low[r], ranges->high[r]));
+		}
+		unsigned int misses = ~(unsigned int)_mm_movemask_epi8(matches) & 0xffff;
+		if(misses != 0){
+			return index + _countTrailingZeros(misses);
+		}
+	}
+#else
+	(void)ranges;
+	(void)buffer;
+	(void)numberOfBytes;
+#endif
+	(void)r;
+	return index;
+}
+
+/**
+ * Check if a bounded sequence of characters conforms to different character
+ * checks. A character that is cut off by the end of the buffer fails the check.
+ * @param func The function used to check
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int _isSequenceOfBounded(int (*func)(const char *, int), const char * charSequence, size_t numberOfBytes,
+		int encoding){
+	const char * characterPointer = charSequence;
+	const char * sequenceEnd = charSequence + numberOfBytes;
+	while(characterPointer < sequenceEnd){
+		int strideLength = _getCharacterStrideLengthBounded(characterPointer, sequenceEnd - characterPointer, encoding);
+		if(strideLength == -1){
+			return 0;
+		}
+		if(func(characterPointer, encoding) == 0){
+			return 0;
+		}
+		characterPointer += strideLength;
+	}
+	return 1;
+}
+
+/**
+ * Check if a sequence of characters conforms to different character
+ * checks
+ * @param func The function used to check
+ * @param charSequence The string to check
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int _isSequenceOf(int (*func)(const char *, int), const char * charSequence, int encoding){
+	return _isSequenceOfBounded(func, charSequence, _getStringByteLength(charSequence, encoding), encoding);
+}
+
+/**
+ * Check if a bounded sequence of characters is in a character class. Runs of
+ * ascii characters are checked a vector at a time, and every other character
+ * with the character check.
+ * @param func The character check of the class
+ * @param characterClass The characterClasses bit that func checks for ascii characters
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int _isClassSequenceOfBounded(int (*func)(const char *, int), int characterClass, const char * charSequence,
+		size_t numberOfBytes, int encoding){
+	_asciiClassRanges ranges;
+	// Short strings are not worth splitting the class into ranges
+	if(numberOfBytes < 32 || !_getASCIIClassRanges(&ranges, encoding, ENGLISH, characterClass)){
+		return _isSequenceOfBounded(func, charSequence, numberOfBytes, encoding);
+	}
+	size_t index = 0;
+	while(index < numberOfBytes){
+		size_t run = _asciiClassSpan(&ranges, charSequence + index, numberOfBytes - index);
+		index += run;
+		// A short run of ascii characters is followed by 64 bytes of characters
+		// checked one at a time, so text with many non ascii characters does not
+		// go back to the vectors after every one of them
+		size_t scalarEnd = index + (run < 16 ? 64 : 1);
+		if(scalarEnd > numberOfBytes){
+			scalarEnd = numberOfBytes;
+		}
+		while(index < scalarEnd){
+			int strideLength = _getCharacterStrideLengthBounded(charSequence + index, numberOfBytes - index, encoding);
+			if(strideLength == -1 || func(charSequence + index, encoding) == 0){
+				return 0;
+			}
+			index += strideLength;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Check if a bounded sequence of character conforms to different character
+ * checks after an index
+ * @param func The function used to check
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the sequence
+ * @param index The index of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isSequenceAtIndexBounded(int (*func)(const char *, int), const char * charSequence, size_t numberOfBytes,
+		int encoding, int index){
+	if(index < 0 || (size_t)index > numberOfBytes){
+		return 0;
+	}
+	return _isSequenceOfBounded(func, charSequence + index, numberOfBytes - index, encoding);
+}
+
+/**
+ * Check if a sequence of character conforms to different character
+ * checks after an index
+ * @param func The function used to check
+ * @param charSequence The string to check
+ * @param encoding The encoding of the sequence
+ * @param index The index of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isSequenceAtIndex(int (*func)(const char *, int), const char * charSequence, int encoding,
+		int index){
+	int r;
+	if(index < 0){
+		return 0;
+	}
+	const char * characterPointer = charSequence;
+	for(r = 0; r < index; r++){
+		characterPointer++;
+	}
+	return _isSequenceOf(func, characterPointer, encoding);
+}
+
+/**
+ * Check if a sequence of characters is a number in a different encodings
+ * @param charSequence The character to check
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isNumberSequence(const char * charValueSequence, int encoding){
+	return _isClassSequenceOfBounded(isNumber, CHARACTER_CLASS_DIGIT, charValueSequence, _getStringByteLength(charValueSequence, encoding),
+			encoding);
+}
+
+/**
+ * The bounded version of isNumberSequence
+ * @param charSequence The character sequence to check
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isNumberSequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding){
+	return _isClassSequenceOfBounded(isNumber, CHARACTER_CLASS_DIGIT, charSequence, numberOfBytes, encoding);
+}
+
+/**
+ * Check if a characters is a hex number in different encodings
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ * @return {0=false, 1= true}
+ */
+static int isHex(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_HEX);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		int value = _getFirstCodeUnit(charValue, encoding);
+		if(value >= 48 && value <= 57){
+			return 1;
+		}
+		if(value >= 65 && value <= 70){
+			return 1; // a-f
+		}
+		if(value >= 97 && value <= 102){
+			return 1; // A-F
+		}
+		return 0;
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a sequence of characeters is hex
+ * @param charSequence The character to check
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isHexSequence(const char * charValueSequence, int encoding){
+	return _isClassSequenceOfBounded(isHex, CHARACTER_CLASS_HEX, charValueSequence, _getStringByteLength(charValueSequence, encoding),
+			encoding);
+}
+
+/**
+ * The bounded version of isHexSequence
+ * @param charSequence The character sequence to check
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isHexSequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding){
+	return _isClassSequenceOfBounded(isHex, CHARACTER_CLASS_HEX, charSequence, numberOfBytes, encoding);
+}
+
+/**
+ * A function that checks if a character is a valid part of an
+ * encoding. Utf8 characters are checked with the utf8 decoder, which
+ * rejects overlong forms, surrogates and cut off characters
+ * @param charValue The character to check
+ * @param encoding The encoding to check
+ * @returns {0 = false, 1 = true}
+ */
+static int isValidCharacter(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_VALID);
+	}else if(encoding == UTF8_BINARY){
+		return convertUTF8BinaryToCodePoint(charValue) != -1;
+	}else if(encoding == UTF16){
+		// A utf16 character is at most two code units, and a terminator after a
+		// leading surrogate is rejected
+		int codePoint;
+		return decodeUTF16Character(charValue, 4, &codePoint) != -1;
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * A function that checks if a string is filled with valid characters
+ * in an encoding
+ * @param charSequence The character to check
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isValidCharacterSequence(const char * charSequence, int encoding){
+	return _isClassSequenceOfBounded(isValidCharacter, CHARACTER_CLASS_VALID, charSequence, _getStringByteLength(charSequence, encoding),
+			encoding);
+}
+
+/**
+ * The bounded version of isValidCharacterSequence
+ * @param charSequence The character sequence to check
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isValidCharacterSequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding){
+	return _isClassSequenceOfBounded(isValidCharacter, CHARACTER_CLASS_VALID, charSequence, numberOfBytes, encoding);
+}
+
+/**
+ * A function that checks if a string is filled with the romance
+ * alphabet(a-z, A-Z) in different encodings
+ * @param charSequence The character to check
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isInRomanceAlphabetSequence(const char * charSequence, int encoding){
+	return _isClassSequenceOfBounded(isInRomanceAlphabet, CHARACTER_CLASS_ROMANCE, charSequence, _getStringByteLength(charSequence, encoding),
+			encoding);
+}
+
+/**
+ * The bounded version of isInRomanceAlphabetSequence
+ * @param charSequence The character sequence to check
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isInRomanceAlphabetSequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding){
+	return _isClassSequenceOfBounded(isInRomanceAlphabet, CHARACTER_CLASS_ROMANCE, charSequence, numberOfBytes, encoding);
+}
+
+/**
+ * Check if a character is part of the extended set of characters
+ * that are observed in Spanish in a specific encoding
+ * @param charValue The character associated with
+ * @param encoding The encoding to check for
+ * @return {0 = false, 1 = true}
+ */
+static int isSpanishExtendedCharacter(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, SPANISH, CHARACTER_CLASS_EXTENDED);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, SPANISH, CHARACTER_CLASS_EXTENDED);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is pat of the extended set of characters
+ * that are observed in French for a specific encoding
+ * @param charValue The character to check
+ * @param encoding The encoding to check in
+ * @return {0 = false, 1 = true}
+ */
+static int isFrenchExtendedCharacter(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, FRENCH, CHARACTER_CLASS_EXTENDED);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, FRENCH, CHARACTER_CLASS_EXTENDED);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is part of english punctuation marks
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isEnglishPunctuationMark(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_PUNCT);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_PUNCT);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is part of the spanish punctutation marks
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isSpanishPunctuationMark(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, SPANISH, CHARACTER_CLASS_PUNCT);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, SPANISH, CHARACTER_CLASS_PUNCT);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is part of the french punctutation marks
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isFrenchPunctuationMark(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, FRENCH, CHARACTER_CLASS_PUNCT);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, FRENCH, CHARACTER_CLASS_PUNCT);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is part of an alphabet's punctuation for different languages
+ * and encodings.
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isPunctuationMarkInAlphabet(const char * charValue, int encoding, int language){
+	if(getCharacterClassTable(encoding, language) != NULL){
+		return _isSingleByteClass(charValue, encoding, language, CHARACTER_CLASS_PUNCT);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, language, CHARACTER_CLASS_PUNCT);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is upper case in the english language
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isUpperCaseEnglish(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_UPPER);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_UPPER);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is upper case in the spanish language
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isUpperCaseSpanish(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, SPANISH, CHARACTER_CLASS_UPPER);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, SPANISH, CHARACTER_CLASS_UPPER);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is an upper case in the French language
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isUpperCaseFrench(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, FRENCH, CHARACTER_CLASS_UPPER);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, FRENCH, CHARACTER_CLASS_UPPER);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is upper case in an alphabet for different languages
+ * and encodings
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ */
+static int isUpperCaseInAlphabet(const char * charValue, int encoding, int language){
+	if(getCharacterClassTable(encoding, language) != NULL){
+		return _isSingleByteClass(charValue, encoding, language, CHARACTER_CLASS_UPPER);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, language, CHARACTER_CLASS_UPPER);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is lower case in the english language
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isLowerCaseEnglish(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_LOWER);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, ENGLISH, CHARACTER_CLASS_LOWER);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is lower case in the spanish language
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isLowerCaseSpanish(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, SPANISH, CHARACTER_CLASS_LOWER);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, SPANISH, CHARACTER_CLASS_LOWER);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is an upper case in the French language
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ */
+static int isLowerCaseFrench(const char * charValue, int encoding){
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		return _isSingleByteClass(charValue, encoding, FRENCH, CHARACTER_CLASS_LOWER);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, FRENCH, CHARACTER_CLASS_LOWER);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is lower case in an alphabet for different languages
+ * and encodings
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ */
+static int isLowerCaseInAlphabet(const char * charValue, int encoding, int language){
+	if(getCharacterClassTable(encoding, language) != NULL){
+		return _isSingleByteClass(charValue, encoding, language, CHARACTER_CLASS_LOWER);
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return _isUnicodeClass(charValue, encoding, language, CHARACTER_CLASS_LOWER);
+	}else{
+		return 0;
+	}
+}
+
+/**
+ * Check if a character is part of the alphabet of different languages.
+ * Different languages have added characters that go beyond the standard
+ * ASCII characters.
+ * @param charValue The character to check
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0= false, 1 = true}
+ */
+static int isInAlphabet(const char * charValue, int encoding, int language){
+	if(getCharacterClassTable(encoding, language) != NULL){
+		return _isSingleByteClass(charValue, encoding, language, CHARACTER_CLASS_ALPHA);
+	}else if((encoding == UTF8_BINARY || encoding == UTF16) && language >= ENGLISH && language < NUMBER_OF_LANGUAGES){
+		// Every language has the romance core, and the diacritical marks that
+		// are formally part of its ortography. Imported words are ignored.
+		return _isUnicodeClass(charValue, encoding, language, CHARACTER_CLASS_ALPHA);
+	}else{
+		// The romance core is part of the alphabet of any language
+		return isInRomanceAlphabet(charValue, encoding);
+	}
+}
+
+/**
+ * Check if a bounded sequence of characters conforms to different character
+ * checks. A character that is cut off by the end of the buffer fails the check.
+ * @param func The function used to check
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the character
+ * @param language The language of the characters
+ * @returns {0 = false, 1 = true}
+ */
+static int _isLanguageSequenceOfBounded(int (*func)(const char *, int, int), const char * charSequence, size_t numberOfBytes,
+		int encoding, int language){
+	const char * characterPointer = charSequence;
+	const char * sequenceEnd = charSequence + numberOfBytes;
+	while(characterPointer < sequenceEnd){
+		int strideLength = _getCharacterStrideLengthBounded(characterPointer, sequenceEnd - characterPointer, encoding);
+		if(strideLength == -1){
+			return 0;
+		}
+		if(func(characterPointer, encoding, language) == 0){
+			return 0;
+		}
+		characterPointer += strideLength;
+	}
+	return 1;
+}
+
+/**
+ * Check if a sequence of characters conforms to different character
+ * checks
+ * @param func The function used to check
+ * @param charSequence The string to check
+ * @param encoding The encoding of the character
+ * @param language The language of the characters
+ * @returns {0 = false, 1 = true}
+ */
+static int _isLanguageSequenceOf(int (*func)(const char *, int, int), const char * charSequence, int encoding, int language){
+	return _isLanguageSequenceOfBounded(func, charSequence, _getStringByteLength(charSequence, encoding), encoding, language);
+}
+
+/**
+ * Check if a bounded sequence of characters is in a character class of a
+ * language. Runs of ascii characters are checked a vector at a time, and every
+ * other character with the character check.
+ * @param func The character check of the class
+ * @param characterClass The characterClasses bit that func checks for ascii characters
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the character
+ * @param language The language of the characters
+ * @returns {0 = false, 1 = true}
+ */
+static int _isLanguageClassSequenceOfBounded(int (*func)(const char *, int, int), int characterClass,
+		const char * charSequence, size_t numberOfBytes, int encoding, int language){
+	_asciiClassRanges ranges;
+	// Short strings are not worth splitting the class into ranges
+	if(numberOfBytes < 32 || !_getASCIIClassRanges(&ranges, encoding, language, characterClass)){
+		return _isLanguageSequenceOfBounded(func, charSequence, numberOfBytes, encoding, language);
+	}
+	size_t index = 0;
+	while(index < numberOfBytes){
+		size_t run = _asciiClassSpan(&ranges, charSequence + index, numberOfBytes - index);
+		index += run;
+		// A short run of ascii characters is followed by 64 bytes of characters
+		// checked one at a time, so text with many non ascii characters does not
+		// go back to the vectors after every one of them
+		size_t scalarEnd = index + (run < 16 ? 64 : 1);
+		if(scalarEnd > numberOfBytes){
+			scalarEnd = numberOfBytes;
+		}
+		while(index < scalarEnd){
+			int strideLength = _getCharacterStrideLengthBounded(charSequence + index, numberOfBytes - index, encoding);
+			if(strideLength == -1 || func(charSequence + index, encoding, language) == 0){
+				return 0;
+			}
+			index += strideLength;
+		}
+	}
+	return 1;
+}
+
+/**
+ * Check if a character or bounded sequence of character conforms to different
+ * character checks but with an offset
+ * @param func The function used to check
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the character
+ * @param language The language of the characters
+ * @param index The index of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isLanguageSequenceAtIndexBounded(int (*func)(const char *, int, int), const char * charSequence, size_t numberOfBytes,
+		int encoding, int language, int index){
+	if(index < 0 || (size_t)index > numberOfBytes){
+		return 0;
+	}
+	return _isLanguageSequenceOfBounded(func, charSequence + index, numberOfBytes - index, encoding, language);
+}
+
+/**
+ * Check if a character or sequence of character conforms to different
+ * character checks but with an offset
+ * @param func The function used to check
+ * @param charSequence The string to check
+ * @param encoding The encoding of the character
+ * @param language The language of the characters
+ * @param index The index of the character
+ * @returns {0 = false, 1 = true}
+ */
+static int isLanguageSequenceAtIndex(int (*func)(const char *, int, int), const char * charSequence, int encoding, int language,
+		int index){
+	int r;
+	if(index < 0){
+		return 0;
+	}
+	const char * characterPointer = charSequence;
+	for(r = 0; r < index; r++){
+		characterPointer++;
+	}
+	return _isLanguageSequenceOf(func, characterPointer, encoding, language);
+}
+
+/**
+ * A function that checks if an entire sequence is part of different languages
+ * @param charSequence The character sequence to check
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isInAlphabetSequence(const char * charSequence, int encoding, int language){
+	return _isLanguageClassSequenceOfBounded(isInAlphabet, CHARACTER_CLASS_ALPHA, charSequence, _getStringByteLength(charSequence, encoding),
+			encoding, language);
+}
+
+/**
+ * The bounded version of isInAlphabetSequence
+ * @param charSequence The character sequence to check
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isInAlphabetSequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+	return _isLanguageClassSequenceOfBounded(isInAlphabet, CHARACTER_CLASS_ALPHA, charSequence, numberOfBytes, encoding, language);
+}
+
+/**
+ * A function that checks if an entire sequence is part of the punctuation of a language
+ * @param charSequence The character sequence to check
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isPunctuationMarkInAlphabetSequence(const char * charSequence, int encoding, int language){
+	return _isLanguageClassSequenceOfBounded(isPunctuationMarkInAlphabet, CHARACTER_CLASS_PUNCT, charSequence, _getStringByteLength(charSequence, encoding),
+			encoding, language);
+}
+
+/**
+ * The bounded version of isPunctuationMarkInAlphabetSequence
+ * @param charSequence The character sequence to check
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isPunctuationMarkInAlphabetSequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+	return _isLanguageClassSequenceOfBounded(isPunctuationMarkInAlphabet, CHARACTER_CLASS_PUNCT, charSequence, numberOfBytes, encoding, language);
+}
+
+/**
+ * A function that checks if an entire sequence is part of the uppercase letters of an alphabet
+ * @param charSequence The character sequence to check
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isUpperCaseInAlphabetSequence(const char * charSequence, int encoding, int language){
+	return _isLanguageClassSequenceOfBounded(isUpperCaseInAlphabet, CHARACTER_CLASS_UPPER, charSequence, _getStringByteLength(charSequence, encoding),
+			encoding, language);
+}
+
+/**
+ * The bounded version of isUpperCaseInAlphabetSequence
+ * @param charSequence The character sequence to check
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isUpperCaseInAlphabetSequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+	return _isLanguageClassSequenceOfBounded(isUpperCaseInAlphabet, CHARACTER_CLASS_UPPER, charSequence, numberOfBytes, encoding, language);
+}
+
+/**
+ * A function that checks if an entire sequence is part of the lowercase letters of an alphabet
+ * @param charSequence The character sequence to check
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isLowerCaseInAlphabetSequence(const char * charSequence, int encoding, int language){
+	return _isLanguageClassSequenceOfBounded(isLowerCaseInAlphabet, CHARACTER_CLASS_LOWER, charSequence, _getStringByteLength(charSequence, encoding),
+			encoding, language);
+}
+
+/**
+ * The bounded version of isLowerCaseInAlphabetSequence
+ * @param charSequence The character sequence to check
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the character
+ * @param language The language of the character
+ * @returns {0=false, 1=true}
+ */
+static int isLowerCaseInAlphabetSequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+	return _isLanguageClassSequenceOfBounded(isLowerCaseInAlphabet, CHARACTER_CLASS_LOWER, charSequence, numberOfBytes, encoding, language);
+}
+
+/**
+ * Get the case mappings of an encoding in a language
+ * @param encoding The encoding of the characters
+ * @param language The language of the characters
+ * @param caseIndex LANGUAGE_CASE_UPPER or LANGUAGE_CASE_LOWER
+ * @returns {The mappings of the first 256 characters, or NULL for an unknown encoding or language}
+ */
+static const unsigned char * _getCaseMappings(int encoding, int language, int caseIndex){
+	if(language < 0 || language >= NUMBER_OF_LANGUAGES){
+		return NULL;
+	}
+	if(encoding == ASCII){
+		return languageCaseMappings[0][language][caseIndex];
+	}else if(encoding == ISO_8859_1){
+		return languageCaseMappings[1][language][caseIndex];
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return languageCaseMappings[2][language][caseIndex];
+	}
+	return NULL;
+}
+
+#if defined(LANGUAGE_SSE2)
+/**
+ * Convert the case of the bytes past ascii of a vector of a single byte
+ * encoding through its case mappings
+ * @param charSequence The bytes of the vector
+ * @param high The movemask of the bytes past ascii
+ * @param mappings The case mappings of the encoding
+ * @returns {The number of letters converted}
+ */
+static int _convertCaseHighBytes(char * charSequence, unsigned int high, const unsigned char * mappings){
+	int converted = 0;
+	while(high != 0){
+		int offset = _countTrailingZeros(high);
+		unsigned char byte = (unsigned char)charSequence[offset];
+		if(mappings[byte] != byte){
+			charSequence[offset] = (char)mappings[byte];
+			converted++;
+		}
+		high &= high - 1;
+	}
+	return converted;
+}
+#endif
+
+/**
+ * Convert the letters of a bounded sequence to the other case of the
+ * alphabet in place. No letter changes its length, see languageCaseMappings.
+ * The ascii letters are the same in every language, so they are converted
+ * a vector at a time with a compare and an xor. The bytes past ascii of the
+ * single byte encodings go through the table from the vector, while utf8
+ * leaves the vectors for them.
+ * @param charSequence The character sequence to convert
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the sequence
+ * @param language The language of the sequence
+ * @param caseIndex LANGUAGE_CASE_UPPER or LANGUAGE_CASE_LOWER
+ * @returns {The number of letters converted, or -1 for a malformed character and an unknown encoding or language}
+ */
+static int _convertCaseInAlphabetBounded(char * charSequence, size_t numberOfBytes, int encoding, int language, int caseIndex){
+	const unsigned char * mappings = _getCaseMappings(encoding, language, caseIndex);
+#if defined(LANGUAGE_SSE2)
+	// The ascii letters of the case that is converted
+	unsigned char first = caseIndex == LANGUAGE_CASE_UPPER ? 'a' : 'A';
+	unsigned char last = caseIndex == LANGUAGE_CASE_UPPER ? 'z' : 'Z';
+#endif
+	size_t index = 0;
+	int converted = 0;
+	if(mappings == NULL){
+		return -1;
+	}
+	if(charSequence == NULL){
+		return numberOfBytes == 0 ? 0 : -1;
+	}
+	if(encoding == UTF16){
+		unsigned short * units = (unsigned short *)charSequence;
+		size_t numberOfUnits = numberOfBytes / 2;
+		if(numberOfBytes % 2 != 0){
+			return -1;
+		}
+		// The code units past the first 256 code points have no mappings
+		for(index = 0; index < numberOfUnits; index++){
+			if(units[index] < 256 && mappings[units[index]] != units[index]){
+				units[index] = mappings[units[index]];
+				converted++;
+			}
+		}
+		return converted;
+	}
+	while(index < numberOfBytes){
+#if defined(LANGUAGE_AVX2)
+		const __m256i caseBit256 = _mm256_set1_epi8(0x20);
+		while(index + 32 <= numberOfBytes){
+			__m256i input = _mm256_loadu_si256((const __m256i *)(charSequence + index));
+			unsigned int high = (unsigned int)_mm256_movemask_epi8(input);
+			if(high != 0 && encoding == UTF8_BINARY){
+				break;
+			}
+			__m256i letters = _inRangeAVX2(input, first, last);
+			converted += _popCount((unsigned int)_mm256_movemask_epi8(letters));
+			_mm256_storeu_si256((__m256i *)(charSequence + index), _mm256_xor_si256(input, _mm256_and_si256(letters, caseBit256)));
+			converted += _convertCaseHighBytes(charSequence + index, high, mappings);
+			index += 32;
+		}
+#endif
+#if defined(LANGUAGE_SSE2)
+		const __m128i caseBit128 = _mm_set1_epi8(0x20);
+		while(index + 16 <= numberOfBytes){
+			__m128i input = _mm_loadu_si128((const __m128i *)(charSequence + index));
+			unsigned int high = (unsigned int)_mm_movemask_epi8(input);
+			if(high != 0 && encoding == UTF8_BINARY){
+				break;
+			}
+			__m128i letters = _inRangeSSE2(input, first, last);
+			converted += _popCount((unsigned int)_mm_movemask_epi8(letters));
+			_mm_storeu_si128((__m128i *)(charSequence + index), _mm_xor_si128(input, _mm_and_si128(letters, caseBit128)));
+			converted += _convertCaseHighBytes(charSequence + index, high, mappings);
+			index += 16;
+		}
+#endif
+		if(index == numberOfBytes){
+			break;
+		}
+		unsigned char byte = (unsigned char)charSequence[index];
+		if(byte < 0x80 || encoding != UTF8_BINARY){
+			if(mappings[byte] != byte){
+				charSequence[index] = (char)mappings[byte];
+				converted++;
+			}
+			index++;
+			continue;
+		}
+		int codePoint;
+		int strideLength = decodeUTF8Character(charSequence + index, numberOfBytes - index, &codePoint);
+		if(strideLength == -1){
+			return -1;
+		}
+		if(codePoint < 256 && mappings[codePoint] != codePoint){
+			_encodeUTF8Character(charSequence + index, mappings[codePoint], strideLength);
+			converted++;
+		}
+		index += strideLength;
+	}
+	return converted;
+}
+
+/**
+ * Convert the lower case letters of a sequence to the upper case of the
+ * alphabet in place, e.g. the n with a tilde of Spanish to its upper case. A letter
+ * whose upper case is not in the alphabet of the language is kept.
+ * @param charSequence The character sequence to convert
+ * @param encoding The encoding of the sequence
+ * @param language The language of the sequence
+ * @returns {The number of letters converted, or -1 for a malformed character and an unknown encoding or language}
+ */
+static int toUpperInAlphabet(char * charSequence, int encoding, int language){
+	return _convertCaseInAlphabetBounded(charSequence, _getStringByteLength(charSequence, encoding), encoding, language,
+			LANGUAGE_CASE_UPPER);
+}
+
+/**
+ * The bounded version of toUpperInAlphabet. A malformed utf8 character stops
+ * the conversion, with the characters before it converted.
+ * @param charSequence The character sequence to convert
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the sequence
+ * @param language The language of the sequence
+ * @returns {The number of letters converted, or -1 for a malformed character and an unknown encoding or language}
+ */
+static int toUpperInAlphabetBounded(char * charSequence, size_t numberOfBytes, int encoding, int language){
+	return _convertCaseInAlphabetBounded(charSequence, numberOfBytes, encoding, language, LANGUAGE_CASE_UPPER);
+}
+
+/**
+ * Convert the upper case letters of a sequence to the lower case of the
+ * alphabet in place. A letter whose lower case is not in the alphabet of the
+ * language is kept.
+ * @param charSequence The character sequence to convert
+ * @param encoding The encoding of the sequence
+ * @param language The language of the sequence
+ * @returns {The number of letters converted, or -1 for a malformed character and an unknown encoding or language}
+ */
+static int toLowerInAlphabet(char * charSequence, int encoding, int language){
+	return _convertCaseInAlphabetBounded(charSequence, _getStringByteLength(charSequence, encoding), encoding, language,
+			LANGUAGE_CASE_LOWER);
+}
+
+/**
+ * The bounded version of toLowerInAlphabet. A malformed utf8 character stops
+ * the conversion, with the characters before it converted.
+ * @param charSequence The character sequence to convert
+ * @param numberOfBytes The number of bytes in the sequence
+ * @param encoding The encoding of the sequence
+ * @param language The language of the sequence
+ * @returns {The number of letters converted, or -1 for a malformed character and an unknown encoding or language}
+ */
+static int toLowerInAlphabetBounded(char * charSequence, size_t numberOfBytes, int encoding, int language){
+	return _convertCaseInAlphabetBounded(charSequence, numberOfBytes, encoding, language, LANGUAGE_CASE_LOWER);
+}
+
+/**
+ * Get the diacritic foldings of an encoding in a language
+ * @param encoding The encoding of the characters
+ * @param language The language of the characters
+ * @param foldCase The foldCases value
+ * @returns {The foldings of the first 256 characters, or NULL for an unknown encoding, language or case}
+ */
+static const unsigned char * _getFoldings(int encoding, int language, int foldCase){
+	if(language < 0 || language >= NUMBER_OF_LANGUAGES || foldCase < 0 || foldCase >= LANGUAGE_FOLD_CASES){
+		return NULL;
+	}
+	if(encoding == ASCII){
+		return languageFoldings[0][language][foldCase];
+	}else if(encoding == ISO_8859_1){
+		return languageFoldings[1][language][foldCase];
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		return languageFoldings[2][language][foldCase];
+	}
+	return NULL;
+}
+
+/**
+ * Fold the utf16 code units of foldDiacriticsInto
+ * @param buffer The buffer that receives the code units, or NULL
+ * @param bufferCapacity The number of bytes in the buffer
+ * @param data The code units
+ * @param numberOfBytes The number of bytes of code units
+ * @param foldings The foldings of the language, see _getFoldings
+ * @param errorOffset Set to the offset of the first unpaired surrogate, or to
+ * numberOfBytes when the code units are valid. May be NULL.
+ * @returns {The number of bytes of the folded code units, or -1 for an unpaired surrogate}
+ */
+static long long _foldDiacriticsUTF16Into(char * buffer, size_t bufferCapacity, const char * data, size_t numberOfBytes,
+		const unsigned char * foldings, size_t * errorOffset){
+	size_t index = 0;
+	size_t foldedBytes = 0;
+	while(index < numberOfBytes){
+		int codePoint;
+		int strideLength = decodeUTF16Character(data + index, numberOfBytes - index, &codePoint);
+		if(strideLength == -1){
+			if(errorOffset != NULL){
+				*errorOffset = index;
+			}
+			return -1;
+		}
+		if(!isDiacriticalMark(codePoint)){
+			if(foldedBytes + strideLength <= bufferCapacity){
+				if(codePoint < 256){
+					unsigned short unit = foldings[codePoint];
+					memcpy(buffer + foldedBytes, &unit, sizeof(unit));
+				}else{
+					memmove(buffer + foldedBytes, data + index, strideLength);
+				}
+			}else{
+				bufferCapacity = 0;
 			}
-			char firstBit = *characterPointer;
+			foldedBytes += strideLength;
+		}
+		index += strideLength;
+	}
+	if(errorOffset != NULL){
+		*errorOffset = numberOfBytes;
+	}
+	return (long long)foldedBytes;
+}
 
+/**
+ * Fold the diacritics of text into a buffer owned by the caller, e.g. for the
+ * keys of a search. The extended letters of every language lose their marks,
+ * so the e with an acute accent of cafe folds to e in English too, and the
+ * combining marks of isDiacriticalMark are dropped. The text can be put in the upper or
+ * lower case of the alphabet in the same pass. Only whole characters that fit
+ * are written and the full size is always returned, so a NULL buffer asks
+ * for the size. No character gets longer, so the buffer can be the text
+ * itself, and as every character folds on its own a stream can be folded in
+ * pieces that end on a character boundary. Runs of ascii are copied a
+ * vector at a time.
+ * @param buffer The buffer that receives the folded text, or NULL
+ * @param bufferCapacity The number of bytes in the buffer
+ * @param data The text
+ * @param numberOfBytes The number of bytes of text
+ * @param encoding The encoding of the text
+ * @param language The language of the alphabet of foldCase
+ * @param foldCase The foldCases value
+ * @param errorOffset Set to the offset of the first malformed character, or
+ * to numberOfBytes when the text is valid. May be NULL.
+ * @returns {The number of bytes of the folded text, or -1 for a malformed character and an unknown encoding, language or case}
+ */
+static long long foldDiacriticsInto(char * buffer, size_t bufferCapacity, const char * data, size_t numberOfBytes,
+		int encoding, int language, int foldCase, size_t * errorOffset){
+	const unsigned char * foldings = _getFoldings(encoding, language, foldCase);
+#if defined(LANGUAGE_SSE2)
+	// The ascii letters that change their case, if any
+	unsigned char first = foldCase == FOLD_UPPER_CASE ? 'a' : 'A';
+	unsigned char last = foldCase == FOLD_UPPER_CASE ? 'z' : 'Z';
+	char caseBit = foldCase == FOLD_KEEP_CASE ? 0 : 0x20;
+#endif
+	size_t index = 0;
+	size_t foldedBytes = 0;
+	if(foldings == NULL){
+		return -1;
+	}
+	if(data == NULL){
+		numberOfBytes = 0;
+	}
+	if(buffer == NULL){
+		bufferCapacity = 0;
+	}
+	if(encoding == UTF16){
+		if(numberOfBytes % 2 != 0){
+			if(errorOffset != NULL){
+				*errorOffset = numberOfBytes - 1;
+			}
+			return -1;
+		}
+		return _foldDiacriticsUTF16Into(buffer, bufferCapacity, data, numberOfBytes, foldings, errorOffset);
+	}
+	while(index < numberOfBytes){
+		// The single byte encodings fold their bytes past ascii from the
+		// vector, while utf8 leaves the vectors for them
+#if defined(LANGUAGE_AVX2)
+		while(index + 32 <= numberOfBytes && foldedBytes + 32 <= bufferCapacity){
+			__m256i input = _mm256_loadu_si256((const __m256i *)(data + index));
+			unsigned int high = (unsigned int)_mm256_movemask_epi8(input);
+			if(high != 0 && encoding == UTF8_BINARY){
+				break;
+			}
+			__m256i letters = _inRangeAVX2(input, first, last);
+			_mm256_storeu_si256((__m256i *)(buffer + foldedBytes),
+					_mm256_xor_si256(input, _mm256_and_si256(letters, _mm256_set1_epi8(caseBit))));
+			while(high != 0){
+				int offset = _countTrailingZeros(high);
+				buffer[foldedBytes + offset] = (char)foldings[(unsigned char)data[index + offset]];
+				high &= high - 1;
+			}
+			index += 32;
+			foldedBytes += 32;
+		}
+#endif
+#if defined(LANGUAGE_SSE2)
+		while(index + 16 <= numberOfBytes && foldedBytes + 16 <= bufferCapacity){
+			__m128i input = _mm_loadu_si128((const __m128i *)(data + index));
+			unsigned int high = (unsigned int)_mm_movemask_epi8(input);
+			if(high != 0 && encoding == UTF8_BINARY){
+				break;
+			}
+			__m128i letters = _inRangeSSE2(input, first, last);
+			_mm_storeu_si128((__m128i *)(buffer + foldedBytes), _mm_xor_si128(input, _mm_and_si128(letters, _mm_set1_epi8(caseBit))));
+			while(high != 0){
+				int offset = _countTrailingZeros(high);
+				buffer[foldedBytes + offset] = (char)foldings[(unsigned char)data[index + offset]];
+				high &= high - 1;
+			}
+			index += 16;
+			foldedBytes += 16;
+		}
+#endif
+		if(index == numberOfBytes){
+			break;
+		}
+		unsigned char byte = (unsigned char)data[index];
+		if(byte < 0x80 || encoding != UTF8_BINARY){
+			if(foldedBytes < bufferCapacity){
+				buffer[foldedBytes] = (char)foldings[byte];
+			}else{
+				bufferCapacity = 0;
+			}
+			foldedBytes++;
+			index++;
+			continue;
+		}
+		int codePoint;
+		int strideLength = decodeUTF8Character(data + index, numberOfBytes - index, &codePoint);
+		if(strideLength == -1){
+			if(errorOffset != NULL){
+				*errorOffset = index;
+			}
+			return -1;
+		}
+		if(!isDiacriticalMark(codePoint)){
+			int length = codePoint < 256 ? _getCodePointUTF8Length(foldings[codePoint]) : strideLength;
+			if(foldedBytes + length <= bufferCapacity){
+				if(codePoint < 256){
+					_encodeUTF8Character(buffer + foldedBytes, foldings[codePoint], length);
+				}else{
+					// The text can be the buffer, which is never ahead of it
+					memmove(buffer + foldedBytes, data + index, strideLength);
+				}
+			}else{
+				// Keep what is written a prefix of the folded text
+				bufferCapacity = 0;
+			}
+			foldedBytes += length;
+		}
+		index += strideLength;
+	}
+	if(errorOffset != NULL){
+		*errorOffset = numberOfBytes;
+	}
+	return (long long)foldedBytes;
+}
 
-			// Get the effective utf8 value to check
-			effectiveUTFValue = ((c & 0xf) << 10) + ((secondBit & 0x3f) << 6) + (firstBit & 0x3f);
+/**
+ * A reader of the folded utf8 bytes of a text, the bytes that foldDiacriticsInto
+ * writes in the lower case of the alphabet. A malformed character reads as
+ * 0xff, which is no byte of utf8, and the bytes of the character.
+ */
+typedef struct{
+	const char * data;					// The text
+	size_t numberOfBytes;				// The number of bytes of text
+	size_t index;						// The offset of the next character
+	int encoding;						// The encoding of the text
+	const unsigned char * foldings;		// The foldings of the language, or NULL to read the bytes as they are
+	unsigned char bytes[5];				// The folded bytes of the last character read
+	int length;							// The number of folded bytes of the last character
+	int offset;							// The folded bytes of the last character that have been read
+} _foldedReader;
 
-			// Preincrement and decrement if it is a diacritical mark
-			if(!isDiacriticalMark(effectiveUTFValue)){
-				stringLength++;
-			}
+/**
+ * Start reading the folded bytes of a text
+ * @param reader The reader to initialize
+ * @param data The text
+ * @param numberOfBytes The number of bytes of text
+ * @param encoding The encoding of the text
+ * @param language The language of the text
+ */
+static void _foldedReaderInit(_foldedReader * reader, const char * data, size_t numberOfBytes, int encoding, int language){
+	reader->data = data;
+	reader->numberOfBytes = data != NULL ? numberOfBytes : 0;
+	reader->index = 0;
+	reader->encoding = encoding;
+	reader->foldings = _getFoldings(encoding, language, FOLD_LOWER_CASE);
+	reader->length = 0;
+	reader->offset = 0;
+}
 
-			utf8ParseState = UTF8_BINARY_START_PARSE_STATE;
+/**
+ * Fold the next character of a reader into its bytes. A combining mark folds
+ * to no bytes.
+ * @param reader The reader
+ */
+static void _readFoldedCharacter(_foldedReader * reader){
+	const char * charValue = reader->data + reader->index;
+	size_t numberOfBytes = reader->numberOfBytes - reader->index;
+	unsigned char byte = (unsigned char)*charValue;
+	int codePoint = byte;
+	int strideLength = 1;
+	reader->offset = 0;
+	if(reader->foldings == NULL){
+		reader->bytes[0] = byte;
+		reader->length = 1;
+		reader->index++;
+		return;
+	}
+	if(reader->encoding == UTF16){
+		strideLength = decodeUTF16Character(charValue, numberOfBytes, &codePoint);
+	}else if(reader->encoding == UTF8_BINARY && byte >= 0x80){
+		strideLength = decodeUTF8Character(charValue, numberOfBytes, &codePoint);
+	}
+	if(strideLength == -1){
+		// A malformed utf8 byte, or a code unit that is an unpaired surrogate or cut off
+		int length = reader->encoding == UTF16 && numberOfBytes >= 2 ? 2 : 1;
+		reader->bytes[0] = 0xff;
+		memcpy(reader->bytes + 1, charValue, length);
+		reader->length = length + 1;
+		reader->index += length;
+		return;
+	}
+	reader->index += strideLength;
+	if(codePoint >= 0x300 && isDiacriticalMark(codePoint)){
+		reader->length = 0;
+		return;
+	}
+	if(codePoint < 256){
+		codePoint = reader->foldings[codePoint];
+	}
+	reader->length = _getCodePointUTF8Length(codePoint);
+	_encodeUTF8Character((char *)reader->bytes, codePoint, reader->length);
+}
 
-		}else if(utf8ParseState == UTF8_BINARY_21BIT_STATE){
-			int l;
-			for(l=0; l < 3; l++){
-				characterPointer++;
-				if(*characterPointer == '\0'){
-					return UTF8_BINARY_ERROR_STATE;
-				}
-			}
-			utf8ParseState = UTF8_BINARY_START_PARSE_STATE;
-		}else if(utf8ParseState == UTF8_BINARY_ERROR_STATE){
+/**
+ * Get the next folded byte of a reader
+ * @param reader The reader
+ * @returns {The byte, or -1 at the end of the text}
+ */
+static int _nextFoldedByte(_foldedReader * reader){
+	while(reader->offset == reader->length){
+		if(reader->index == reader->numberOfBytes){
 			return -1;
 		}
-		// Iterate the character pointer
-		characterPointer++;
+		unsigned char byte = (unsigned char)reader->data[reader->index];
+		if(byte < 0x80 && reader->foldings != NULL && reader->encoding != UTF16){
+			reader->index++;
+			return reader->foldings[byte];
+		}
+		_readFoldedCharacter(reader);
 	}
-
-	return stringLength;
+	return reader->bytes[reader->offset++];
 }
 
+#if defined(LANGUAGE_SSE2)
 /**
- * Check if a character is a number in different encodings
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Check if a reader is at a run of ascii that can be folded a vector at a time
+ * @param reader The reader
  * @returns {0 = false, 1 = true}
  */
-static int isNumber(const char * charValue, int encoding){
-	if(encoding == UTF8_BINARY || encoding == ASCII || encoding == ISO_8859_1){
-		if(*charValue >= 48 && *charValue <= 57){
-			return 1;
-		}else{
-			return 0;
+static int _isFoldedReaderAtAscii(const _foldedReader * reader){
+	return reader->offset == reader->length && reader->foldings != NULL && reader->encoding != UTF16;
+}
+
+/**
+ * Put the ascii letters of a vector in lower case
+ * @param input The ascii bytes
+ */
+static __m128i _foldAsciiSSE2(__m128i input){
+	return _mm_xor_si128(input, _mm_and_si128(_inRangeSSE2(input, 'A', 'Z'), _mm_set1_epi8(0x20)));
+}
+#endif
+
+#if defined(LANGUAGE_AVX2)
+/**
+ * Put the ascii letters of a vector in lower case
+ * @param input The ascii bytes
+ */
+static __m256i _foldAsciiAVX2(__m256i input){
+	return _mm256_xor_si256(input, _mm256_and_si256(_inRangeAVX2(input, 'A', 'Z'), _mm256_set1_epi8(0x20)));
+}
+#endif
+
+/**
+ * Compare two texts without their case and diacritics, as the lower case
+ * foldDiacriticsInto of both would compare with memcmp, but without folding
+ * them into buffers. The order of the folded utf8 is the order of the code
+ * points. Runs of ascii in both texts are compared a vector at a time. A
+ * malformed character compares after every character, and an unknown
+ * encoding or language compares the bytes as they are.
+ * @param first The first text
+ * @param firstNumberOfBytes The number of bytes of the first text
+ * @param second The second text
+ * @param secondNumberOfBytes The number of bytes of the second text
+ * @param encoding The encoding of the texts
+ * @param language The language of the texts
+ * @returns {Less than, equal to or greater than 0 as the first text folds to less than, the same as or more than the second}
+ */
+static int compareFolded(const char * first, size_t firstNumberOfBytes, const char * second, size_t secondNumberOfBytes,
+		int encoding, int language){
+	_foldedReader firstReader;
+	_foldedReader secondReader;
+	_foldedReaderInit(&firstReader, first, firstNumberOfBytes, encoding, language);
+	_foldedReaderInit(&secondReader, second, secondNumberOfBytes, encoding, language);
+	while(1){
+#if defined(LANGUAGE_SSE2)
+		if(_isFoldedReaderAtAscii(&firstReader) && _isFoldedReaderAtAscii(&secondReader)){
+			const char * firstData = firstReader.data;
+			const char * secondData = secondReader.data;
+#if defined(LANGUAGE_AVX2)
+			while(firstReader.index + 32 <= firstReader.numberOfBytes && secondReader.index + 32 <= secondReader.numberOfBytes){
+				__m256i firstInput = _mm256_loadu_si256((const __m256i *)(firstData + firstReader.index));
+				__m256i secondInput = _mm256_loadu_si256((const __m256i *)(secondData + secondReader.index));
+				if(_mm256_movemask_epi8(_mm256_or_si256(firstInput, secondInput)) != 0){
+					break;
+				}
+				unsigned int equal = (unsigned int)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_foldAsciiAVX2(firstInput),
+						_foldAsciiAVX2(secondInput)));
+				if(equal != 0xffffffff){
+					int offset = _countTrailingZeros(~equal);
+					return firstReader.foldings[(unsigned char)firstData[firstReader.index + offset]] -
+							secondReader.foldings[(unsigned char)secondData[secondReader.index + offset]];
+				}
+				firstReader.index += 32;
+				secondReader.index += 32;
+			}
+#endif
+			while(firstReader.index + 16 <= firstReader.numberOfBytes && secondReader.index + 16 <= secondReader.numberOfBytes){
+				__m128i firstInput = _mm_loadu_si128((const __m128i *)(firstData + firstReader.index));
+				__m128i secondInput = _mm_loadu_si128((const __m128i *)(secondData + secondReader.index));
+				if(_mm_movemask_epi8(_mm_or_si128(firstInput, secondInput)) != 0){
+					break;
+				}
+				unsigned int equal = (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(_foldAsciiSSE2(firstInput),
+						_foldAsciiSSE2(secondInput)));
+				if(equal != 0xffff){
+					int offset = _countTrailingZeros(~equal);
+					return firstReader.foldings[(unsigned char)firstData[firstReader.index + offset]] -
+							secondReader.foldings[(unsigned char)secondData[secondReader.index + offset]];
+				}
+				firstReader.index += 16;
+				secondReader.index += 16;
+			}
+		}
+#endif
+		int firstByte = _nextFoldedByte(&firstReader);
+		int secondByte = _nextFoldedByte(&secondReader);
+		if(firstByte != secondByte || firstByte == -1){
+			return firstByte - secondByte;
 		}
-	}else{
-		return 0;
 	}
 }
 
 /**
- * Check if a sequence of characters conforms to different character
- * checks
- * @param func The function used to check
- * @param charSequence The string to check
- * @param encoding The encoding of the character
- * @returns {0 = false, 1 = true}
+ * Mix a word of folded bytes into a hash
+ * @param hash The hash so far
+ * @param word The next 8 folded bytes, the first in the low byte
+ * @returns {The hash}
  */
-static int _isSequenceOf(int (*func)(const char *, int), const char * charSequence, int encoding){
-	int r;
-	const char * characterPointer = charSequence;
-	while(*characterPointer != '\0'){
-		if(func(characterPointer, encoding) == 0){
-			return 0;
+static unsigned long long _mixFoldedWord(unsigned long long hash, unsigned long long word){
+	hash = (hash ^ word) * 0x9e3779b97f4a7c15ULL;
+	return hash ^ (hash >> 32);
+}
+
+/**
+ * Hash a text without its case and diacritics, as the hash of the lower
+ * case foldDiacriticsInto of the text but without folding it into a buffer.
+ * Texts that compareFolded finds the same have the same hash, also across
+ * encodings. The folded bytes are mixed 8 at a time, and runs of ascii are
+ * folded a vector at a time. An unknown encoding or language hashes the
+ * bytes as they are.
+ * @param data The text
+ * @param numberOfBytes The number of bytes of text
+ * @param encoding The encoding of the text
+ * @param language The language of the text
+ * @returns {The 64 bit hash of the folded text}
+ */
+static unsigned long long hashFolded(const char * data, size_t numberOfBytes, int encoding, int language){
+	_foldedReader reader;
+	unsigned long long hash = 0xcbf29ce484222325ULL;
+	unsigned long long word = 0;
+	unsigned long long foldedBytes = 0;
+	int byte;
+	_foldedReaderInit(&reader, data, numberOfBytes, encoding, language);
+	while(1){
+#if defined(LANGUAGE_SSE2)
+		if(foldedBytes % 8 == 0 && _isFoldedReaderAtAscii(&reader)){
+			while(reader.index + 16 <= reader.numberOfBytes){
+				__m128i input = _mm_loadu_si128((const __m128i *)(reader.data + reader.index));
+				unsigned long long words[2];
+				if(_mm_movemask_epi8(input) != 0){
+					break;
+				}
+				// The words are little endian, as the bytes are mixed below
+				_mm_storeu_si128((__m128i *)words, _foldAsciiSSE2(input));
+				hash = _mixFoldedWord(_mixFoldedWord(hash, words[0]), words[1]);
+				reader.index += 16;
+				foldedBytes += 16;
+			}
 		}
-		int strideLength = getCharacterStrideLength(charSequence, encoding);
-		for(r = 0; r < strideLength; r++){
-			characterPointer++;
+#endif
+		byte = _nextFoldedByte(&reader);
+		if(byte == -1){
+			break;
+		}
+		word |= (unsigned long long)byte << (8 * (foldedBytes % 8));
+		foldedBytes++;
+		if(foldedBytes % 8 == 0){
+			hash = _mixFoldedWord(hash, word);
+			word = 0;
 		}
 	}
-	return 1;
+	// The length tells the last bytes from zeros, and the finalizer of
+	// MurmurHash3 spreads the last word through the hash
+	hash = _mixFoldedWord(hash ^ foldedBytes, word);
+	hash ^= hash >> 33;
+	hash *= 0xff51afd7ed558ccdULL;
+	hash ^= hash >> 33;
+	hash *= 0xc4ceb9fe1a85ec53ULL;
+	return hash ^ (hash >> 33);
 }
 
 /**
- * Check if a sequence of character conforms to different character
- * checks after an index
- * @param func The function used to check
- * @param charSequence The string to check
- * @param encoding The encoding of the sequence
- * @param index The index of the character
- * @returns {0 = false, 1 = true}
+ * Get the classes of the character at the start of a bounded buffer
+ * @param charValue The character
+ * @param numberOfBytes The number of bytes left in the buffer
+ * @param encoding UTF8_BINARY or UTF16
+ * @param language ENGLISH, SPANISH or FRENCH
+ * @param codePoint Set to the code point of the character
+ * @param classes Set to the characterClasses bits of the character
+ * @returns {The number of bytes of the character, or -1 for a malformed or cut off character}
  */
-static int isSequenceAtIndex(int (*func)(const char *, int), const char * charSequence, int encoding,
-		int index){
-	int r;
-	if(index < 0){
-		return 0;
+static int _getUnicodeCharacterClassesBounded(const char * charValue, size_t numberOfBytes, int encoding, int language,
+		int * codePoint, int * classes){
+	int length = 1;
+	*codePoint = (unsigned char)*charValue;
+	if(encoding == UTF16){
+		length = decodeUTF16Character(charValue, numberOfBytes, codePoint);
+	}else if(*codePoint >= 0x80){
+		length = decodeUTF8Character(charValue, numberOfBytes, codePoint);
 	}
-	const char * characterPointer = charSequence;
-	for(r = 0; r < index; r++){
-		characterPointer++;
+	if(length != -1){
+		// Every character that decodes is a valid character
+		*classes = getUnicodeCharacterClasses(*codePoint, language) | CHARACTER_CLASS_VALID;
 	}
-	return _isSequenceOf(func, characterPointer, encoding);
+	return length;
 }
 
 /**
- * Check if a sequence of characters is a number in a different encodings
- * @param charSequence The character to check
- * @param encoding The encoding of the character
- * @returns {0 = false, 1 = true}
+ * Get the classes of a character in a language that has no tables. The other
+ * languages have the romance core as their alphabet, and no cases or
+ * punctuation marks, as in isInAlphabet.
+ * @param classes The English classes of the character
  */
-static int isNumberSequence(const char * charValueSequence, int encoding){
-	return _isSequenceOf(isNumber, charValueSequence, encoding);
+static int _getUnknownLanguageClasses(int classes){
+	classes &= CHARACTER_CLASS_DIGIT | CHARACTER_CLASS_HEX | CHARACTER_CLASS_VALID | CHARACTER_CLASS_ROMANCE;
+	if(classes & CHARACTER_CLASS_ROMANCE){
+		classes |= CHARACTER_CLASS_ALPHA;
+	}
+	return classes;
 }
 
 /**
- * Check if a characters is a hex number in different encodings
- * @param charValue The character to check
- * @param encoding The encoding of the character
- * @return {0=false, 1= true}
+ * Classify a bounded sequence of characters in one pass. A bit of the result
+ * is set when every character has the class, so it is the result of the
+ * sequence check of the class: CHARACTER_CLASS_DIGIT for isNumberSequence,
+ * HEX for isHexSequence, VALID for isValidCharacterSequence, ROMANCE for
+ * isInRomanceAlphabetSequence, ALPHA for isInAlphabetSequence, PUNCT for
+ * isPunctuationMarkInAlphabetSequence, UPPER for isUpperCaseInAlphabetSequence
+ * and LOWER for isLowerCaseInAlphabetSequence. The scan stops once no class
+ * is left.
+ * @param charSequence The string to classify
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @returns {The characterClasses bits of every character, 0 for a malformed or cut off character}
  */
-static int isHex(const char * charValue, int encoding){
-	if(encoding == UTF8_BINARY || encoding == ASCII || encoding == ISO_8859_1){
-		if(*charValue >= 48 && *charValue <= 57){
-			return 1;
-		}
-		if(*charValue >= 65 && *charValue <= 70){
-			return 1; // a-f
+static int classifySequenceBounded(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+	int knownLanguage = language >= ENGLISH && language < NUMBER_OF_LANGUAGES;
+	int tableLanguage = knownLanguage ? language : ENGLISH;
+	int classes = CHARACTER_CLASS_ALL;
+	size_t index = 0;
+
+	if(numberOfBytes == 0){
+		return CHARACTER_CLASS_ALL;
+	}
+	if(encoding == ASCII || encoding == ISO_8859_1){
+		const unsigned short * table = getCharacterClassTable(encoding, tableLanguage);
+		for(index = 0; index < numberOfBytes && classes != 0; index++){
+			classes &= table[(unsigned char)charSequence[index]];
 		}
-		if(*charValue >= 97 && *charValue <= 102){
-			return 1; // A-F
+	}else if(encoding == UTF8_BINARY || encoding == UTF16){
+		while(index < numberOfBytes && classes != 0){
+			int codePoint;
+			int characterClasses;
+			int length = _getUnicodeCharacterClassesBounded(charSequence + index, numberOfBytes - index, encoding, tableLanguage,
+					&codePoint, &characterClasses);
+			if(length == -1){
+				return 0;
+			}
+			classes &= characterClasses;
+			index += length;
 		}
-		return 0;
 	}else{
 		return 0;
 	}
+	return knownLanguage ? classes : _getUnknownLanguageClasses(classes);
 }
 
 /**
- * Check if a sequence of characeters is hex
- * @param charSequence The character to check
- * @param encoding The encoding of the character
- * @returns {0 = false, 1 = true}
+ * Classify a sequence of characters in one pass
+ * @param charSequence The string to classify
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @returns {The characterClasses bits of every character, 0 for a malformed character}
  */
-static int isHexSequence(const char * charValueSequence, int encoding){
-	return _isSequenceOf(isHex, charValueSequence, encoding);
+static int classifySequence(const char * charSequence, int encoding, int language){
+	return classifySequenceBounded(charSequence, _getStringByteLength(charSequence, encoding), encoding, language);
 }
 
 /**
- * A function that checks if a character is a valid part of an
- * encoding. This will not work for encoding that require multiple
- * bytes
- * @param charValue The character to check
- * @param encoding The encoding to check
- * @returns {0 = false, 1 = true}
+ * The number of characters of a string in each character class
  */
-static int isValidCharacter(const char * charValue, int encoding){
-	char value = *charValue;
-	if(encoding == ASCII){
-		if(value < 0x7f){
-			return 1;
-		}else{
-			return 0;
+typedef struct{
+	size_t numberOfCharacters;	// Every character
+	size_t alphabet;			// In the alphabet of the language, isInAlphabet
+	size_t upperCase;			// Upper case in the language, isUpperCaseInAlphabet
+	size_t lowerCase;			// Lower case in the language, isLowerCaseInAlphabet
+	size_t digits;				// 0-9, isNumber
+	size_t punctuationMarks;	// A punctuation mark of the language, isPunctuationMarkInAlphabet
+	size_t extended;			// A letter of the language beyond the romance core
+	size_t diacriticalMarks;	// A combining diacritical mark, isDiacriticalMark
+} characterClassHistogram;
+
+/**
+ * The classes counted a vector at a time for runs of ascii characters. Ascii
+ * has no extended letters and no combining marks, so those counts only come
+ * from the characters that are checked one at a time.
+ */
+#define ASCII_HISTOGRAM_CLASSES 5
+
+/**
+ * Add the classes of a character to a histogram
+ * @param histogram The histogram
+ * @param codePoint The code point of the character
+ * @param classes The characterClasses bits of the character
+ */
+static void _addToClassHistogram(characterClassHistogram * histogram, int codePoint, int classes){
+	histogram->numberOfCharacters++;
+	histogram->alphabet += (classes & CHARACTER_CLASS_ALPHA) != 0;
+	histogram->upperCase += (classes & CHARACTER_CLASS_UPPER) != 0;
+	histogram->lowerCase += (classes & CHARACTER_CLASS_LOWER) != 0;
+	histogram->digits += (classes & CHARACTER_CLASS_DIGIT) != 0;
+	histogram->punctuationMarks += (classes & CHARACTER_CLASS_PUNCT) != 0;
+	histogram->extended += (classes & CHARACTER_CLASS_EXTENDED) != 0;
+	histogram->diacriticalMarks += isDiacriticalMark(codePoint);
+}
+
+/**
+ * Count the ascii characters of the histogram classes a vector at a time.
+ * The count stops at the first vector with a byte past 0x7f, or at the last
+ * whole vector.
+ * @param ranges The ranges of the alphabet, upper case, lower case, digit and
+ * punctuation mark classes
+ * @param buffer The buffer to count
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param histogram The histogram to add the counts to
+ * @returns {The number of bytes counted}
+ */
+static size_t _asciiClassHistogramBlocks(const _asciiClassRanges * ranges, const char * buffer, size_t numberOfBytes,
+		characterClassHistogram * histogram){
+	size_t counts[ASCII_HISTOGRAM_CLASSES] = {0, 0, 0, 0, 0};
+	size_t index = 0;
+	int c;
+	int r;
+#if defined(LANGUAGE_AVX2)
+	for(; index + 32 <= numberOfBytes; index += 32){
+		__m256i input = _mm256_loadu_si256((const __m256i *)(buffer + index));
+		if(_mm256_movemask_epi8(input) != 0){
+			break;
 		}
-	}else if(encoding == ISO_8859_1){
-		if((value > 0x20 && value < 0x7f) || (unsigned char)value > 0x9f){
-			return 1;
-		}else{
-			return 0;
+		for(c = 0; c < ASCII_HISTOGRAM_CLASSES; c++){
+			__m256i matches = _mm256_setzero_si256();
+			for(r = 0; r < ranges[c].numberOfRanges; r++){
+				matches = _mm256_or_si256(matches, _inRangeAVX2(input, ranges[c].low[r], ranges[c].high[r]));
+			}
+			counts[c] += _popCount((unsigned int)_mm256_movemask_epi8(matches));
+		}
+	}
+#endif
+#if defined(LANGUAGE_SSE2)
+	for(; index + 16 <= numberOfBytes; index += 16){
+		__m128i input = _mm_loadu_si128((const __m128i *)(buffer + index));
+		if(_mm_movemask_epi8(input) != 0){
+			break;
+		}
+		for(c = 0; c < ASCII_HISTOGRAM_CLASSES; c++){
+			__m128i matches = _mm_setzero_si128();
+			for(r = 0; r < ranges[c].numberOfRanges; r++){
+				matches = _mm_or_si128(matches, _inRangeSSE2(input, ranges[c].low[r], ranges[c].high[r]));
+			}
+			counts[c] += _popCount((unsigned int)_mm_movemask_epi8(matches));
 		}
-	}else{
-		return 0;
 	}
+#else
+	(void)ranges;
+	(void)buffer;
+	(void)numberOfBytes;
+#endif
+	(void)c;
+	(void)r;
+	histogram->numberOfCharacters += index;
+	histogram->alphabet += counts[0];
+	histogram->upperCase += counts[1];
+	histogram->lowerCase += counts[2];
+	histogram->digits += counts[3];
+	histogram->punctuationMarks += counts[4];
+	return index;
 }
 
 /**
- * A function that checks if a string is filled with valid characters
- * in an encoding. This will not work for encodings that require multiple
- * bytes
- * @param charSequence The character to check
- * @param encoding The encoding of the character
- * @returns {0 = false, 1 = true}
+ * Count the characters of a bounded sequence in each character class in one
+ * pass. Runs of ascii characters are counted a vector at a time.
+ * @param charSequence The string to count
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @param histogram Set to the counts of the characters before the end of the
+ * string, or before the first malformed character
+ * @returns {0 = a malformed or cut off character, 1 = every character was counted}
  */
-static int isValidCharacterSequence(const char * charSequence, int encoding){
-	return _isSequenceOf(isValidCharacter, charSequence, encoding);
+static int classHistogramBounded(const char * charSequence, size_t numberOfBytes, int encoding, int language,
+		characterClassHistogram * histogram){
+	int knownLanguage = language >= ENGLISH && language < NUMBER_OF_LANGUAGES;
+	int tableLanguage = knownLanguage ? language : ENGLISH;
+	const unsigned short * table = getCharacterClassTable(encoding, tableLanguage);
+	_asciiClassRanges ranges[ASCII_HISTOGRAM_CLASSES];
+	const int rangeClasses[ASCII_HISTOGRAM_CLASSES] = {CHARACTER_CLASS_ALPHA, CHARACTER_CLASS_UPPER, CHARACTER_CLASS_LOWER,
+			CHARACTER_CLASS_DIGIT, CHARACTER_CLASS_PUNCT};
+	int vectors = knownLanguage && encoding != UTF16 && numberOfBytes >= 32;
+	size_t index = 0;
+	int c;
+
+	memset(histogram, 0, sizeof(characterClassHistogram));
+	if(table == NULL && encoding != UTF8_BINARY && encoding != UTF16){
+		return numberOfBytes == 0;
+	}
+#if !defined(LANGUAGE_SSE2) && !defined(LANGUAGE_AVX2)
+	vectors = 0;
+#endif
+	for(c = 0; c < ASCII_HISTOGRAM_CLASSES && vectors; c++){
+		// A class without ascii characters has no ranges, and counts none of them
+		vectors = _getASCIIClassRanges(&ranges[c], encoding, language, rangeClasses[c]) || ranges[c].numberOfRanges == 0;
+	}
+	while(index < numberOfBytes){
+		size_t scalarEnd = numberOfBytes;
+		if(vectors){
+			size_t run = _asciiClassHistogramBlocks(ranges, charSequence + index, numberOfBytes - index, histogram);
+			index += run;
+			// The characters up to the end of the vector that stopped the count
+			// are counted one at a time
+			scalarEnd = index + 32 < numberOfBytes ? index + 32 : numberOfBytes;
+		}
+		while(index < scalarEnd){
+			int codePoint = (unsigned char)charSequence[index];
+			int classes;
+			int length = 1;
+			if(table != NULL){
+				classes = table[codePoint];
+			}else{
+				length = _getUnicodeCharacterClassesBounded(charSequence + index, numberOfBytes - index, encoding, tableLanguage,
+						&codePoint, &classes);
+				if(length == -1){
+					return 0;
+				}
+			}
+			_addToClassHistogram(histogram, codePoint, knownLanguage ? classes : _getUnknownLanguageClasses(classes));
+			index += length;
+		}
+	}
+	return 1;
 }
 
 /**
- * A function that checks if a string is filled with the romance
- * alphabet(a-z, A-Z) in different encodings
- * @param charSequence The character to check
- * @param encoding The encoding of the character
- * @returns {0 = false, 1 = true}
+ * Count the characters of a sequence in each character class in one pass
+ * @param charSequence The string to count
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @param histogram Set to the counts of the characters
+ * @returns {0 = a malformed character, 1 = every character was counted}
  */
-static int isInRomanceAlphabetSequence(const char * charSequence, int encoding){
-	return _isSequenceOf(isInRomanceAlphabet, charSequence, encoding);
+static int classHistogram(const char * charSequence, int encoding, int language, characterClassHistogram * histogram){
+	return classHistogramBounded(charSequence, _getStringByteLength(charSequence, encoding), encoding, language, histogram);
 }
 
 /**
- * Check if a character is part of the extended set of characters
- * that are observed in Spanish in a specific encoding
- * @param charValue The character associated with
- * @param encoding The encoding to check for
- * @return {0 = false, 1 = true}
+ * Get the length of the longest prefix of a bounded sequence whose characters
+ * are in a character class, like strspn. A character is in the class when it
+ * has any of the characterClass bits, so spanOfBounded(CHARACTER_CLASS_DIGIT, ...)
+ * is the number of leading digits. Runs of ascii characters are checked a
+ * vector at a time.
+ * @param characterClass The characterClasses bits of the class
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @param codePointOffset Set to the number of characters in the prefix, or NULL
+ * @returns {The number of bytes in the prefix, numberOfBytes when every character is in the class}
  */
-static int isSpanishExtendedCharacter(const char * charValue, int encoding){
-	if(encoding == ASCII){
-		return 0;
-	}else if(encoding == ISO_8859_1){
-		unsigned char value = (unsigned char)(*charValue);
-		// c1 = A(acute), e1 = a(acute), c9 = E(acute), e9 = e(acute),
-		// cd = I(acute), ed = i(acute), d3 = O(acute), f3 = o(acute),
-		// da = U(acute), fa = u(acute), fc = u(diaresis), d1 = N(tilde)
-		// f1 = n(tilde)
-		if(value == 0xc1 || value == 0xe1 || value == 0xc9 || value == 0xe9 ||
-				value == 0xcd || value == 0xed || value == 0xd3 || value == 0xf3  ||
-				value == 0xda || value == 0xfa || value == 0xfc || value == 0xd1 ||
-				value == 0xf1){
-			return 1;
-		}else{
-			return 0;
+static size_t spanOfBounded(int characterClass, const char * charSequence, size_t numberOfBytes, int encoding, int language,
+		size_t * codePointOffset){
+	int knownLanguage = language >= ENGLISH && language < NUMBER_OF_LANGUAGES;
+	int tableLanguage = knownLanguage ? language : ENGLISH;
+	const unsigned short * table = getCharacterClassTable(encoding, tableLanguage);
+	_asciiClassRanges ranges;
+	size_t index = 0;
+	size_t numberOfCharacters = 0;
+	int inClass = table != NULL || encoding == UTF8_BINARY || encoding == UTF16;
+
+	// Short strings are not worth splitting the class into ranges
+	int vectors = knownLanguage && encoding != UTF16 && numberOfBytes >= 32 &&
+			_getASCIIClassRanges(&ranges, encoding, language, characterClass);
+	while(index < numberOfBytes && inClass){
+		size_t scalarEnd = numberOfBytes;
+		if(vectors){
+			size_t run = _asciiClassSpan(&ranges, charSequence + index, numberOfBytes - index);
+			index += run;
+			numberOfCharacters += run;
+			// As in _isClassSequenceOfBounded, a short run is followed by 64
+			// bytes of characters checked one at a time
+			scalarEnd = index + (run < 16 ? 64 : 1);
+			if(scalarEnd > numberOfBytes){
+				scalarEnd = numberOfBytes;
+			}
 		}
-	}else if(encoding == UTF8_BINARY){
-		// 193 = A(acute), 225 = a(acute), 201 = E(acute), 233 = e(acute)
-		// 205 = I(acute), 237 = i(acute), 211 = O(acute), 243 = o(acute)
-		// 218 = U(acute), 250 = u(acute), 252 = u(diaresis), 241 = n(tilde)
-		// 209 = N(tilde)
-		int spanishCodePointList[13] = {
-			193,225,201,233,205,237,211,243,
-			218,250,252,241,209
-		};
-		return isUTF8BinaryCharacterInUTFSet(charValue, spanishCodePointList, 13);
-	}else{
-		return 0;
+		while(index < scalarEnd && inClass){
+			int codePoint;
+			int classes;
+			int length = 1;
+			if(table != NULL){
+				classes = table[(unsigned char)charSequence[index]];
+			}else{
+				length = _getUnicodeCharacterClassesBounded(charSequence + index, numberOfBytes - index, encoding,
+						tableLanguage, &codePoint, &classes);
+			}
+			inClass = length != -1 && ((knownLanguage ? classes : _getUnknownLanguageClasses(classes)) & characterClass) != 0;
+			if(inClass){
+				index += length;
+				numberOfCharacters++;
+			}
+		}
+	}
+	if(codePointOffset != NULL){
+		*codePointOffset = numberOfCharacters;
 	}
+	return index;
+}
+
+/**
+ * Get the length of the longest prefix of a sequence whose characters are in
+ * a character class
+ * @param characterClass The characterClasses bits of the class
+ * @param charSequence The string to check
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @param codePointOffset Set to the number of characters in the prefix, or NULL
+ * @returns {The number of bytes in the prefix}
+ */
+static size_t spanOf(int characterClass, const char * charSequence, int encoding, int language, size_t * codePointOffset){
+	return spanOfBounded(characterClass, charSequence, _getStringByteLength(charSequence, encoding), encoding, language,
+			codePointOffset);
+}
+
+/**
+ * Find the first character of a bounded sequence that is not in a character
+ * class. A malformed or cut off character is never in a class.
+ * @param characterClass The characterClasses bits of the class
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @param codePointOffset Set to the number of characters before the one found, or NULL
+ * @returns {The byte offset of the character, or -1 when every character is in the class}
+ */
+static long long findFirstNotBounded(int characterClass, const char * charSequence, size_t numberOfBytes, int encoding,
+		int language, size_t * codePointOffset){
+	size_t span = spanOfBounded(characterClass, charSequence, numberOfBytes, encoding, language, codePointOffset);
+	return span == numberOfBytes ? -1 : (long long)span;
 }
 
 /**
- * Check if a character is pat of the extended set of characters
- * that are observed in French for a specific encoding
- * @param charValue The character to check
- * @param encoding The encoding to check in
- * @return {0 = false, 1 = true}
+ * Find the first character of a sequence that is not in a character class
+ * @param characterClass The characterClasses bits of the class
+ * @param charSequence The string to check
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @param codePointOffset Set to the number of characters before the one found, or NULL
+ * @returns {The byte offset of the character, or -1 when every character is in the class}
+ */
+static long long findFirstNot(int characterClass, const char * charSequence, int encoding, int language,
+		size_t * codePointOffset){
+	return findFirstNotBounded(characterClass, charSequence, _getStringByteLength(charSequence, encoding), encoding, language,
+			codePointOffset);
+}
+
+/**
+ * The score of a bigram of a language in scoreLanguages
+ */
+#define LANGUAGE_SCORE_BIGRAM 1
+
+/**
+ * The score of a letter or punctuation mark past ascii that is in a language,
+ * and the penalty of one that is only in other languages
  */
-static int isFrenchExtendedCharacter(const char * charValue, int encoding){
-	if(encoding == ASCII){
-		return 0;
-	}else if(encoding == ISO_8859_1){
-		unsigned char value = (unsigned char)(*charValue);
-		// c9 = E(acute), e9 = e(acute), c0 = A(grave), e0 = a(grave)
-		// c8 = E(grave), e8 = e(grave), d9 = U(grave), f9 = u(grave)
-		// c2 = A(circumflex), e2 = a(circumflex), ca = E(circumflex), ea = e(circumflex)
-		// ce = I(circumflex), ee = i(circumflex), d4 = O(circumflex), f4 = o(circumflex)
-		// db = U(circumflex), fb = u(circumflex), cb = E(diaresis), eb = e(diaresis)
-		// cc = I(diaresis), ec = i(diaresis), dc = U(diaresis), fc = u(diaresis)
-		// ff = y(diaresis), c7 = cedilla, e7 = cedilla
-		if(value == 0xc9 || value == 0xe9 || value == 0xc0 || value == 0xe0 ||
-				value == 0xc8 || value == 0xe8 || value == 0xd9 || value == 0xf9 ||
-				value == 0xc2 || value == 0xe2 || value == 0xca || value == 0xe1 ||
-				value == 0xd4 || value == 0xf4 || value == 0xce || value == 0xee ||
-				value == 0xdb || value == 0xfb || value == 0xcb || value == 0xeb ||
-				value == 0xcc || value == 0xec || value == 0xdc || value == 0xfc ||
-				value == 0xff || value == 0xc7 || value == 0xe7){
-			return 1;
-		}else{
-			return 0;
+#define LANGUAGE_SCORE_LETTER 8
+#define LANGUAGE_SCORE_FOREIGN 8
+
+/**
+ * Add the evidence of a character past ascii to the scores of the languages
+ * @param codePoint The code point of the character, or the byte of a single byte encoding
+ * @param encoding The encoding of the character
+ * @param scores The scores of the languages
+ */
+static void _scoreLanguagesCharacter(int codePoint, int encoding, long long * scores){
+	int evidence[NUMBER_OF_LANGUAGES];
+	int anyLanguage = 0;
+	int language;
+	for(language = 0; language < NUMBER_OF_LANGUAGES; language++){
+		int classes = encoding == ASCII || encoding == ISO_8859_1 ?
+				singleByteCharacterClasses[encoding - ASCII][language][codePoint] : getUnicodeCharacterClasses(codePoint, language);
+		evidence[language] = classes & (CHARACTER_CLASS_ALPHA | CHARACTER_CLASS_PUNCT);
+		anyLanguage |= evidence[language];
+	}
+	// A character of no language, like a CJK ideograph, is no evidence
+	if(anyLanguage){
+		for(language = 0; language < NUMBER_OF_LANGUAGES; language++){
+			scores[language] += evidence[language] ? LANGUAGE_SCORE_LETTER : -LANGUAGE_SCORE_FOREIGN;
 		}
-	}else if(encoding == UTF8_BINARY){
-		// 201 = e(acute), 233 = E(acute), 192 = A(grave), 224 = a(grave)
-		// 200 = E(grave), 232 = e(grave), 217 = U(grave), 249 = u(grave)
-		// 194 = A(circumflex), 226 = a(circumflex), 202 = E(circumflex), 234 = e(circumflex)
-		// 206 = I(circumflex), 238 = i(circumflex),  212 = O(circumflex), 244 = o(circumflex)
-		// 219 = U(circumflex), 251 = u(circumflex), 203 = E(diaresis), 235 = e(diaresis)
-		// 207 = I(diaresis), 239 = i(diaresis), 220 = U(diaresis), 252 = u(diaresis)
-		// 255 = y(diaresis), 199 = cedilla capital, 231 cedilla lower
-		int frenchCodePointList[27] = {
-				201,233,192,224,200,232,217,249,
-				194,226,202,234,206,238,212,244,
-				219,251,203,235,207,239,220,252,
-				255,199,231
-				};
-		return isUTF8BinaryCharacterInUTFSet(charValue, frenchCodePointList, 27);
-	}else{
-		return 0;
 	}
 }
 
 /**
- * Check if a character is part of english punctuation marks
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Add the bigram of an ascii character and the letter before it to the scores
+ * of the languages
+ * @param previous The letter before the character, 0 for a word boundary
+ * @param character The ascii character
+ * @param scores The scores of the languages
+ * @returns {The letter of the character, 0 for a word boundary}
  */
-static int isEnglishPunctuationMark(const char * charValue, int encoding){
-	// UTF8 and binary are the same for the first 127 characters
-	if(encoding == ASCII || encoding == UTF8_BINARY){
-		char value = *charValue;
-		// 20 = !, 21=", 27=', 28=(
-		// 29 = ), 2c=, ,2e=., 3a=:
-		// 3b = ;, 3f=?, 5b=[, 5d=]
-		// 7b = {, 7d=}, 2d=-
-		if(value == 0x20 || value == 0x21 || value == 0x27 || value == 0x28 ||
-		   value == 0x29 || value == 0x2c || value == 0x2e || value == 0x3a ||
-		   value == 0x3b || value == 0x3f || value == 0x5b || value == 0x5d ||
-		   value == 0x7b || value == 0x7d || value == 0x2d){
-			return 1;
-		}else{
-			return 0;
-		}
-	}else if(encoding == ISO_8859_1){
-		unsigned char value = (unsigned char)(*charValue);
-		// 21 = !, 22 = ", 27 = ', 28 = (
-		// 29 = ), 2c = ,, 2e = ., 3a = :
-		// 3b = ;, 3f = ?, 5b = [, 5d = ]
-		// 7b = {, 7d = }, 2d = -
-		if(value == 0x21 || value == 0x22 || value == 0x27 || value == 0x28 ||
-		   value == 0x29 || value == 0x2c || value == 0x2e || value == 0x3a ||
-		   value == 0x3b || value == 0x3f || value == 0x5b || value == 0x5d ||
-		   value == 0x7b || value == 0x7d || value == 0x2d){
-			return 1;
-		}else{
-			return 0;
-		}
-	}else{
-		return 0;
+static unsigned int _scoreLanguagesBigram(unsigned int previous, int character, long long * scores){
+	// 1-26 for a letter in either case, and 0 for the word boundaries
+	unsigned int letter = (unsigned int)((character | 0x20) - 'a');
+	unsigned int languages;
+	letter = letter < 26 ? letter + 1 : 0;
+	languages = languageBigrams[previous * LANGUAGE_BIGRAM_LETTERS + letter];
+	while(languages){
+		scores[_countTrailingZeros(languages)] += LANGUAGE_SCORE_BIGRAM;
+		languages &= languages - 1;
 	}
+	return letter;
 }
 
 /**
- * Check if a character is part of the spanish punctutation marks
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Add the bigrams of a run of ascii bytes to the scores of the languages
+ * @param buffer The buffer
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param index The index of the run, set to the index past it
+ * @param previous The letter before the run, 0 for a word boundary
+ * @param scores The scores of the languages
+ * @returns {The last letter of the run, 0 for a word boundary}
  */
-static int isSpanishPunctuationMark(const char * charValue, int encoding){
-	// The ASCII set does not contain all of the spanish punctuation marks
-	if(encoding == ASCII){
-		return 0;
-	}else if(encoding == ISO_8859_1){
-		unsigned char value = (unsigned char)(*charValue);
-		// 21 = !, 22 = ", 27 = ', 28 = (
-		// 29 = ), 2c = ,, 2e = ., 3a = :
-		// 3b = ;, 3f = ?, 5b = [, 5d = ]
-		// 7b = {, 7d = }, ab = <<, bb = >>
-		// a1 = flip(!), bf = flip(?), 2d = -
-		if(value == 0x21 || value == 0x22 || value == 0x27 || value == 0x28 ||
-		   value == 0x29 || value == 0x2c || value == 0x2e || value == 0x3a ||
-		   value == 0x3b || value == 0x3f || value == 0x5b || value == 0x5d ||
-		   value == 0x7b || value == 0x7d || value == 0xab || value == 0xbb ||
-		   value == 0xa1 || value == 0xbf || value == 0x2d){
-			return 1;
-		}else{
-			return 0;
-		}
-	}else if(encoding == UTF8_BINARY){
-		char value = *charValue;
-		// 21 = !, 22 = ", 27 = ', 28 = (
-		// 29 = ), 2c = ,, 2e = ., 3a = :
-		// 3b = ;, 3f = ?, 5b = [, 5d = ]
-		// 7b = {, 7d = }, 2d = -
-		if(value == 0x21 || value == 0x22 || value == 0x27 || value == 0x28 ||
-		   value == 0x29 || value == 0x2c || value == 0x2e || value == 0x3a ||
-		   value == 0x3b || value == 0x3f || value == 0x5b || value == 0x5d ||
-		   value == 0x7b || value == 0x7d || value == 0x2d){
-			return 1;
-		}else{
-			// ab = <<, bb = >> a1 = flip(!), bf = flip(?)
-			int spanisCodeList[4] = {0xab,0xbb,0xa1,0xbf};
-			return isUTF8BinaryCharacterInUTFSet(charValue, spanisCodeList, 4);
-		}
-	}else{
-		return 0;
+static unsigned int _scoreLanguagesASCII(const char * buffer, size_t numberOfBytes, size_t * index, unsigned int previous,
+		long long * scores){
+	size_t i = *index;
+	while(i < numberOfBytes && (unsigned char)buffer[i] < 0x80){
+		previous = _scoreLanguagesBigram(previous, buffer[i], scores);
+		i++;
 	}
+	*index = i;
+	return previous;
 }
 
 /**
- * Check if a character is part of the french punctutation marks
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Score a bounded sequence of characters in every language in one pass. The
+ * extended letters and the punctuation marks past ascii score for the
+ * languages that have them and against the ones that do not, and the bigrams
+ * of ascii letters of languageBigrams score for their languages. The ascii
+ * characters outside of the bigrams are shared by every language, and are no
+ * evidence.
+ * @param charSequence The string to score
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the string
+ * @param scores Set to the scores of the languages, indexed by the language
+ * @returns {The language with the highest score, the lowest one on a tie, or -1 for a malformed or cut off character}
  */
-static int isFrenchPunctuationMark(const char * charValue, int encoding){
-	// The ASCII set does not contain all of the spanish punctuation marks
-	if(encoding == ASCII){
-		return 0;
-	}else if(encoding == ISO_8859_1){
-		unsigned char value = (unsigned char)(*charValue);
-		// 21 = !, 22 = ", 27 = ', 28 = (
-		// 29 = ), 2c = ,, 2e = ., 3a = :
-		// 3b = ;, 3f = ?, 5b = [, 5d = ]
-		// 7b = {, 7d = }, ab = <<, bb = >>
-		// 2d = -
-		if(value == 0x21 || value == 0x22 || value == 0x27 || value == 0x28 ||
-		   value == 0x29 || value == 0x2c || value == 0x2e || value == 0x3a ||
-		   value == 0x3b || value == 0x3f || value == 0x5b || value == 0x5d ||
-		   value == 0x7b || value == 0x7d ||value == 0x2d){
-			return 1;
-		}else{
-			return 0;
+static int scoreLanguagesBounded(const char * charSequence, size_t numberOfBytes, int encoding,
+		long long scores[NUMBER_OF_LANGUAGES]){
+	size_t index = 0;
+	unsigned int previous = 0;
+	int best = ENGLISH;
+	int language;
+
+	memset(scores, 0, NUMBER_OF_LANGUAGES * sizeof(long long));
+	if(encoding != ASCII && encoding != ISO_8859_1 && encoding != UTF8_BINARY && encoding != UTF16){
+		return -1;
+	}
+	while(index < numberOfBytes){
+		int codePoint = (unsigned char)charSequence[index];
+		int length = 1;
+		if(encoding == UTF16){
+			length = decodeUTF16Character(charSequence + index, numberOfBytes - index, &codePoint);
+		}else if(codePoint < 0x80){
+			// The runs of ascii bytes are the bulk of most text, so they have a loop of their own
+			previous = _scoreLanguagesASCII(charSequence, numberOfBytes, &index, previous, scores);
+			continue;
+		}else if(encoding == UTF8_BINARY){
+			length = decodeUTF8Character(charSequence + index, numberOfBytes - index, &codePoint);
 		}
-	}else if(encoding == UTF8_BINARY){
-		char value = *charValue;
-		// 21 = !, 22 = ", 27 = ', 28 = (
-		// 29 = ), 2c = ,, 2e = ., 3a = :
-		// 3b = ;, 3f = ?, 5b = [, 5d = ]
-		// 7b = {, 7d = }, 2d = -
-		if(value == 0x21 || value == 0x22 || value == 0x27 || value == 0x28 ||
-		   value == 0x29 || value == 0x2c || value == 0x2e || value == 0x3a ||
-		   value == 0x3b || value == 0x3f || value == 0x5b || value == 0x5d ||
-		   value == 0x7b || value == 0x7d || value == 0x2d){
-			return 1;
+		if(length == -1){
+			return -1;
+		}
+		if(codePoint < 0x80){
+			previous = _scoreLanguagesBigram(previous, codePoint, scores);
 		}else{
-			// ab = <<, bb = >>
-			int frenchCodeList[2] = {0xab,0xbb};
-			return isUTF8BinaryCharacterInUTFSet(charValue, frenchCodeList, 2);
+			_scoreLanguagesCharacter(codePoint, encoding, scores);
+			previous = 0;
 		}
-	}else{
-		return 0;
+		index += length;
 	}
+	for(language = 1; language < NUMBER_OF_LANGUAGES; language++){
+		if(scores[language] > scores[best]){
+			best = language;
+		}
+	}
+	return best;
 }
 
 /**
- * Check if a character is part of an alphabet's punctuation for different languages
- * and encodings.
- * @param charValue The character to check
- * @param encoding The encoding of the character
- * @param language The language of the character
- * @returns {0=false, 1=true}
+ * Score a sequence of characters in every language in one pass
+ * @param charSequence The string to score
+ * @param encoding The encoding of the string
+ * @param scores Set to the scores of the languages, indexed by the language
+ * @returns {The language with the highest score, or -1 for a malformed character}
  */
-static int isPunctuationMarkInAlphabet(const char * charValue, int encoding, int language){
-	if(language == ENGLISH){
-		return isEnglishPunctuationMark(charValue, encoding);
-	}else if(language == FRENCH){
-		return isFrenchPunctuationMark(charValue, encoding);
-	}else if(language == SPANISH){
-		return isSpanishPunctuationMark(charValue, encoding);
-	}else{
-		return 0;
-	}
+static int scoreLanguages(const char * charSequence, int encoding, long long scores[NUMBER_OF_LANGUAGES]){
+	return scoreLanguagesBounded(charSequence, _getStringByteLength(charSequence, encoding), encoding, scores);
 }
 
 /**
- * Check if a character is upper case in the english language
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Score a batch of bounded sequences of characters in every language
+ * @param charSequences The strings to score
+ * @param numberOfBytes The number of bytes in each string
+ * @param numberOfSequences The number of strings
+ * @param encoding The encoding of the strings
+ * @param scores Set to the scores of the languages of each string, or NULL
+ * @param languages Set to the language with the highest score of each string, or -1 for a malformed string
+ * @returns {The number of strings without a malformed or cut off character}
  */
-static int isUpperCaseEnglish(const char * charValue, int encoding){
-	if(encoding == ASCII || encoding == UTF8_BINARY || encoding == ISO_8859_1){
-		if(*charValue >= 65 && *charValue <= 90){
-			return 1;
-		}else{
-			return 0;
+static size_t scoreLanguagesBatch(const char * const * charSequences, const size_t * numberOfBytes, size_t numberOfSequences,
+		int encoding, long long (*scores)[NUMBER_OF_LANGUAGES], int * languages){
+	long long sequenceScores[NUMBER_OF_LANGUAGES];
+	size_t numberScored = 0;
+	size_t s;
+	for(s = 0; s < numberOfSequences; s++){
+		languages[s] = scoreLanguagesBounded(charSequences[s], numberOfBytes[s], encoding,
+				scores != NULL ? scores[s] : sequenceScores);
+		if(languages[s] != -1){
+			numberScored++;
 		}
-	}else{
-		return 0;
 	}
+	return numberScored;
 }
 
 /**
- * Check if a character is upper case in the spanish language
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Convert character encoding to a number. At the moment, encoding is ignored
+ * @param charValue The character to convert
+ * @returns {0-9}
  */
-static int isUpperCaseSpanish(const char * charValue, int encoding){
-	if(encoding == ASCII){
-		return 0;
-	}else if(encoding == ISO_8859_1){
-		if(*charValue >= 65 && *charValue <= 90){
-			return 1;
-		}else{
-			unsigned char value = (unsigned char)(*charValue);
-			// c1 = A(acute),  c9 = E(acute), cd = I(acute), d3 = O(acute)
-			// da = U(acute), d1 = N(tilde)
-			if(value == 0xc1 || value == 0xc9 || value == 0xcd || value == 0xd3 ||
-					value == 0xda || value == 0xd1){
-				return 1;
-			}else{
-				return 0;
-			}
-		}
-	}else if(encoding == UTF8_BINARY){
-		if(*charValue >= 65 && *charValue <= 90){
-			return 1;
-		}else{
-			// 193 = A(acute), 201 = E(acute), 205 = I(acute),  211 = O(acute),
-			// 218 = U(acute), 209 = N(tilde)
-			int spanishCodePointList[6] = {
-				193,201,205,211,218,209
-			};
-			return isUTF8BinaryCharacterInUTFSet(charValue, spanishCodePointList, 6);
-		}
-	}else{
-		return 0;
-	}
+static int convertToNumber(const char *charValue, int encoding){
+	return *charValue - 48;
 }
 
 /**
- * Check if a character is an upper case in the French language
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Convert hex character into binary in a certain encoding
+ * @param hexValue The hex value
+ * @param encoding The encoding of the hexValue
  */
-static int isUpperCaseFrench(const char * charValue, int encoding){
-	if(encoding == ASCII){
-		return 0;
-	}else if(encoding == ISO_8859_1){
-		if(*charValue >= 65 && *charValue <= 90){
-			return 1;
-		}else{
-			unsigned char value = (unsigned char)(*charValue);
-			// c9 = E(acute), c0 = A(grave), c8 = E(grave), d9 = U(grave),
-			// c2 = A(circumflex),  ca = E(circumflex), ce = I(circumflex), d4 = O(circumflex)
-			// db = U(circumflex),  cb = E(diaresis), cc = I(diaresis),  dc = U(diaresis)
-			// c7 = cedilla
-			if(value == 0xc9 || value == 0xc0 || value == 0xc8 || value == 0xd9 ||
-				value == 0xc2 || value == 0xca || value == 0xce || value == 0xd4 ||
-				value == 0xdb || value == 0xcb || value == 0xcc || value == 0xdc ||
-				value == 0xc7){
-				return 1;
-			}else{
-				return 0;
-			}
+static char convertHex(const char * hexValue, int encoding){
+	if(encoding == UTF8_BINARY || encoding == ASCII || encoding == ISO_8859_1){
+		// Handle 0-9
+		if(*hexValue >= 48 && *hexValue <= 57){
+			return *hexValue - 48;
 		}
-	}else if(encoding == UTF8_BINARY){
-		if(*charValue >= 65 && *charValue <= 90){
-			return 1;
-		}else{
-			// 201 = E(acute)  192 = A(grave), 200 = E(grave), 217 = U(grave)
-			// 194 = A(circumflex), 202 = E(circumflex), 206 = I(circumflex), 212 = O(circumflex)
-			// 219 = U(circumflex),  203 = E(diaresis), 207 = I(diaresis),  220 = U(diaresis)
-			// 199 = cedilla capital
-			int frenchCodePointList[13] = {
-					201,192,200,217,194,202,206,212,
-					219,203,207,220,199
-			};
-			return isUTF8BinaryCharacterInUTFSet(charValue, frenchCodePointList, 13);
+
+		// Handle A-F
+		if(*hexValue >= 65 && *hexValue <= 70){
+			return *hexValue - 55; // ([70,65] - 10)
+		}
+
+		// Handle a-f
+		if(*hexValue >= 97 && *hexValue <= 102){
+			return *hexValue - 87; // ([102, 97] - 10)
 		}
+		return -1;
 	}else{
-		return 0;
+		return -1;
 	}
 }
 
 /**
- * Check if a character is upper case in an alphabet for different languages
- * and encodings
- * @param charValue The character to check
- * @param encoding The encoding of the character
- * @param language The language of the character
+ * The state of the grapheme cluster breaks between the characters of a string
  */
-static int isUpperCaseInAlphabet(const char * charValue, int encoding, int language){
-	if(language == ENGLISH){
-		return isUpperCaseEnglish(charValue, encoding);
-	}else if(language == SPANISH){
-		return isUpperCaseSpanish(charValue, encoding);
-	}else if(language == FRENCH){
-		return isUpperCaseFrench(charValue, encoding);
-	}else{
-		return 0;
+typedef struct{
+	int previous;				// The break property of the previous character, -1 before the first
+	int emoji;					// 1 after an extended pictographic and its extends, 2 after a ZWJ that follows them
+	int regionalIndicators;		// The number of regional indicators right before the character
+} graphemeBreakState;
+
+/**
+ * Start the grapheme cluster breaks of a string
+ * @param state The state to initialize
+ */
+static void _graphemeBreakInit(graphemeBreakState * state){
+	state->previous = -1;
+	state->emoji = 0;
+	state->regionalIndicators = 0;
+}
+
+/**
+ * Check if a character starts a grapheme cluster, with the rules of UAX #29,
+ * and move the state past it
+ * @param state The state of the breaks before the character
+ * @param property The break property of the character
+ * @returns {0 = the character extends the cluster before it, 1 = the character starts a cluster}
+ */
+static int _isGraphemeBreak(graphemeBreakState * state, int property){
+	int previous = state->previous;
+	int isBreak = 1;
+
+	if(previous == -1){
+		isBreak = 1;														// GB1
+	}else if(previous == GRAPHEME_BREAK_CR && property == GRAPHEME_BREAK_LF){
+		isBreak = 0;														// GB3
+	}else if(previous == GRAPHEME_BREAK_CONTROL || previous == GRAPHEME_BREAK_CR || previous == GRAPHEME_BREAK_LF ||
+			property == GRAPHEME_BREAK_CONTROL || property == GRAPHEME_BREAK_CR || property == GRAPHEME_BREAK_LF){
+		isBreak = 1;														// GB4, GB5
+	}else if(previous == GRAPHEME_BREAK_L && (property == GRAPHEME_BREAK_L || property == GRAPHEME_BREAK_V ||
+			property == GRAPHEME_BREAK_LV || property == GRAPHEME_BREAK_LVT)){
+		isBreak = 0;														// GB6
+	}else if((previous == GRAPHEME_BREAK_LV || previous == GRAPHEME_BREAK_V) &&
+			(property == GRAPHEME_BREAK_V || property == GRAPHEME_BREAK_T)){
+		isBreak = 0;														// GB7
+	}else if((previous == GRAPHEME_BREAK_LVT || previous == GRAPHEME_BREAK_T) && property == GRAPHEME_BREAK_T){
+		isBreak = 0;														// GB8
+	}else if(property == GRAPHEME_BREAK_EXTEND || property == GRAPHEME_BREAK_ZWJ || property == GRAPHEME_BREAK_SPACING_MARK ||
+			previous == GRAPHEME_BREAK_PREPEND){
+		isBreak = 0;														// GB9, GB9a, GB9b
+	}else if(state->emoji == 2 && property == GRAPHEME_BREAK_EXTENDED_PICTOGRAPHIC){
+		isBreak = 0;														// GB11
+	}else if(property == GRAPHEME_BREAK_REGIONAL_INDICATOR && state->regionalIndicators % 2 == 1){
+		isBreak = 0;														// GB12, GB13
+	}
+
+	// The emoji sequences and the pairs of regional indicators
+	if(property == GRAPHEME_BREAK_EXTENDED_PICTOGRAPHIC){
+		state->emoji = 1;
+	}else if(property == GRAPHEME_BREAK_ZWJ && state->emoji == 1){
+		state->emoji = 2;
+	}else if(property != GRAPHEME_BREAK_EXTEND || state->emoji != 1){
+		state->emoji = 0;
 	}
+	state->regionalIndicators = property == GRAPHEME_BREAK_REGIONAL_INDICATOR ? state->regionalIndicators + 1 : 0;
+	state->previous = property;
+	return isBreak;
 }
 
 /**
- * Check if a character is lower case in the english language
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Find the end of a run of ascii bytes, and count the CR LF pairs that end in
+ * it. Every other ascii byte after the first one of a run starts a grapheme
+ * cluster, so the run is counted without the break rules.
+ * @param buffer The buffer that contains the string
+ * @param index The start of the run, past the first byte of the buffer
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param lineBreaks Set to the number of LF bytes in the run that follow a CR
+ * @returns {The index past the run}
  */
-static int isLowerCaseEnglish(const char * charValue, int encoding){
-	if(encoding == ASCII || encoding == UTF8_BINARY || encoding == ISO_8859_1){
-		if(*charValue >= 97 && *charValue <= 122){
-			return 1;
-		}else{
-			return 0;
+static size_t _asciiGraphemeRun(const char * buffer, size_t index, size_t numberOfBytes, size_t * lineBreaks){
+	size_t pairs = 0;
+#if defined(LANGUAGE_AVX2)
+	const __m256i cr = _mm256_set1_epi8('\r');
+	const __m256i lf = _mm256_set1_epi8('\n');
+	for(; index + 32 <= numberOfBytes; index += 32){
+		__m256i input = _mm256_loadu_si256((const __m256i *)(buffer + index));
+		if(_mm256_movemask_epi8(input) != 0){
+			break;
 		}
-	}else{
-		return 0;
+		// The bytes before the ones of the vector, for the CR of a pair
+		__m256i before = _mm256_loadu_si256((const __m256i *)(buffer + index - 1));
+		pairs += _popCount((unsigned int)_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(input, lf),
+				_mm256_cmpeq_epi8(before, cr))));
+	}
+#endif
+#if defined(LANGUAGE_SSE2)
+	const __m128i cr128 = _mm_set1_epi8('\r');
+	const __m128i lf128 = _mm_set1_epi8('\n');
+	for(; index + 16 <= numberOfBytes; index += 16){
+		__m128i input = _mm_loadu_si128((const __m128i *)(buffer + index));
+		if(_mm_movemask_epi8(input) != 0){
+			break;
+		}
+		__m128i before = _mm_loadu_si128((const __m128i *)(buffer + index - 1));
+		pairs += _popCount((unsigned int)_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(input, lf128),
+				_mm_cmpeq_epi8(before, cr128))));
 	}
+#endif
+	while(index < numberOfBytes && (unsigned char)buffer[index] < 0x80){
+		pairs += buffer[index] == '\n' && buffer[index - 1] == '\r';
+		index++;
+	}
+	*lineBreaks = pairs;
+	return index;
 }
 
 /**
- * Check if a character is lower case in the spanish language
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * Return the number of extended grapheme clusters of a bounded buffer, the
+ * characters that a reader sees. A base character and its combining marks,
+ * an emoji ZWJ sequence, a flag, a Hangul syllable of jamo and a CR LF pair
+ * are one cluster each. After the first byte of a run of ascii bytes, the
+ * run is counted a vector at a time.
+ * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param encoding The encoding of the string, ISO-8859-1 bytes being the first 256 code points
+ * @returns {The number of clusters, or -1 for a malformed or cut off character and an unknown encoding}
  */
-static int isLowerCaseSpanish(const char * charValue, int encoding){
-	if(encoding == ASCII){
-		return 0;
-	}else if(encoding == ISO_8859_1){
-		if(*charValue >= 97 && *charValue <= 122){
-			return 1;
-		}else{
-			unsigned char value = (unsigned char)(*charValue);
-			// e1 = a(acute), e9 = e(acute), ed = i(acute), f3 = o(acute),
-			// fa = u(acute), fc = u(diaresis), f1 = n(tilde)
-			if(value == 0xe1 || value == 0xe9 || value == 0xed || value == 0xf3 ||
-					value == 0xfa || value == 0xfc || value == 0xf1){
-				return 1;
-			}else{
-				return 0;
-			}
+static int _lenGraphemeClustersBounded(const char * buffer, size_t numberOfBytes, int encoding){
+	graphemeBreakState state;
+	int stringLength = 0;
+	size_t index = 0;
+	if(encoding != ASCII && encoding != ISO_8859_1 && encoding != UTF8_BINARY && encoding != UTF16){
+		return UTF8_BINARY_ERROR_STATE;
+	}
+	_graphemeBreakInit(&state);
+	while(index < numberOfBytes){
+		int codePoint = (unsigned char)buffer[index];
+		int length = 1;
+		if(encoding == UTF16){
+			length = decodeUTF16Character(buffer + index, numberOfBytes - index, &codePoint);
+		}else if(encoding == UTF8_BINARY && codePoint >= 0x80){
+			length = decodeUTF8Character(buffer + index, numberOfBytes - index, &codePoint);
 		}
-	}else if(encoding == UTF8_BINARY){
-		if(*charValue >= 97 && *charValue <= 122){
-			return 1;
-		}else{
-			// 225 = a(acute), 233 = e(acute), 237 = i(acute), 243 = o(acute)
-			// 250 = u(acute), 252 = u(diaresis), 241 = n(tilde)
-			int spanishCodePointList[7] = {
-					225,233,237,243,250,252,241
-			};
-			return isUTF8BinaryCharacterInUTFSet(charValue, spanishCodePointList, 7);
+		if(length == -1){
+			return UTF8_BINARY_ERROR_STATE;
+		}
+		stringLength += _isGraphemeBreak(&state, getGraphemeBreakProperty(codePoint));
+		index += length;
+
+		// The rest of a run of ascii bytes breaks before every byte but the LF of a CR LF
+		if(codePoint < 0x80 && encoding != UTF16 && index < numberOfBytes && (unsigned char)buffer[index] < 0x80){
+			size_t lineBreaks;
+			size_t runEnd = _asciiGraphemeRun(buffer, index, numberOfBytes, &lineBreaks);
+			stringLength += (int)(runEnd - index - lineBreaks);
+			index = runEnd;
+			_graphemeBreakInit(&state);
+			state.previous = getGraphemeBreakProperty((unsigned char)buffer[index - 1]);
 		}
-	}else{
-		return 0;
 	}
+	return stringLength;
 }
 
 /**
- * Check if a character is an upper case in the French language
- * @param charValue The character to check
- * @param encoding The encoding of the character
+ * A string length of a bounded buffer that handles different encodings
+ * found in the wild. The buffer does not need to be NUL terminated, and the
+ * byte length of the single byte encodings is returned without a scan.
+ * With LEN_GRAPHEME_CLUSTERS in the encoding, the extended grapheme clusters
+ * are counted instead.
+ * @param buffer: The buffer that contains the string
+ * @param numberOfBytes: The number of bytes in the buffer
+ * @param encoding: The encoding used to find the byte length, and the lenModes flags
  */
-static int isLowerCaseFrench(const char * charValue, int encoding){
-	if(encoding == ASCII){
+static int lenBounded(const char * buffer, size_t numberOfBytes, int encoding){
+
+	// Handle an incorrectly structured buffer
+	if(buffer == NULL){
 		return 0;
+	}
+
+	if(encoding & LEN_GRAPHEME_CLUSTERS){
+		return _lenGraphemeClustersBounded(buffer, numberOfBytes, encoding & ~LEN_GRAPHEME_CLUSTERS);
+	}
+
+	// Deal with the simple ASCII/LATIN cases
+	if(encoding == ASCII){
+		return (int)numberOfBytes;
 	}else if(encoding == ISO_8859_1){
-		if(*charValue >= 97 && *charValue <= 122){
-			return 1;
-		}else{
-			unsigned char value = (unsigned char)(*charValue);
-			// e9 = e(acute), e0 = a(grave), e8 = e(grave), f9 = u(grave)
-			// e2 = a(circumflex), ea = e(circumflex), ee = i(circumflex), f4 = o(circumflex)
-			// fb = u(circumflex), eb = e(diaresis), ec = i(diaresis),  fc = u(diaresis)
-			// ff = y(diaresis),  e7 = cedilla
-			if(value == 0xe9 || value == 0xe0 || value == 0xe8 || value == 0xf9 ||
-				value == 0xe2 || value == 0xea || value == 0xee || value == 0xf4 ||
-				value == 0xfb || value == 0xeb || value == 0xec || value == 0xfc ||
-				value == 0xff || value == 0xe7){
-				return 1;
-			}else{
-				return 0;
-			}
-		}
+		return (int)numberOfBytes;
 	}else if(encoding == UTF8_BINARY){
-		if(*charValue >= 97 && *charValue <= 122){
-			return 1;
-		}else{
-			// 233 = e(acute),  224 = a(grave), 232 = e(grave), 249 = u(grave)
-			// 226 = a(circumflex), 234 = e(circumflex), 238 = i(circumflex),  244 = o(circumflex)
-			// 251 = u(circumflex), 235 = e(diaresis), 239 = i(diaresis), 252 = u(diaresis)
-			// 255 = y(diaresis), 231 cedilla lower
-			int frenchCodePointList[14] = {
-					233,224,232,249,226,234,238,244,
-					251,235,239,252,255,231
-			};
-			return isUTF8BinaryCharacterInUTFSet(charValue, frenchCodePointList, 14);
-		}
+		return _lenUTF8BinaryBounded(buffer, numberOfBytes);
+	}else if(encoding == UTF16){
+		return _lenUTF16Bounded(buffer, numberOfBytes);
 	}else{
+		return -1;
+	}
+}
+
+/**
+ * A C-style string length that handles different encodings found
+ * in the wild. It analyzes the bytes in a char * and returns the
+ * string length irrespective of the encoding.
+ * @param buffer: The buffer that contains the string
+ * @param encoding: The encoding used to find the byte length, and the lenModes flags
+ */
+static int len(const char * buffer, int encoding){
+
+	// Handle an incorrectly structured buffer
+	if(buffer == NULL){
 		return 0;
 	}
+	return lenBounded(buffer, _getStringByteLength(buffer, encoding & ~LEN_GRAPHEME_CLUSTERS), encoding);
 }
 
+
 /**
- * Check if a character is lower case in an alphabet for different languages
- * and encodings
- * @param charValue The character to check
- * @param encoding The encoding of the character
- * @param language The language of the character
+ * The most bytes of the control and end strings of an escapeScheme
+ */
+#define ESCAPE_SCHEME_MAX_STRING 16
+
+/**
+ * The bytes of utf8 plain text that lenEscapedCompiled finds the next control
+ * string in before counting them, so that a long run of plain text is read
+ * from the cache the second time
  */
-static int isLowerCaseInAlphabet(const char * charValue, int encoding, int language){
-	if(language == ENGLISH){
-		return isLowerCaseEnglish(charValue, encoding);
-	}else if(language == SPANISH){
-		return isLowerCaseSpanish(charValue, encoding);
-	}else if(language == FRENCH){
-		return isLowerCaseFrench(charValue, encoding);
-	}else{
-		return 0;
-	}
-}
+#define ESCAPE_SCHEME_BLOCK_SIZE 16384
 
 /**
- * Check if a character is part of the alphabet of different languages.
- * Different languages have added characters that go beyond the standard
- * ASCII characters.
- * @param charValue The character to check
- * @param encoding The encoding of the character
- * @param language The language of the character
- * @returns {0= false, 1 = true}
+ * The escaped sequences of lenEscaped compiled once for any number of
+ * strings. The control string is matched by a DFA over the classes of its
+ * bytes, so a control string that starts again inside a failed match is still
+ * found, and the plain text up to the first byte of a control string is
+ * skipped with memchr. The control and end strings are ascii, which lets the
+ * base encoding be utf8 as well.
  */
-static int isInAlphabet(const char * charValue, int encoding, int language){
-	// The ascii character set is limited. Make sure that irrespective of the language
-	// that the character value has the romance core without the diacritical marks.
-	if(isInRomanceAlphabet(charValue, encoding)){
-		return 1;
-	}else{
-		// Each language has its own diacritical marks that are formally part
-		// of the ortography of the language. For now, only romance languages
-		// have been addresed.
-		if(language == ENGLISH){
-			return 0;					// Imported words are ignored.
-		}else if(language == SPANISH){
-			return isSpanishExtendedCharacter(charValue, encoding);
-		}else if(language == FRENCH){
-			return isFrenchExtendedCharacter(charValue, encoding);
-		}else{
-			return 0;
-		}
-	}
-}
+typedef struct{
+	int sequenceEncoding;											// The escapedEncodings value of the sequences
+	int controlLength;												// The bytes of the control string, 0 when it did not compile
+	int endLength;													// The bytes of the end string, 0 for none
+	char controlString[ESCAPE_SCHEME_MAX_STRING];					// The control string
+	char endString[ESCAPE_SCHEME_MAX_STRING];						// The end string
+	unsigned char byteClasses[128];									// The class of each ascii byte, 0 for none of the control string
+	unsigned char transitions[ESCAPE_SCHEME_MAX_STRING][ESCAPE_SCHEME_MAX_STRING + 1];	// The control bytes matched after a class
+} escapeScheme;
 
 /**
- * Check if a sequence of characters conforms to different character
- * checks
- * @param func The function used to check
- * @param charSequence The string to check
- * @param encoding The encoding of the character
- * @param language The language of the characters
- * @returns {0 = false, 1 = true}
+ * Compile the escaped sequences of lenEscaped. See lenEscaped for the format
+ * of the escaped sequences.
+ * @param scheme The scheme to compile
+ * @param controlString The control string, up to ESCAPE_SCHEME_MAX_STRING ascii bytes
+ * @param sequenceEncoding The encoding of the sequence
+ * @param endString The end string, up to ESCAPE_SCHEME_MAX_STRING ascii bytes, or NULL
+ * @returns {0 = an empty, long or non ascii control or end string or an unknown sequence encoding, 1 = compiled}
  */
-static int _isLanguageSequenceOf(int (*func)(const char *, int, int), const char * charSequence, int encoding, int language){
+static int compileEscapeScheme(escapeScheme * scheme, const char * controlString, int sequenceEncoding,
+		const char * endString){
+	unsigned char classBytes[ESCAPE_SCHEME_MAX_STRING + 1];
+	int numberOfClasses = 0;
+	int state;
 	int r;
-	const char * characterPointer = charSequence;
-	while(*characterPointer != '\0'){
-		int strideLength = getCharacterStrideLength(charSequence, encoding);
-		if(func(characterPointer, encoding, language) == 0){
+	memset(scheme, 0, sizeof(escapeScheme));
+	if(controlString == NULL || (sequenceEncoding != ASCII_HEX_UTF_ESCAPE && sequenceEncoding != ASCII_DECIMAL_UTF_ESCAPE)){
+		return 0;
+	}
+	for(r = 0; controlString[r] != '\0'; r++){
+		if(r == ESCAPE_SCHEME_MAX_STRING || (unsigned char)controlString[r] >= 0x80){
 			return 0;
 		}
-		for(r = 0; r < strideLength; r++){
-			characterPointer++;
+		scheme->controlString[r] = controlString[r];
+	}
+	for(scheme->endLength = 0; endString != NULL && endString[scheme->endLength] != '\0'; scheme->endLength++){
+		if(scheme->endLength == ESCAPE_SCHEME_MAX_STRING || (unsigned char)endString[scheme->endLength] >= 0x80){
+			scheme->endLength = 0;
+			return 0;
+		}
+		scheme->endString[scheme->endLength] = endString[scheme->endLength];
+	}
+	if(r == 0){
+		return 0;
+	}
+	for(state = 0; state < r; state++){
+		unsigned char byte = (unsigned char)controlString[state];
+		if(scheme->byteClasses[byte] == 0){
+			scheme->byteClasses[byte] = (unsigned char)++numberOfClasses;
+			classBytes[numberOfClasses] = byte;
 		}
 	}
+	// The state after a byte is the longest prefix of the control string
+	// that ends the bytes matched so far and the byte
+	for(state = 0; state < r; state++){
+		int byteClass;
+		for(byteClass = 1; byteClass <= numberOfClasses; byteClass++){
+			int next = state + 1;
+			while(next > 0 && (controlString[next - 1] != (char)classBytes[byteClass] ||
+					memcmp(controlString, controlString + state + 1 - next, next - 1) != 0)){
+				next--;
+			}
+			scheme->transitions[state][byteClass] = (unsigned char)next;
+		}
+	}
+	scheme->sequenceEncoding = sequenceEncoding;
+	scheme->controlLength = r;
 	return 1;
 }
 
 /**
- * Check if a character or sequence of character conforms to different
- * character checks but with an offset
- * @param func The function used to check
- * @param charSequence The string to check
- * @param encoding The encoding of the character
- * @param language The language of the characters
- * @param index The index of the character
- * @returns {0 = false, 1 = true}
+ * A resumable string length counter. The text is fed in chunks of any size
+ * with lenCounterUpdate, and a utf8 character or an escaped sequence that is
+ * split between two chunks is carried over to the next chunk, so nothing has
+ * to be buffered.
  */
-static int isLanguageSequenceAtIndex(int (*func)(const char *, int, int), const char * charSequence, int encoding, int language,
-		int index){
-	int r;
-	if(index < 0){
-		return 0;
-	}
-	const char * characterPointer = charSequence;
-	for(r = 0; r < index; r++){
-		characterPointer++;
-	}
-	return _isLanguageSequenceOf(func, charSequence, encoding, language);
-}
+typedef struct{
+	int encoding;					// The base encoding of the text
+	int length;						// The characters counted so far, or -1 after an error
+	unsigned int decoderState;		// The utf8 decoder state of a character split between chunks
+	unsigned int codePoint;			// The code point decoded so far
+	int escaped;					// 1 when the text has escaped sequences
+	const escapeScheme * scheme;	// The scheme of lenCounterInitCompiled, or NULL for compiledScheme
+	escapeScheme compiledScheme;	// The scheme of lenCounterInitEscaped
+	int escapedState;				// The encodedParsedStringStates state of the escaped sequences
+	int matched;					// The bytes of the control or end string matched so far
+	int digits;						// The digits of the escaped code point parsed so far
+} lenCounter;
 
 /**
- * A function that checks if an entire sequence is part of different languages
- * @param charSequence The character sequence to check
- * @param encoding The encoding of the character
- * @param language The language of the character
- * @returns {0=false, 1=true}
+ * Start counting the length of a string in a base encoding
+ * @param counter The counter to initialize
+ * @param encoding The encoding of the string
  */
-static int isInAlphabetSequence(const char * charSequence, int encoding, int language){
-	return _isLanguageSequenceOf(isInAlphabet, charSequence, encoding, language);
+static void lenCounterInit(lenCounter * counter, int encoding){
+	memset(counter, 0, sizeof(lenCounter));
+	counter->encoding = encoding;
+	counter->decoderState = UTF8_DECODER_ACCEPT;
+	counter->escapedState = ENCODED_PARSE_STRING_START;
+	if(encoding != ASCII && encoding != ISO_8859_1 && encoding != UTF8_BINARY){
+		counter->length = -1;
+	}
 }
 
 /**
- * A function that checks if an entire sequence is part of the punctuation of a language
- * @param charSequence The character sequence to check
- * @param encoding The encoding of the character
- * @param language The language of the character
- * @returns {0=false, 1=true}
+ * Start counting the length of a string with escaped sequences compiled by
+ * compileEscapeScheme. The scheme is not copied and must outlive the counter.
+ * @param counter The counter to initialize
+ * @param baseEncoding The base encoding of the string, ASCII, ISO_8859_1 or UTF8_BINARY
+ * @param scheme The compiled scheme, or NULL for a string without escaped sequences
  */
-static int isPunctuationMarkInAlphabetSequence(const char * charSequence, int encoding, int language){
-	return _isLanguageSequenceOf(isPunctuationMarkInAlphabet, charSequence, encoding, language);
+static void lenCounterInitCompiled(lenCounter * counter, int baseEncoding, const escapeScheme * scheme){
+	lenCounterInit(counter, baseEncoding);
+	if(scheme != NULL){
+		counter->escaped = 1;
+		counter->scheme = scheme;
+		if(scheme->controlLength == 0){
+			counter->length = -1;
+		}
+	}
 }
 
 /**
- * A function that checks if an entire sequence is part of the uppercase letters of an alphabet
- * @param charSequence The character sequence to check
- * @param encoding The encoding of the character
- * @param language The language of the character
- * @returns {0=false, 1=true}
+ * Start counting the length of an escaped string. See lenEscaped for the
+ * format of the escaped sequences. The control and end strings are compiled
+ * into the counter, see compileEscapeScheme.
+ * @param counter The counter to initialize
+ * @param baseEncoding The base encoding of the string, ASCII, ISO_8859_1 or UTF8_BINARY
+ * @param controlString The control string in the base encoding, or NULL for a string without escaped sequences
+ * @param sequenceEncoding The encoding of the sequence
+ * @param endString The end string of the sequence
  */
-static int isUpperCaseInAlphabetSequence(const char * charSequence, int encoding, int language){
-	return _isLanguageSequenceOf(isUpperCaseInAlphabet, charSequence, encoding, language);
+static void lenCounterInitEscaped(lenCounter * counter, int baseEncoding, const char * controlString,
+		int sequenceEncoding, const char * endString){
+	lenCounterInit(counter, baseEncoding);
+	if(controlString != NULL){
+		counter->escaped = 1;
+		if(!compileEscapeScheme(&counter->compiledScheme, controlString, sequenceEncoding, endString)){
+			counter->length = -1;
+		}
+	}
 }
 
 /**
- * A function that checks if an entire sequence is part of the lowercase letters of an alphabet
- * @param charSequence The character sequence to check
- * @param encoding The encoding of the character
- * @param language The language of the character
- * @returns {0=false, 1=true}
+ * Count a chunk of utf8. The character split by the last chunk is finished
+ * with the decoder, the whole characters are counted by the bulk kernels and
+ * a character cut off by the end of the chunk is kept in the decoder state.
+ * @param counter The counter
+ * @param buffer The chunk
+ * @param numberOfBytes The number of bytes in the chunk
  */
-static int isLowerCaseInAlphabetSequence(const char * charSequence, int encoding, int language){
-	return _isLanguageSequenceOf(isLowerCaseInAlphabet, charSequence, encoding, language);
+static void _lenCounterUpdateUTF8(lenCounter * counter, const char * buffer, size_t numberOfBytes){
+	size_t index = 0;
+	while(counter->decoderState != UTF8_DECODER_ACCEPT && index < numberOfBytes){
+		decodeUTF8Byte(&counter->decoderState, &counter->codePoint, (unsigned char)buffer[index++]);
+		if(counter->decoderState == UTF8_DECODER_REJECT){
+			counter->length = -1;
+			return;
+		}else if(counter->decoderState == UTF8_DECODER_ACCEPT){
+			counter->length += (counter->codePoint < 0x10000) & !isDiacriticalMark((int)counter->codePoint);
+		}
+	}
+
+	size_t end = index + _utf8CharacterStart(buffer + index, numberOfBytes - index);
+	int bulkLength = _lenUTF8BinaryBounded(buffer + index, end - index);
+	if(bulkLength < 0){
+		counter->length = -1;
+		return;
+	}
+	counter->length += bulkLength;
+
+	for(index = end; index < numberOfBytes; index++){
+		decodeUTF8Byte(&counter->decoderState, &counter->codePoint, (unsigned char)buffer[index]);
+		if(counter->decoderState == UTF8_DECODER_REJECT){
+			counter->length = -1;
+			return;
+		}
+	}
 }
 
 /**
- * Convert character encoding to a number. At the moment, encoding is ignored
- * @param charValue The character to convert
- * @returns {0-9}
+ * Count a run of plain text of an escaped string. A utf8 run is counted by
+ * the bulk kernels a block at a time.
+ * @param counter The counter
+ * @param buffer The run
+ * @param numberOfBytes The number of bytes in the run
  */
-static int convertToNumber(const char *charValue, int encoding){
-	return *charValue - 48;
+static void _lenCounterUpdatePlain(lenCounter * counter, const char * buffer, size_t numberOfBytes){
+	if(counter->encoding == UTF8_BINARY){
+		_lenCounterUpdateUTF8(counter, buffer, numberOfBytes);
+	}else{
+		counter->length += (int)numberOfBytes;
+	}
 }
 
 /**
- * Convert hex character into binary in a certain encoding
- * @param hexValue The hex value
- * @param encoding The encoding of the hexValue
+ * Count a chunk of an escaped string with its compiled scheme. The plain
+ * text between the sequences is skipped with memchr and counted in bulk,
+ * and the control strings are matched with the DFA of the scheme.
+ * @param counter The counter
+ * @param buffer The chunk
+ * @param numberOfBytes The number of bytes in the chunk
  */
-static char convertHex(const char * hexValue, int encoding){
-	if(encoding == UTF8_BINARY || encoding == ASCII || encoding == ISO_8859_1){
-		// Handle 0-9
-		if(*hexValue >= 48 && *hexValue <= 57){
-			return *hexValue - 48;
-		}
-
-		// Handle A-F
-		if(*hexValue >= 65 && *hexValue <= 70){
-			return *hexValue - 55; // ([70,65] - 10)
-		}
-
-		// Handle a-f
-		if(*hexValue >= 97 && *hexValue <= 102){
-			return *hexValue - 87; // ([102, 97] - 10)
+static void _lenCounterUpdateEscaped(lenCounter * counter, const char * buffer, size_t numberOfBytes){
+	const escapeScheme * scheme = counter->scheme != NULL ? counter->scheme : &counter->compiledScheme;
+	const char * characterPointer = buffer;				// A pointer to the correct position in the buffer
+	const char * bufferEnd = buffer + numberOfBytes;	// The end of the buffer
+	while(characterPointer < bufferEnd && counter->length >= 0){
+		if(counter->escapedState == ENCODED_PARSE_STRING_START){
+			const char * blockEnd = bufferEnd;
+			if(counter->encoding == UTF8_BINARY && (size_t)(bufferEnd - characterPointer) > ESCAPE_SCHEME_BLOCK_SIZE){
+				blockEnd = characterPointer + ESCAPE_SCHEME_BLOCK_SIZE;
+			}
+			const char * control = (const char *)memchr(characterPointer, scheme->controlString[0],
+					blockEnd - characterPointer);
+			if(control == NULL){
+				_lenCounterUpdatePlain(counter, characterPointer, blockEnd - characterPointer);
+				characterPointer = blockEnd;
+				continue;
+			}
+			_lenCounterUpdatePlain(counter, characterPointer, control - characterPointer);
+			if(counter->decoderState != UTF8_DECODER_ACCEPT){
+				// An ascii byte in the middle of a utf8 character
+				counter->length = -1;
+				return;
+			}
+			characterPointer = control;
+			counter->escapedState = ENCODED_PARSE_STRING_CONTROL;
+			counter->matched = 0;
+		}else if(counter->escapedState == ENCODED_PARSE_STRING_CONTROL){
+			unsigned char byte = (unsigned char)*characterPointer;
+			if(byte >= 0x80){
+				// Not a control string after all, the matched part is plain text
+				counter->length += counter->matched;
+				counter->escapedState = ENCODED_PARSE_STRING_START;
+				continue;
+			}
+			// The bytes that no longer start a control string are plain text
+			int next = scheme->transitions[counter->matched][scheme->byteClasses[byte]];
+			counter->length += counter->matched + 1 - next;
+			counter->matched = next;
+			characterPointer++;
+			if(next == 0){
+				counter->escapedState = ENCODED_PARSE_STRING_START;
+			}else if(next == scheme->controlLength){
+				counter->escapedState = ENCODED_PARSE_STRING_CODE_POINT;
+				counter->codePoint = 0;
+				counter->digits = 0;
+			}
+		}else if(counter->escapedState == ENCODED_PARSE_STRING_CODE_POINT){
+			if(scheme->sequenceEncoding == ASCII_HEX_UTF_ESCAPE){
+				char convertedHex = convertHex(characterPointer, ASCII);
+				if(convertedHex == -1){
+					counter->length = -1;
+					return;
+				}
+				counter->codePoint = (counter->codePoint << 4) + convertedHex;
+				counter->digits++;
+				characterPointer++;
+				if(counter->digits < 4){
+					continue;
+				}
+			}else if(isNumber(characterPointer, ASCII)){
+				// Consume all of the numbers until we reach a character that
+				// is not a number
+				counter->codePoint = counter->codePoint * 10 + convertToNumber(characterPointer, ASCII);
+				counter->digits++;
+				characterPointer++;
+				continue;
+			}else if(counter->digits == 0){
+				// A control string that no number follows is plain text
+				counter->length += scheme->controlLength;
+				counter->escapedState = ENCODED_PARSE_STRING_START;
+				continue;
+			}
+			counter->length += !isDiacriticalMark((int)counter->codePoint);
+			counter->escapedState = scheme->endLength == 0 ? ENCODED_PARSE_STRING_START : ENCODED_PARSE_STRING_END_STRING;
+			counter->matched = 0;
+		}else if(counter->escapedState == ENCODED_PARSE_STRING_END_STRING){
+			if(counter->matched < scheme->endLength && scheme->endString[counter->matched] == *characterPointer){
+				counter->matched++;
+				characterPointer++;
+			}else{
+				counter->escapedState = ENCODED_PARSE_STRING_START;
+			}
 		}
-		return -1;
-	}else{
-		return -1;
 	}
 }
 
 /**
- * A C-style string length that handles different encodings found
- * in the wild. It analyzes the bytes in a char * and returns the
- * string length irrespective of the encoding.
- * @param buffer: The buffer that contains the string
- * @param encoding: The encoding used to find the byte length
+ * Count the next chunk of a string
+ * @param counter The counter
+ * @param buffer The chunk
+ * @param numberOfBytes The number of bytes in the chunk
+ * @returns {The characters counted so far, or -1 for an error}
  */
-static int len(const char * buffer, int encoding){
-
-	// Handle an incorrectly structured buffer
+static int lenCounterUpdate(lenCounter * counter, const char * buffer, size_t numberOfBytes){
+	if(counter->length < 0 || numberOfBytes == 0){
+		return counter->length;
+	}
 	if(buffer == NULL){
-		return 0;
+		counter->length = -1;
+	}else if(counter->escaped){
+		_lenCounterUpdateEscaped(counter, buffer, numberOfBytes);
+	}else if(counter->encoding == UTF8_BINARY){
+		_lenCounterUpdateUTF8(counter, buffer, numberOfBytes);
+	}else if(counter->encoding == ASCII || counter->encoding == ISO_8859_1){
+		counter->length += (int)numberOfBytes;
+	}else{
+		// The counter does not carry utf16 code units between chunks
+		counter->length = -1;
 	}
+	return counter->length;
+}
 
-	// Deal with the simple ASCII/LATIN cases
-	if(encoding == ASCII){
-		return strlen(buffer);
-	}else if(encoding == ISO_8859_1){
-		return strlen(buffer);
-	}else if(encoding == UTF8_BINARY){
-		return _lenUTF8Binary(buffer);
-	}else{
+/**
+ * Finish counting a string. A utf8 character or a hex escaped sequence that
+ * is cut off by the end of the string is an error, and a control string that
+ * is cut off is plain text.
+ * @param counter The counter
+ * @returns {The length of the string, or -1 for an error}
+ */
+static int lenCounterFinish(lenCounter * counter){
+	if(counter->length < 0){
 		return -1;
 	}
+	if(counter->escaped){
+		const escapeScheme * scheme = counter->scheme != NULL ? counter->scheme : &counter->compiledScheme;
+		if(counter->escapedState == ENCODED_PARSE_STRING_CONTROL){
+			counter->length += counter->matched;
+		}else if(counter->escapedState == ENCODED_PARSE_STRING_CODE_POINT){
+			if(counter->digits == 0){
+				// A control string at the end is plain text
+				counter->length += scheme->controlLength;
+			}else if(scheme->sequenceEncoding == ASCII_HEX_UTF_ESCAPE){
+				counter->length = -1;
+			}else{
+				counter->length += !isDiacriticalMark((int)counter->codePoint);
+			}
+		}
+		counter->escapedState = ENCODED_PARSE_STRING_END;
+	}
+	if(counter->decoderState != UTF8_DECODER_ACCEPT){
+		counter->length = -1;
+	}
+	return counter->length;
 }
 
+/**
+ * Return the length of a bounded escaped buffer. See lenEscaped for the format
+ * of the escaped sequences. The control and end strings are NUL terminated.
+ * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param baseEncoding The base encoding of the string
+ * @param controlString The control string in the base encoding
+ * @param sequenceEncoding The encoding of the sequence
+ * @param endString The end string of the sequence
+ */
+static int lenEscapedBounded(const char * buffer, size_t numberOfBytes, int baseEncoding,
+		const char * controlString, int sequenceEncoding, const char * endString){
+	// Handle the incorrectly structured buffer
+	if(buffer == NULL){
+		return -1;
+	}
+	lenCounter counter;
+	lenCounterInitEscaped(&counter, baseEncoding, controlString, sequenceEncoding, endString);
+	lenCounterUpdate(&counter, buffer, numberOfBytes);
+	return lenCounterFinish(&counter);
+}
 
 /**
  * Return the UTF8 binary string length. The format of these escaped sequences are
- * the following. At the moment, only ASCII escaping and certain ascii escape signatures
- * are allowed
+ * the following. The base encoding is ASCII, ISO_8859_1 or UTF8_BINARY, and the
+ * control and end strings are ascii, see compileEscapeScheme
  * {char in base encoding}{char * controlString in base encoding}[sequence length in sequencEncoding]{endString in base encoding}
  * e.g Happy \u0069 Mildew
  * 	buffer="Happy \u0069 Mildew\0"
@@ -1323,124 +4808,171 @@ static int lenEscaped(const char * buffer, int baseEncoding, const char * contro
 	if(buffer == NULL){
 		return -1;
 	}
+	return lenEscapedBounded(buffer, strlen(buffer), baseEncoding, controlString, sequenceEncoding, endString);
+}
 
-	// Check that the base encoding is correct
-	if(baseEncoding != ASCII){
+/**
+ * Return the length of a bounded escaped buffer with a scheme compiled by
+ * compileEscapeScheme, for the strings that share their escaped sequences.
+ * See lenEscaped for the format of the escaped sequences.
+ * @param buffer The buffer that contains the string
+ * @param numberOfBytes The number of bytes in the buffer
+ * @param baseEncoding The base encoding of the string, ASCII, ISO_8859_1 or UTF8_BINARY
+ * @param scheme The compiled scheme
+ * @returns {The length of the string, or -1 for an error}
+ */
+static int lenEscapedCompiled(const char * buffer, size_t numberOfBytes, int baseEncoding, const escapeScheme * scheme){
+	// Handle the incorrectly structured buffer
+	if(buffer == NULL || scheme == NULL){
 		return -1;
 	}
+	lenCounter counter;
+	lenCounterInitCompiled(&counter, baseEncoding, scheme);
+	lenCounterUpdate(&counter, buffer, numberOfBytes);
+	return lenCounterFinish(&counter);
+}
 
-	// If we have no control string return the length of the unescaped buffer
-	if(controlString == NULL){
-		return len(buffer, baseEncoding);
+/**
+ * Parse the code point of an escaped sequence that follows its control string,
+ * and the end string after it when there is one
+ * @param data The text after the control string
+ * @param numberOfBytes The number of bytes of text
+ * @param scheme The compiled scheme of the sequence
+ * @param codePoint Set to the code point
+ * @returns {The bytes of the code point and the end string, 0 when no digit follows the control string, or -1 for a malformed hex code point}
+ */
+static int _parseEscapedCodePoint(const char * data, size_t numberOfBytes, const escapeScheme * scheme, int * codePoint){
+	int length = 0;
+	*codePoint = 0;
+	if(scheme->sequenceEncoding == ASCII_HEX_UTF_ESCAPE){
+		if(numberOfBytes == 0){
+			return 0;
+		}
+		for(length = 0; length < 4; length++){
+			char convertedHex = (size_t)length < numberOfBytes ? convertHex(data + length, ASCII) : (char)-1;
+			if(convertedHex == -1){
+				return -1;
+			}
+			*codePoint = (*codePoint << 4) + convertedHex;
+		}
+	}else{
+		while((size_t)length < numberOfBytes && isNumber(data + length, ASCII)){
+			// Past the last code point the value no longer matters
+			if(*codePoint <= 0x10ffff){
+				*codePoint = *codePoint * 10 + convertToNumber(data + length, ASCII);
+			}
+			length++;
+		}
+		if(length == 0){
+			return 0;
+		}
+	}
+	if(scheme->endLength > 0 && numberOfBytes - length >= (size_t)scheme->endLength &&
+			memcmp(data + length, scheme->endString, scheme->endLength) == 0){
+		length += scheme->endLength;
 	}
+	return length;
+}
 
-	// Check that the sequence encoding is correct
-	if(sequenceEncoding != ASCII_HEX_UTF_ESCAPE && sequenceEncoding != ASCII_DECIMAL_UTF_ESCAPE){
+/**
+ * Decode the escaped sequences of utf8 text into utf8 in a buffer owned by the
+ * caller. See lenEscaped for the format of the escaped sequences. The plain
+ * text is found with memchr and the control string DFA of the scheme as in
+ * lenEscapedCompiled, and is copied a run at a time. A pair of escaped utf16
+ * surrogates decodes to one character. Only whole characters that fit are
+ * written and the full size is always returned, so a NULL buffer asks for
+ * the size. No sequence is shorter than its utf8, so the buffer can be the
+ * text itself. A control string that no digit follows is plain text, and the
+ * end string is only taken when all of it follows the code point.
+ * @param buffer The buffer that receives the utf8, or NULL
+ * @param bufferCapacity The number of bytes in the buffer
+ * @param data The escaped utf8 text
+ * @param numberOfBytes The number of bytes of text
+ * @param scheme The scheme compiled by compileEscapeScheme
+ * @param errorOffset Set to the offset of the first malformed character or
+ * escaped sequence, or to numberOfBytes when the text is valid. May be NULL.
+ * @returns {The number of bytes of the decoded utf8, or -1 for malformed utf8, a malformed sequence, an unpaired surrogate and a scheme that did not compile}
+ */
+static long long unescapeUTF8Into(char * buffer, size_t bufferCapacity, const char * data, size_t numberOfBytes,
+		const escapeScheme * scheme, size_t * errorOffset){
+	size_t index = 0;
+	size_t decodedBytes = 0;
+	if(scheme == NULL || scheme->controlLength == 0){
 		return -1;
 	}
-
-	int index = 0;
-	int escapedState = ENCODED_PARSE_STRING_START;
-	int controlCount = 0;								// The control string count
-	int lenEscapedCount = 0;							// Return the length of the escaped count
-	const char * controlPointer = controlString;		// Setup a pointer to the control string.
-	const char * characterPointer = buffer;				// A pointer to the correct position in the buffer
-	while(*characterPointer != '\0'){
-		if(escapedState == ENCODED_PARSE_STRING_START){
-			if(*controlPointer == *characterPointer){
-				escapedState = ENCODED_PARSE_STRING_CONTROL;
-				continue;
-			}else{
-				lenEscapedCount = lenEscapedCount + 1;
-			}
-		// Make sure that the entirety of the control string has been captured
-		}else if(escapedState == ENCODED_PARSE_STRING_CONTROL){
-
-			// We have reached the E
-			if(*controlPointer == '\0'){
-				controlPointer = controlString;
-				controlCount = 0;
-				escapedState = ENCODED_PARSE_STRING_CODE_POINT;
-				continue;
-			}
-			if(*controlPointer != *characterPointer){
-				controlPointer = controlString;
-				escapedState = ENCODED_PARSE_STRING_START;
-				lenEscapedCount += controlCount;
-				controlCount=0;
-				continue;
+	// The sequences are ascii, so checking the whole text checks the plain text
+	if(!validateUTF8(data, numberOfBytes, errorOffset)){
+		return -1;
+	}
+	if(data == NULL){
+		numberOfBytes = 0;
+	}
+	if(buffer == NULL){
+		bufferCapacity = 0;
+	}
+	while(index < numberOfBytes){
+		const char * control = (const char *)memchr(data + index, scheme->controlString[0], numberOfBytes - index);
+		size_t runEnd = control != NULL ? (size_t)(control - data) : numberOfBytes;
+		_appendUTF8Bytes(buffer, &bufferCapacity, &decodedBytes, data + index, runEnd - index);
+		index = runEnd;
+		// Match the control string, the bytes that no longer start it are
+		// plain ascii
+		int matched = 0;
+		while(index < numberOfBytes && (unsigned char)data[index] < 0x80){
+			int next = scheme->transitions[matched][scheme->byteClasses[(unsigned char)data[index]]];
+			_appendUTF8Bytes(buffer, &bufferCapacity, &decodedBytes, data + index - matched, matched + 1 - next);
+			matched = next;
+			index++;
+			if(next == 0 || next == scheme->controlLength){
+				break;
 			}
-			controlPointer++;
-			controlCount++;
-
-		}else if(escapedState == ENCODED_PARSE_STRING_CODE_POINT){
-			if(sequenceEncoding == ASCII_HEX_UTF_ESCAPE){
-				int codePoint = 0;
-				for(;index < 4; index++){
-					if(*characterPointer == '\0'){
-						return -1;
-					}
-					char convertedHex = convertHex(characterPointer, ASCII);
-					if(convertedHex == -1){
-						return -1;
-					}
-
-					codePoint += convertedHex;
-					codePoint <<= 4;
-					characterPointer++;
-				}
-				if(!isDiacriticalMark(codePoint)){
-					lenEscapedCount++;
-				}
-
-			}else{
-				int codePoint = 0;
-
-				// Consume all of the numbers until we reach a character that
-				// is not a number
-				while(1){
-					if(*characterPointer == '\0'){
-						break;
-					}
-					if(isNumber(characterPointer, ASCII)){
-						codePoint *= 10;
-						codePoint += convertToNumber(characterPointer, ASCII);
-						characterPointer++;
-					}else{
-						break;
-					}
-
-				}
-				if(!isDiacriticalMark(codePoint)){
-					lenEscapedCount++;
+		}
+		if(matched < scheme->controlLength){
+			_appendUTF8Bytes(buffer, &bufferCapacity, &decodedBytes, data + index - matched, matched);
+			continue;
+		}
+		size_t sequenceStart = index - matched;
+		int codePoint;
+		int length = _parseEscapedCodePoint(data + index, numberOfBytes - index, scheme, &codePoint);
+		if(length == 0){
+			_appendUTF8Bytes(buffer, &bufferCapacity, &decodedBytes, data + sequenceStart, matched);
+			continue;
+		}
+		if(length > 0){
+			index += length;
+			if(codePoint >= 0xd800 && codePoint <= 0xdbff){
+				// A high surrogate is only valid with an escaped low surrogate after it
+				int lowSurrogate = -1;
+				if(numberOfBytes - index > (size_t)scheme->controlLength &&
+						memcmp(data + index, scheme->controlString, scheme->controlLength) == 0){
+					length = _parseEscapedCodePoint(data + index + scheme->controlLength,
+							numberOfBytes - index - scheme->controlLength, scheme, &lowSurrogate);
 				}
-
-				if(*characterPointer == '\0'){
-					break;
+				if(lowSurrogate >= 0xdc00 && lowSurrogate <= 0xdfff && length > 0){
+					codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+					index += scheme->controlLength + length;
 				}
 			}
-			// Dependent on whether the end string is null continue to
-			// the start state
-			if(endString == NULL){
-				escapedState = ENCODED_PARSE_STRING_START;
-				continue;
-			}else{
-				escapedState = ENCODED_PARSE_STRING_END_STRING;
-				continue;
-			}
-
-		}else if(escapedState == ENCODED_PARSE_STRING_END_STRING){
-			const char * endStringPointer = endString;
-			while(*characterPointer == *endStringPointer){
-				characterPointer++;
-				endStringPointer++;
+		}
+		int characterLength = _getCodePointUTF8Length(codePoint);
+		if(length < 0 || characterLength == -1){
+			if(errorOffset != NULL){
+				*errorOffset = sequenceStart;
 			}
-			escapedState = ENCODED_PARSE_STRING_START;
-			continue;
+			return -1;
 		}
-		characterPointer++;
+		if(decodedBytes + characterLength <= bufferCapacity){
+			_encodeUTF8Character(buffer + decodedBytes, codePoint, characterLength);
+		}else{
+			// Keep what is written a prefix of the decoded text
+			bufferCapacity = 0;
+		}
+		decodedBytes += characterLength;
+	}
+	if(errorOffset != NULL){
+		*errorOffset = numberOfBytes;
 	}
-	return lenEscapedCount;
+	return (long long)decodedBytes;
 }
 #ifdef __cplusplus
 }
@@ -0,0 +1,241 @@
+//Copyright 2014 by Daniel Ortiz
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+
+#ifndef __LANGUAGE_STRINGUTILS_HPP__
+#define __LANGUAGE_STRINGUTILS_HPP__
+
+#include "stringUtils.h"
+
+/**
+ * The C++ interface to the sequence checks of stringUtils.h. The encoding,
+ * the language and the predicate are template arguments, so every
+ * combination is its own loop with the table lookups inlined and no branch
+ * on the encoding or the language per character.
+ */
+namespace language{
+
+/**
+ * The classes of the character at the start of a buffer in an encoding and
+ * a language. decode returns the number of bytes of the character, or -1 for
+ * a malformed or cut off character.
+ */
+template<int Encoding, int Language> struct CharacterClassesOf;
+
+template<int Language> struct CharacterClassesOf<ASCII, Language>{
+	static inline int decode(const char * charValue, size_t, int * classes){
+		*classes = singleByteCharacterClasses[0][Language][(unsigned char)*charValue];
+		return 1;
+	}
+};
+
+template<int Language> struct CharacterClassesOf<ISO_8859_1, Language>{
+	static inline int decode(const char * charValue, size_t, int * classes){
+		*classes = singleByteCharacterClasses[1][Language][(unsigned char)*charValue];
+		return 1;
+	}
+};
+
+template<int Language> struct CharacterClassesOf<UTF8_BINARY, Language>{
+	static inline int decode(const char * charValue, size_t numberOfBytes, int * classes){
+		int codePoint = (unsigned char)*charValue;
+		int length = 1;
+		if(codePoint >= 0x80){
+			length = decodeUTF8Character(charValue, numberOfBytes, &codePoint);
+			if(length == -1){
+				return -1;
+			}
+		}
+		// Every character that decodes is a valid character
+		*classes = getUnicodeCharacterClasses(codePoint, Language) | CHARACTER_CLASS_VALID;
+		return length;
+	}
+};
+
+template<int Language> struct CharacterClassesOf<UTF16, Language>{
+	static inline int decode(const char * charValue, size_t numberOfBytes, int * classes){
+		int codePoint;
+		int length = decodeUTF16Character(charValue, numberOfBytes, &codePoint);
+		if(length == -1){
+			return -1;
+		}
+		*classes = getUnicodeCharacterClasses(codePoint, Language) | CHARACTER_CLASS_VALID;
+		return length;
+	}
+};
+
+/**
+ * A predicate on the characterClasses bits of a character. Each predicate
+ * also names the C sequence check it stands for, which handles the
+ * encodings and languages that have no instantiation.
+ */
+template<int CharacterClass> struct ClassPredicate{
+	static const int characterClass = CharacterClass;
+	static inline bool test(int classes){
+		return (classes & CharacterClass) != 0;
+	}
+};
+
+// isNumberSequence
+struct Number : ClassPredicate<CHARACTER_CLASS_DIGIT>{
+	static int fallback(const char * charSequence, size_t numberOfBytes, int encoding, int){
+		return isNumberSequenceBounded(charSequence, numberOfBytes, encoding);
+	}
+};
+
+// isHexSequence
+struct Hex : ClassPredicate<CHARACTER_CLASS_HEX>{
+	static int fallback(const char * charSequence, size_t numberOfBytes, int encoding, int){
+		return isHexSequenceBounded(charSequence, numberOfBytes, encoding);
+	}
+};
+
+// isValidCharacterSequence
+struct ValidCharacter : ClassPredicate<CHARACTER_CLASS_VALID>{
+	static int fallback(const char * charSequence, size_t numberOfBytes, int encoding, int){
+		return isValidCharacterSequenceBounded(charSequence, numberOfBytes, encoding);
+	}
+};
+
+// isInRomanceAlphabetSequence
+struct RomanceAlphabet : ClassPredicate<CHARACTER_CLASS_ROMANCE>{
+	static int fallback(const char * charSequence, size_t numberOfBytes, int encoding, int){
+		return isInRomanceAlphabetSequenceBounded(charSequence, numberOfBytes, encoding);
+	}
+};
+
+// isInAlphabetSequence
+struct Alphabet : ClassPredicate<CHARACTER_CLASS_ALPHA>{
+	static int fallback(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+		return isInAlphabetSequenceBounded(charSequence, numberOfBytes, encoding, language);
+	}
+};
+
+// isPunctuationMarkInAlphabetSequence
+struct PunctuationMark : ClassPredicate<CHARACTER_CLASS_PUNCT>{
+	static int fallback(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+		return isPunctuationMarkInAlphabetSequenceBounded(charSequence, numberOfBytes, encoding, language);
+	}
+};
+
+// isUpperCaseInAlphabetSequence
+struct UpperCase : ClassPredicate<CHARACTER_CLASS_UPPER>{
+	static int fallback(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+		return isUpperCaseInAlphabetSequenceBounded(charSequence, numberOfBytes, encoding, language);
+	}
+};
+
+// isLowerCaseInAlphabetSequence
+struct LowerCase : ClassPredicate<CHARACTER_CLASS_LOWER>{
+	static int fallback(const char * charSequence, size_t numberOfBytes, int encoding, int language){
+		return isLowerCaseInAlphabetSequenceBounded(charSequence, numberOfBytes, encoding, language);
+	}
+};
+
+/**
+ * Check a sequence of characters with a predicate in an encoding and a
+ * language. The results are those of the C sequence checks.
+ */
+template<int Encoding, int Language, typename Predicate> struct SequenceOf{
+	/**
+	 * Check a bounded sequence of characters. A character that is cut off by
+	 * the end of the buffer fails the check.
+	 * @param charSequence The string to check
+	 * @param numberOfBytes The number of bytes in the string
+	 * @returns {false, true}
+	 */
+	static bool check(const char * charSequence, size_t numberOfBytes){
+		size_t index = 0;
+		size_t scalarEnd = numberOfBytes;
+		_asciiClassRanges ranges;
+		// Runs of ascii characters are checked a vector at a time, as in
+		// _isClassSequenceOfBounded
+		bool vectors = Encoding != UTF16 && numberOfBytes >= 32 &&
+				_getASCIIClassRanges(&ranges, Encoding, Language, Predicate::characterClass);
+		while(index < numberOfBytes){
+			if(vectors){
+				size_t run = _asciiClassSpan(&ranges, charSequence + index, numberOfBytes - index);
+				index += run;
+				scalarEnd = index + (run < 16 ? 64 : 1);
+				if(scalarEnd > numberOfBytes){
+					scalarEnd = numberOfBytes;
+				}
+			}
+			while(index < scalarEnd){
+				int classes;
+				int length = CharacterClassesOf<Encoding, Language>::decode(charSequence + index, numberOfBytes - index, &classes);
+				if(length == -1 || !Predicate::test(classes)){
+					return false;
+				}
+				index += length;
+			}
+		}
+		return true;
+	}
+
+	/**
+	 * Check a NUL terminated sequence of characters
+	 * @param charSequence The string to check
+	 * @returns {false, true}
+	 */
+	static bool check(const char * charSequence){
+		return check(charSequence, _getStringByteLength(charSequence, Encoding));
+	}
+};
+
+/**
+ * Pick the instantiation of a language for an encoding. The cases come from
+ * the languages of languageTables.h.
+ */
+template<int Encoding, typename Predicate>
+static inline int _isSequenceOfInLanguage(const char * charSequence, size_t numberOfBytes, int language){
+#define _LANGUAGE_SEQUENCE_OF_CASE(LANGUAGE) \
+	case LANGUAGE: \
+		return SequenceOf<Encoding, LANGUAGE, Predicate>::check(charSequence, numberOfBytes);
+	switch(language){
+	LANGUAGE_FOR_EACH_LANGUAGE(_LANGUAGE_SEQUENCE_OF_CASE)
+	default:
+		return Predicate::fallback(charSequence, numberOfBytes, Encoding, language);
+	}
+#undef _LANGUAGE_SEQUENCE_OF_CASE
+}
+
+/**
+ * Check a bounded sequence of characters with a predicate. The encoding and
+ * the language are matched to an instantiation of SequenceOf once per call.
+ * The predicates that do not depend on the language ignore it.
+ * @param charSequence The string to check
+ * @param numberOfBytes The number of bytes in the string
+ * @param encoding The encoding of the string
+ * @param language The language of the string
+ * @returns {0 = false, 1 = true}
+ */
+template<typename Predicate>
+static inline int isSequenceOf(const char * charSequence, size_t numberOfBytes, int encoding, int language = ENGLISH){
+	switch(encoding){
+	case ASCII:
+		return _isSequenceOfInLanguage<ASCII, Predicate>(charSequence, numberOfBytes, language);
+	case ISO_8859_1:
+		return _isSequenceOfInLanguage<ISO_8859_1, Predicate>(charSequence, numberOfBytes, language);
+	case UTF8_BINARY:
+		return _isSequenceOfInLanguage<UTF8_BINARY, Predicate>(charSequence, numberOfBytes, language);
+	case UTF16:
+		return _isSequenceOfInLanguage<UTF16, Predicate>(charSequence, numberOfBytes, language);
+	default:
+		return Predicate::fallback(charSequence, numberOfBytes, encoding, language);
+	}
+}
+
+}
+
+#endif
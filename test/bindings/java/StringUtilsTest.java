@@ -1,6 +1,8 @@
 package test.bindings.java;
 
 import com.Language.LanguageStringUtils;
+import com.Language.types.CharacterClasses;
+import com.Language.types.ClassHistogram;
 import com.Language.types.LanguageEncodings;
 import com.Language.types.StringEncodings;
 import static org.junit.Assert.assertEquals;
@@ -213,4 +215,109 @@ public class StringUtilsTest{
 		assertEquals("',' is  a upper case english string", isValid4, true);
 		assertEquals("'Añoro' is not an upper english string", isValid5, false);
 	}
+	
+	/**
+	 * Test the utf8 validation of byte arrays
+	 */
+	@Test
+	public void testValidateUTF8(){
+		LanguageStringUtils stringUtils = new LanguageStringUtils();
+		byte[] valid = {0x63, 0x61, 0x66, (byte)0xc3, (byte)0xa9};
+		byte[] cutOff = {0x63, 0x61, 0x66, (byte)0xc3};
+		byte[] surrogate = {0x61, 0x62, 0x63, (byte)0xed, (byte)0xa0, (byte)0x80};
+		
+		assertEquals("'café' is valid utf8", stringUtils.validateUTF8(valid), -1);
+		assertEquals("A cut off character is malformed", stringUtils.validateUTF8(cutOff), 3);
+		assertEquals("A surrogate is malformed", stringUtils.validateUTF8(surrogate), 3);
+	}
+	
+	/**
+	 * Test that a null array is not mistaken for malformed utf8
+	 */
+	@Test(expected = NullPointerException.class)
+	public void testValidateUTF8Null(){
+		LanguageStringUtils stringUtils = new LanguageStringUtils();
+		stringUtils.validateUTF8(null);
+	}
+	
+	/**
+	 * Test the one pass classification of strings
+	 */
+	@Test
+	public void testClassify(){
+		LanguageStringUtils stringUtils = new LanguageStringUtils();
+		int utf8Encoding = StringEncodings.UTF8_BINARY.getEncodingValue();
+		int englishLanguage = LanguageEncodings.ENGLISH.getEncodingValue();
+		int frenchLanguage = LanguageEncodings.FRENCH.getEncodingValue();
+		int number = stringUtils.classify("0123", utf8Encoding, englishLanguage);
+		int upper = stringUtils.classify("HELLO", utf8Encoding, englishLanguage);
+		int french = stringUtils.classify("\u00e9t\u00e9", utf8Encoding, frenchLanguage);
+		int english = stringUtils.classify("\u00e9t\u00e9", utf8Encoding, englishLanguage);
+		
+		assertEquals("'0123' is a natural number", CharacterClasses.DIGIT.isIn(number), true);
+		assertEquals("'0123' is a hex number", CharacterClasses.HEX.isIn(number), true);
+		assertEquals("'0123' is not in the english alphabet", CharacterClasses.ALPHA.isIn(number), false);
+		assertEquals("'HELLO' is upper case english", CharacterClasses.UPPER.isIn(upper), true);
+		assertEquals("'HELLO' is not lower case english", CharacterClasses.LOWER.isIn(upper), false);
+		assertEquals("'été' is lower case french", CharacterClasses.LOWER.isIn(french), true);
+		assertEquals("'été' is not in the english alphabet", CharacterClasses.ALPHA.isIn(english), false);
+		assertEquals("An emoji and a NUL are valid characters", CharacterClasses.VALID.isIn(stringUtils.classify("a\ud83d\ude00\u0000",
+				utf8Encoding, englishLanguage)), true);
+	}	
+	/**
+	 * Test the character class counts of strings
+	 */
+	@Test
+	public void testClassHistogram(){
+		LanguageStringUtils stringUtils = new LanguageStringUtils();
+		int utf8Encoding = StringEncodings.UTF8_BINARY.getEncodingValue();
+		int frenchLanguage = LanguageEncodings.FRENCH.getEncodingValue();
+		ClassHistogram histogram = stringUtils.classHistogram("\u00c9t\u00e9 42!", utf8Encoding, frenchLanguage);
+		
+		assertEquals("'Été 42!' has 7 characters", histogram.characters, 7);
+		assertEquals("'Été 42!' has 1 upper case letter", histogram.upperCase, 1);
+		assertEquals("'Été 42!' has 2 lower case letters", histogram.lowerCase, 2);
+		assertEquals("'Été 42!' has 2 digits", histogram.digits, 2);
+		assertEquals("'Été 42!' has 2 extended letters", histogram.extended, 2);
+		assertEquals("An emoji and a NUL are counted", stringUtils.classHistogram("a\ud83d\ude00\u0000", utf8Encoding,
+				frenchLanguage).characters, 3);
+	}
+	
+	/**
+	 * Test the language scores of strings
+	 */
+	@Test
+	public void testScoreLanguages(){
+		LanguageStringUtils stringUtils = new LanguageStringUtils();
+		int utf8Encoding = StringEncodings.UTF8_BINARY.getEncodingValue();
+		int english = LanguageEncodings.ENGLISH.getEncodingValue();
+		int spanish = LanguageEncodings.SPANISH.getEncodingValue();
+		int french = LanguageEncodings.FRENCH.getEncodingValue();
+		long[] spanishScores = stringUtils.scoreLanguages("El ni\u00f1o llama a su hermano", utf8Encoding);
+		long[] frenchScores = stringUtils.scoreLanguages("Le gar\u00e7on mange une pomme", utf8Encoding);
+		
+		assertEquals("'El niño llama a su hermano' is spanish", spanishScores[spanish] > spanishScores[english] &&
+				spanishScores[spanish] > spanishScores[french], true);
+		assertEquals("'Le garçon mange une pomme' is french", frenchScores[french] > frenchScores[english] &&
+				frenchScores[french] > frenchScores[spanish], true);
+		assertEquals("A string with an emoji is scored", stringUtils.scoreLanguages("El ni\u00f1o \ud83d\ude00", utf8Encoding) != null, true);
+	}
+	
+	/**
+	 * Test the case conversions of the alphabets
+	 */
+	@Test
+	public void testCaseConversion(){
+		LanguageStringUtils stringUtils = new LanguageStringUtils();
+		int utf8Encoding = StringEncodings.UTF8_BINARY.getEncodingValue();
+		int isoEncoding = StringEncodings.ISO_8859_1.getEncodingValue();
+		int english = LanguageEncodings.ENGLISH.getEncodingValue();
+		int spanish = LanguageEncodings.SPANISH.getEncodingValue();
+		int french = LanguageEncodings.FRENCH.getEncodingValue();
+		
+		assertEquals("'niño' is 'NIÑO' in spanish", stringUtils.toUpperInAlphabet("ni\u00f1o", utf8Encoding, spanish), "NI\u00d1O");
+		assertEquals("'niño' is 'NIñO' in english", stringUtils.toUpperInAlphabet("ni\u00f1o", utf8Encoding, english), "NI\u00f1O");
+		assertEquals("'ÉTÉ' is 'été' in french", stringUtils.toLowerInAlphabet("\u00c9T\u00c9", utf8Encoding, french), "\u00e9t\u00e9");
+		assertEquals("A java string is converted as utf16 in any encoding", stringUtils.toLowerInAlphabet("\u03a9\u00c9", isoEncoding, french), "\u03a9\u00e9");
+	}
 }
\ No newline at end of file
@@ -251,6 +251,115 @@ var JavascriptStringUtilsTest = (function(){
 		expect(isPunctuationMarkInAlphabet5).to.eql(true);
 	}
 	
+	/**
+	 * Test the utf8 validation of strings and buffers
+	 * @function testValidateUTF8
+	 * @memberof JavascriptStringUtilsTest
+	 */
+	function testValidateUTF8(){
+		var StringUtils = LanguageModule.StringUtils;
+		var stringUtils = new StringUtils();
+		var validString = stringUtils.validateUTF8("caf\u00e9");
+		var validBuffer = stringUtils.validateUTF8(new Buffer([0x63, 0x61, 0x66, 0xc3, 0xa9]));
+		var cutOff = stringUtils.validateUTF8(new Buffer([0x63, 0x61, 0x66, 0xc3]));
+		var overlong = stringUtils.validateUTF8(new Buffer([0x61, 0x62, 0xc0, 0xaf]));
+		expect(validString).to.eql(-1);
+		expect(validBuffer).to.eql(-1);
+		expect(cutOff).to.eql(3);
+		expect(overlong).to.eql(2);
+		expect(function(){ stringUtils.validateUTF8(42); }).to.throwException(function(e){
+			expect(e).to.be.a(TypeError);
+		});
+	}
+	
+	/**
+	 * Test the one pass classification of strings and buffers
+	 * @function testClassify
+	 * @memberof JavascriptStringUtilsTest
+	 */
+	function testClassify(){
+		var StringUtils = LanguageModule.StringUtils;
+		var stringUtils = new StringUtils();
+		var classes = stringUtils.characterClasses;
+		var encodings = stringUtils.stringEncodings;
+		var languages = stringUtils.languageEncodings;
+		var number = stringUtils.classify("0123", encodings.UTF8_BINARY, languages.ENGLISH);
+		var upper = stringUtils.classify(new Buffer("HELLO"), encodings.ASCII, languages.ENGLISH);
+		var french = stringUtils.classify("\u00e9t\u00e9", encodings.UTF8_BINARY, languages.FRENCH);
+		var english = stringUtils.classify("\u00e9t\u00e9", encodings.UTF8_BINARY, languages.ENGLISH);
+		var cutOff = stringUtils.classify(new Buffer([0x61, 0x62, 0xc3]), encodings.UTF8_BINARY, languages.ENGLISH);
+		expect((number & classes.DIGIT) != 0).to.eql(true);
+		expect((number & classes.HEX) != 0).to.eql(true);
+		expect((number & classes.ALPHA) != 0).to.eql(false);
+		expect((upper & classes.UPPER) != 0).to.eql(true);
+		expect((upper & classes.LOWER) != 0).to.eql(false);
+		expect((french & classes.LOWER) != 0).to.eql(true);
+		expect((english & classes.ALPHA) != 0).to.eql(false);
+		expect(cutOff).to.eql(0);
+	}
+	
+	/**
+	 * Test the character class counts of strings and buffers
+	 * @function testClassHistogram
+	 * @memberof JavascriptStringUtilsTest
+	 */
+	function testClassHistogram(){
+		var StringUtils = LanguageModule.StringUtils;
+		var stringUtils = new StringUtils();
+		var encodings = stringUtils.stringEncodings;
+		var languages = stringUtils.languageEncodings;
+		var histogram = stringUtils.classHistogram("\u00c9t\u00e9 42!", encodings.UTF8_BINARY, languages.FRENCH);
+		var cutOff = stringUtils.classHistogram(new Buffer([0x61, 0x62, 0xc3]), encodings.UTF8_BINARY, languages.ENGLISH);
+		expect(histogram.characters).to.eql(7);
+		expect(histogram.upperCase).to.eql(1);
+		expect(histogram.lowerCase).to.eql(2);
+		expect(histogram.digits).to.eql(2);
+		expect(histogram.extended).to.eql(2);
+		expect(cutOff).to.eql(null);
+	}
+	
+	/**
+	 * Test the language scores of strings and buffers
+	 * @function testScoreLanguages
+	 * @memberof JavascriptStringUtilsTest
+	 */
+	function testScoreLanguages(){
+		var StringUtils = LanguageModule.StringUtils;
+		var stringUtils = new StringUtils();
+		var encodings = stringUtils.stringEncodings;
+		var spanish = stringUtils.scoreLanguages("El ni\u00f1o llama a su hermano", encodings.UTF8_BINARY);
+		var french = stringUtils.scoreLanguages("Le gar\u00e7on mange une pomme", encodings.UTF8_BINARY);
+		var cutOff = stringUtils.scoreLanguages(new Buffer([0x61, 0x62, 0xc3]), encodings.UTF8_BINARY);
+		expect(spanish.SPANISH).to.be.above(spanish.ENGLISH);
+		expect(spanish.SPANISH).to.be.above(spanish.FRENCH);
+		expect(french.FRENCH).to.be.above(french.ENGLISH);
+		expect(french.FRENCH).to.be.above(french.SPANISH);
+		expect(cutOff).to.eql(null);
+	}
+	
+	/**
+	 * Test the case conversions of the alphabets in strings and buffers
+	 * @function testCaseConversion
+	 * @memberof JavascriptStringUtilsTest
+	 */
+	function testCaseConversion(){
+		var StringUtils = LanguageModule.StringUtils;
+		var stringUtils = new StringUtils();
+		var encodings = stringUtils.stringEncodings;
+		var languages = stringUtils.languageEncodings;
+		var buffer = new Buffer([0x63, 0x61, 0x66, 0xc3, 0xa9]);
+		expect(stringUtils.toUpperInAlphabet("ni\u00f1o", encodings.UTF8_BINARY, languages.SPANISH)).to.eql("NI\u00d1O");
+		expect(stringUtils.toUpperInAlphabet("ni\u00f1o", encodings.UTF8_BINARY, languages.ENGLISH)).to.eql("NI\u00f1O");
+		expect(stringUtils.toLowerInAlphabet("\u00c9T\u00c9", encodings.UTF8_BINARY, languages.FRENCH)).to.eql("\u00e9t\u00e9");
+		expect(stringUtils.toUpperInAlphabet(new Buffer([0x61, 0x62, 0xc3]), encodings.UTF8_BINARY, languages.ENGLISH)).to.eql(null);
+		// A string is converted as utf8 in any encoding
+		expect(stringUtils.toLowerInAlphabet("\u03a9\u00c9", encodings.ISO_8859_1, languages.FRENCH)).to.eql("\u03a9\u00e9");
+
+		// A buffer is converted in place
+		expect(stringUtils.toUpperInAlphabet(buffer, encodings.UTF8_BINARY, languages.FRENCH)).to.equal(buffer);
+		expect(buffer.toString()).to.eql("CAF\u00c9");
+	}
+	
 	/**
 	 * The public interface
 	 */
@@ -266,7 +375,12 @@ var JavascriptStringUtilsTest = (function(){
 		testIsInAlphabet:testIsInAlphabet,
 		testInLowerCaseAlphabet:testInLowerCaseAlphabet,
 		testInUpperCaseAlphabet:testInUpperCaseAlphabet,
-		testInPunctuationMarkAlphabet:testInPunctuationMarkAlphabet
+		testInPunctuationMarkAlphabet:testInPunctuationMarkAlphabet,
+		testValidateUTF8:testValidateUTF8,
+		testClassify:testClassify,
+		testClassHistogram:testClassHistogram,
+		testScoreLanguages:testScoreLanguages,
+		testCaseConversion:testCaseConversion
 	}
 })();
 
@@ -283,5 +397,10 @@ describe("Test the javascript string utils", function(){
 	it('JavascriptStringUtils Is In LowerCase Alphabet Test', JavascriptStringUtilsTest.testInLowerCaseAlphabet);
 	it('JavascriptStringUtils Is In UpperCase Alphabet Test', JavascriptStringUtilsTest.testInUpperCaseAlphabet);
 	it('JavascriptStringUtils Is Punctiona Mark Alphabet Test', JavascriptStringUtilsTest.testInPunctuationMarkAlphabet);
+	it('JavascriptStringUtils Validate UTF8 Test', JavascriptStringUtilsTest.testValidateUTF8);
+	it('JavascriptStringUtils Classify Test', JavascriptStringUtilsTest.testClassify);
+	it('JavascriptStringUtils Class Histogram Test', JavascriptStringUtilsTest.testClassHistogram);
+	it('JavascriptStringUtils Score Languages Test', JavascriptStringUtilsTest.testScoreLanguages);
+	it('JavascriptStringUtils Case Conversion Test', JavascriptStringUtilsTest.testCaseConversion);
 });
 
@@ -28,6 +28,12 @@ from Language.stringUtils import isInAlphabet
 from Language.stringUtils import isUpperCaseInAlphabet
 from Language.stringUtils import isLowerCaseInAlphabet
 from Language.stringUtils import isPunctuationMarkInAlphabet
+from Language.stringUtils import validateUTF8
+from Language.stringUtils import classify
+from Language.stringUtils import classHistogram
+from Language.stringUtils import scoreLanguages
+from Language.stringUtils import toUpperInAlphabet
+from Language.stringUtils import toLowerInAlphabet
 from LanguageUtils.StringUtils import StringUtils
 
 class StringUtilsTestCase(unittest.TestCase):
@@ -39,6 +45,9 @@ class StringUtilsTestCase(unittest.TestCase):
         Test the string utils length
         """
         self.assertTrue(length("SixValue") == 8)
+        # A unicode string is read in its own characters whatever the encoding
+        self.assertTrue(length(u"caf\xe9") == 4)
+        self.assertTrue(length(u"caf\xe9", 2) == 4)
         
     def test_StringUtilsLengthEscaped(self):
         """
@@ -145,6 +154,88 @@ class StringUtilsTestCase(unittest.TestCase):
         self.assertFalse(isPunctuationMarkInAlphabet("G", sEncodings['ASCII'], lEncodings['ENGLISH']))
         self.assertTrue(isPunctuationMarkInAlphabet(",", sEncodings['ASCII'], lEncodings['ENGLISH']))
     
+    def test_validateUTF8(self):
+        """
+        Test the string utils utf8 validation
+        """
+        self.assertTrue(validateUTF8("caf\xc3\xa9") == -1)
+        self.assertTrue(validateUTF8(bytearray("caf\xc3\xa9")) == -1)
+        self.assertTrue(validateUTF8("caf\xc3") == 3)
+        self.assertTrue(validateUTF8("ab\xc0\xafcd") == 2)
+        self.assertTrue(validateUTF8("abc\xed\xa0\x80") == 3)
+    
+    def test_classify(self):
+        """
+        Test the one pass classification of strings
+        """
+        sEncodings = StringUtils.stringEncodings()
+        lEncodings = StringUtils.languageEncodings()
+        classes = StringUtils.characterClasses()
+        number = classify("0123", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH'])
+        self.assertTrue(number & classes['DIGIT'])
+        self.assertTrue(number & classes['HEX'])
+        self.assertFalse(number & classes['ALPHA'])
+        upper = classify("HELLO", sEncodings['ASCII'], lEncodings['ENGLISH'])
+        self.assertTrue(upper & classes['UPPER'])
+        self.assertFalse(upper & classes['LOWER'])
+        self.assertTrue(classify("\xc3\xa9t\xc3\xa9", sEncodings['UTF8_BINARY'], lEncodings['FRENCH']) & classes['LOWER'])
+        self.assertFalse(classify("\xc3\xa9t\xc3\xa9", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH']) & classes['ALPHA'])
+        self.assertTrue(classify("ab\xc3", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH']) == 0)
+    
+    def test_classHistogram(self):
+        """
+        Test the character class counts of strings
+        """
+        sEncodings = StringUtils.stringEncodings()
+        lEncodings = StringUtils.languageEncodings()
+        histogram = classHistogram("\xc3\x89t\xc3\xa9 42!", sEncodings['UTF8_BINARY'], lEncodings['FRENCH'])
+        self.assertTrue(histogram['characters'] == 7)
+        self.assertTrue(histogram['upperCase'] == 1)
+        self.assertTrue(histogram['lowerCase'] == 2)
+        self.assertTrue(histogram['digits'] == 2)
+        self.assertTrue(histogram['extended'] == 2)
+        self.assertTrue(classHistogram("ab\xc3", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH']) is None)
+        histogram = classHistogram(u"\xc9t\xe9 42!", sEncodings['UTF8_BINARY'], lEncodings['FRENCH'])
+        self.assertTrue(histogram['characters'] == 7)
+        self.assertTrue(histogram['extended'] == 2)
+    
+    def test_scoreLanguages(self):
+        """
+        Test the language scores of strings
+        """
+        sEncodings = StringUtils.stringEncodings()
+        scores = scoreLanguages("El ni\xc3\xb1o llama a su hermano", sEncodings['UTF8_BINARY'])
+        self.assertTrue(max(scores, key=scores.get) == 'SPANISH')
+        scores = scoreLanguages("Le gar\xe7on mange une pomme", sEncodings['ISO_8859_1'])
+        self.assertTrue(max(scores, key=scores.get) == 'FRENCH')
+        scores = scoreLanguages("The weather was warm", sEncodings['UTF8_BINARY'])
+        self.assertTrue(max(scores, key=scores.get) == 'ENGLISH')
+        self.assertTrue(scoreLanguages("ab\xc3", sEncodings['UTF8_BINARY']) is None)
+    
+    def test_caseConversion(self):
+        """
+        Test the case conversions of the alphabets
+        """
+        sEncodings = StringUtils.stringEncodings()
+        lEncodings = StringUtils.languageEncodings()
+        self.assertTrue(toUpperInAlphabet("ni\xc3\xb1o", sEncodings['UTF8_BINARY'], lEncodings['SPANISH']) == "NI\xc3\x91O")
+        self.assertTrue(toUpperInAlphabet("ni\xc3\xb1o", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH']) == "NI\xc3\xb1O")
+        self.assertTrue(toLowerInAlphabet("\xc9T\xc9", sEncodings['ISO_8859_1'], lEncodings['FRENCH']) == "\xe9t\xe9")
+        self.assertTrue(toUpperInAlphabet("ab\xc3", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH']) is None)
+        # The single characters are converted into new strings, not the shared ones
+        self.assertTrue(toUpperInAlphabet("a", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH']) == "A")
+        self.assertTrue(chr(97) == "a" and "xa"[1] == "a")
+        self.assertTrue(toUpperInAlphabet(u"b", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH']) == u"B")
+        self.assertTrue(u"b" == unichr(98) and hash(u"b") == hash("b"))
+        # A unicode string is converted in its own characters whatever the encoding
+        self.assertTrue(toUpperInAlphabet(u"caf\xe9", sEncodings['UTF8_BINARY'], lEncodings['FRENCH']) == u"CAF\xc9")
+        self.assertTrue(toLowerInAlphabet(u"\u03a9\xc9", sEncodings['ISO_8859_1'], lEncodings['FRENCH']) == u"\u03a9\xe9")
+        self.assertTrue(toUpperInAlphabet(u"\U0001f600a", sEncodings['UTF8_BINARY'], lEncodings['ENGLISH']) == u"\U0001f600A")
+        # A bytearray is converted in place
+        text = bytearray("caf\xc3\xa9")
+        self.assertTrue(toUpperInAlphabet(text, sEncodings['UTF8_BINARY'], lEncodings['FRENCH']) is text)
+        self.assertTrue(text == bytearray("CAF\xc3\x89"))
+    
     def test_stringUtils(self):
         """
         Test the string utils around the Language functional interface
@@ -160,6 +251,10 @@ class StringUtilsTestCase(unittest.TestCase):
         self.assertFalse(s.isUpperCaseInAlphabet())
         self.assertFalse(s.isLowerCaseInAlphabet())
         self.assertFalse(s.isPunctuationMarkInAlphabet())
+        self.assertTrue(s.validateUTF8() == -1)
+        self.assertTrue(s.classify() & StringUtils.characterClasses()['DIGIT'])
+        self.assertTrue(s.classHistogram()['digits'] == 3)
+        self.assertTrue(s.scoreLanguages()['ENGLISH'] == 0)
         
 if __name__=='__main__':
     unittest.main()
\ No newline at end of file
@@ -0,0 +1,110 @@
+//Copyright 2014 by Daniel Ortiz
+//
+//Licensed under the Apache License, Version 2.0 (the "License");
+//you may not use this file except in compliance with the License.
+//You may obtain a copy of the License at
+//
+//    http://www.apache.org/licenses/LICENSE-2.0
+//
+//Unless required by applicable law or agreed to in writing, software
+//distributed under the License is distributed on an "AS IS" BASIS,
+//WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//See the License for the specific language governing permissions and
+//limitations under the License.
+#include <stdio.h>
+#include <string.h>
+#include "stringUtils.hpp"
+
+// A function that checks the instantiations of SequenceOf
+int testSequenceOf(){
+	// e with an acute accent in utf8 and iso-8859-1
+	if(!language::SequenceOf<UTF8_BINARY, FRENCH, language::Alphabet>::check("\xc3\xa9t\xc3\xa9") ||
+			language::SequenceOf<UTF8_BINARY, ENGLISH, language::Alphabet>::check("\xc3\xa9t\xc3\xa9") ||
+			!language::SequenceOf<ISO_8859_1, FRENCH, language::LowerCase>::check("\xe9t\xe9") ||
+			language::SequenceOf<ISO_8859_1, FRENCH, language::UpperCase>::check("\xe9t\xe9")){
+		return 0;
+	}
+	if(!language::SequenceOf<ASCII, ENGLISH, language::Number>::check("0123", 4) ||
+			language::SequenceOf<ASCII, ENGLISH, language::Number>::check("01a3", 4) ||
+			!language::SequenceOf<UTF8_BINARY, ENGLISH, language::Hex>::check("01a3", 4)){
+		return 0;
+	}
+	// A cut off character
+	if(language::SequenceOf<UTF8_BINARY, FRENCH, language::ValidCharacter>::check("a\xc3\xa9", 2)){
+		return 0;
+	}
+	const unsigned short units[] = {'N', 'i', 0xf1, 'o', 0};
+	if(!language::SequenceOf<UTF16, SPANISH, language::Alphabet>::check((const char *)units) ||
+			language::SequenceOf<UTF16, ENGLISH, language::Alphabet>::check((const char *)units)){
+		return 0;
+	}
+	return -1;
+}
+
+// A function that checks the results of isSequenceOf against the C sequence checks
+int testIsSequenceOf(){
+	char buffer[101];
+	int encoding;
+	int language;
+	int r;
+	memset(buffer, 'e', 100);
+	buffer[100] = '\0';
+	for(r = 0; r < 100; r += 7){
+		buffer[r] = r % 2 == 0 ? '!' : (char)0xc3;
+		for(encoding = ASCII; encoding <= UTF16 + 1; encoding++){
+			if(language::isSequenceOf<language::Hex>(buffer, 100, encoding) != isHexSequenceBounded(buffer, 100, encoding) ||
+					language::isSequenceOf<language::ValidCharacter>(buffer, r + 1, encoding) !=
+					isValidCharacterSequenceBounded(buffer, r + 1, encoding)){
+				return 0;
+			}
+			// A language past the last one is handled by the C checks
+			for(language = ENGLISH; language <= NUMBER_OF_LANGUAGES; language++){
+				if(language::isSequenceOf<language::Alphabet>(buffer, 100, encoding, language) !=
+						isInAlphabetSequenceBounded(buffer, 100, encoding, language) ||
+						language::isSequenceOf<language::LowerCase>(buffer, r + 1, encoding, language) !=
+						isLowerCaseInAlphabetSequenceBounded(buffer, r + 1, encoding, language)){
+					return 0;
+				}
+			}
+		}
+		buffer[r] = 'e';
+	}
+	return -1;
+}
+
+// A function that tests the main points of functionality associated with the template interface
+int testStringUtilsTemplates(){
+	// The success/failure count
+	int successCount = 0;
+	int failureCount = 0;
+
+	int testIter = 0;
+	int numberOfTests = 2;
+	int (*test_Array[2])() = {testSequenceOf, testIsSequenceOf};
+	const char * testNames[2] = {"SequenceOf test", "isSequenceOf test"};
+	for(testIter = 0; testIter < numberOfTests; testIter++){
+		const char * testName = testNames[testIter];
+		int (*test)() = test_Array[testIter];
+		if(test() == -1){
+			successCount++;
+			printf("*SUCCESS - %s passed\n", testName);
+		}else{
+			failureCount++;
+			printf("*FAILURE - %s failed\n", testName);
+		}
+	}
+	printf("\n");
+	if(successCount > 0){
+		printf("%d tests succeeded\n", successCount);
+	}
+	if(failureCount > 0){
+		printf("%d tests failed\n", failureCount);
+	}
+	printf("\n");
+	return 0;
+}
+
+
+int main(int argc, char ** argv){
+	return testStringUtilsTemplates();
+}
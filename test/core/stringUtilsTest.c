@@ -12,7 +12,9 @@
 //See the License for the specific language governing permissions and
 //limitations under the License.
 #include <stdio.h>
+#include <string.h>
 #include "stringUtils.h"
+#include "parallelStringUtils.h"
 
 // Conversion test struct.
 struct ConvertTest{
@@ -230,6 +232,260 @@ int testStringLength(){
 	return -1;
 }
 
+// Test the string length of utf8 buffers that are long enough to be
+// counted by the vector kernels
+int testStringLengthUTF8Blocks(){
+	int r, k;
+	// e, combining acute(0x301), n(tilde), combining arrow(0x20d7), euro sign,
+	// grinning face(not counted), a, b
+	const unsigned char pattern[] = {0x65,0xcc,0x81,0xc3,0xb1,0xe2,0x83,0x97,0xe2,0x82,0xac,
+			0xf0,0x9f,0x98,0x80,0x61,0x62};
+	char buffer[512];
+
+	// Shift the pattern through the vector boundaries
+	for(k = 0; k < 40; k++){
+		int index = 0;
+		for(r = 0; r < k; r++){
+			buffer[index++] = 'x';
+		}
+		for(r = 0; r < 10; r++){
+			memcpy(buffer + index, pattern, sizeof(pattern));
+			index += sizeof(pattern);
+		}
+		buffer[index] = '\0';
+		if(len(buffer, UTF8_BINARY) != k + 50){
+			return 0;
+		}
+	}
+
+	// Characters that can never be part of utf8 are errors
+	memset(buffer, 'a', 100);
+	buffer[40] = (char)0xf8;
+	buffer[100] = '\0';
+	if(len(buffer, UTF8_BINARY) != -1){
+		return 0;
+	}
+	return -1;
+}
+
+// Test the string length of buffers bounded by a byte length
+int testStringLengthBounded(){
+	// Embedded NUL characters are counted
+	const char ascii[] = {'a','b','\0','c'};
+	if(lenBounded(ascii, 4, ASCII) != 4 || lenBounded(ascii, 4, UTF8_BINARY) != 4){
+		return 0;
+	}
+
+	// Only the bytes in the bound are counted
+	const unsigned char utf8[] = {0xc2,0xbf,0x43,0xc3,0xb2,0x6d,0x6f};
+	if(lenBounded((const char *)utf8, 7, UTF8_BINARY) != 5){
+		return 0;
+	}
+	if(lenBounded((const char *)utf8, 2, UTF8_BINARY) != 1){
+		return 0;
+	}
+
+	// A character cut off by the bound is an error
+	if(lenBounded((const char *)utf8, 4, UTF8_BINARY) != -1){
+		return 0;
+	}
+	if(convertUTF8BinaryToCodePointBounded((const char *)utf8, 1) != -1){
+		return 0;
+	}
+	if(convertUTF8BinaryToCodePointBounded((const char *)utf8, 2) != 0xbf){
+		return 0;
+	}
+
+	// The escaped length stops at the bound
+	if(lenEscapedBounded("HealthyYUM2345NRRR", 15, ASCII, "YUM", ASCII_HEX_UTF_ESCAPE, NULL) != 9){
+		return 0;
+	}
+	if(lenEscapedBounded("HealthyYUM2345NRRR", 12, ASCII, "YUM", ASCII_HEX_UTF_ESCAPE, NULL) != -1){
+		return 0;
+	}
+	return -1;
+}
+
+// Test the sequence checks of buffers bounded by a byte length
+int testSequenceBounded(){
+	if(isNumberSequenceBounded("567abc", 3, ASCII) != 1){
+		return 0;
+	}
+	if(isNumberSequenceBounded("567abc", 4, ASCII) != 0){
+		return 0;
+	}
+	if(isHexSequenceBounded("abcxyz", 3, ASCII) != 1){
+		return 0;
+	}
+	if(isSequenceAtIndexBounded(isNumber, "ab567", 5, ASCII, 2) != 1){
+		return 0;
+	}
+	if(isSequenceAtIndexBounded(isNumber, "ab567", 5, ASCII, 6) != 0){
+		return 0;
+	}
+
+	// e(acute), n(tilde) in utf8 with a cut off character
+	const unsigned char spanish[] = {0xc3,0xa9,0xc3,0xb1,0xc3};
+	if(isInAlphabetSequenceBounded((const char *)spanish, 4, UTF8_BINARY, SPANISH) != 1){
+		return 0;
+	}
+	if(isInAlphabetSequenceBounded((const char *)spanish, 5, UTF8_BINARY, SPANISH) != 0){
+		return 0;
+	}
+	if(isLowerCaseInAlphabetSequenceBounded((const char *)spanish, 4, UTF8_BINARY, SPANISH) != 1){
+		return 0;
+	}
+	if(isLanguageSequenceAtIndexBounded(isInAlphabet, (const char *)spanish, 4, UTF8_BINARY, SPANISH, 2) != 1){
+		return 0;
+	}
+	return -1;
+}
+
+// Test that the utf8 decoder validates every byte of a character
+int testDecodeUTF8Character(){
+	int r;
+	int codePoint;
+	const unsigned char valid[] = {0xf0,0x9f,0x98,0x80,'\0'};
+	if(decodeUTF8Character((const char *)valid, 4, &codePoint) != 4 || codePoint != 0x1f600){
+		return 0;
+	}
+	if(decodeUTF8Character((const char *)valid, 3, &codePoint) != -1){
+		return 0;
+	}
+
+	// Overlong forms, surrogates, code points past 0x10ffff, stray and missing
+	// continuation bytes
+	const unsigned char overlong[] = {0xc0,0xaf,'\0'};
+	const unsigned char overlong2[] = {0xe0,0x80,0xaf,'\0'};
+	const unsigned char surrogate[] = {0xed,0xa0,0x80,'\0'};
+	const unsigned char tooLarge[] = {0xf4,0x90,0x80,0x80,'\0'};
+	const unsigned char stray[] = {0x80,'\0'};
+	const unsigned char missing[] = {0xc3,0x41,'\0'};
+	const unsigned char * malformed[6] = {overlong, overlong2, surrogate, tooLarge, stray, missing};
+	for(r = 0; r < 6; r++){
+		if(convertUTF8BinaryToCodePoint((const char *)malformed[r]) != -1){
+			return 0;
+		}
+		if(isValidCharacter((const char *)malformed[r], UTF8_BINARY) != 0){
+			return 0;
+		}
+		if(len((const char *)malformed[r], UTF8_BINARY) != -1){
+			return 0;
+		}
+	}
+
+	// The stride of a sequence is checked by the decoder
+	const unsigned char spanish[] = {0xc3,0xa9,0xc3,0x41,'\0'};
+	if(isValidCharacterSequence((const char *)spanish, UTF8_BINARY) != 0){
+		return 0;
+	}
+	if(isValidCharacterSequenceBounded((const char *)spanish, 2, UTF8_BINARY) != 1){
+		return 0;
+	}
+	return -1;
+}
+
+// Test the bulk utf8 validation across the vector block boundaries
+int testValidateUTF8(){
+	int r;
+	size_t offset;
+	size_t errorOffset;
+	char buffer[160];
+	const unsigned char spanish[] = {0x61,0xc3,0xb1,0x6f,0xe2,0x82,0xac,0xf0,0x9f,0x98,0x80};
+	const unsigned char malformed[][3] = {{0xc0,0xaf,0x61},{0xed,0xa0,0x80},{0xf8,0x80,0x61},{0x80,0x61,0x61},{0xe1,0x61,0x61}};
+
+	// Valid text with the multibyte characters at every offset
+	for(offset = 0; offset < 64; offset++){
+		memset(buffer, 'a', sizeof(buffer));
+		memcpy(buffer + offset, spanish, sizeof(spanish));
+		if(validateUTF8(buffer, sizeof(buffer), &errorOffset) != 1){
+			return 0;
+		}
+	}
+
+	// Every malformed character is found at its own offset
+	for(r = 0; r < 5; r++){
+		for(offset = 0; offset < 70; offset++){
+			memset(buffer, 'a', sizeof(buffer));
+			memcpy(buffer + offset, malformed[r], 3);
+			errorOffset = 0;
+			if(validateUTF8(buffer, sizeof(buffer), &errorOffset) != 0 || errorOffset != offset){
+				return 0;
+			}
+			if(lenBounded(buffer, sizeof(buffer), UTF8_BINARY) != -1){
+				return 0;
+			}
+		}
+	}
+
+	// A character cut off by the end of the buffer
+	memset(buffer, 'a', sizeof(buffer));
+	buffer[sizeof(buffer) - 1] = (char)0xe2;
+	if(validateUTF8(buffer, sizeof(buffer), &errorOffset) != 0 || errorOffset != sizeof(buffer) - 1){
+		return 0;
+	}
+	if(validateUTF8(buffer, sizeof(buffer) - 1, NULL) != 1){
+		return 0;
+	}
+	return -1;
+}
+
+// Test the resumable length counter with characters split between chunks
+int testLenCounter(){
+	size_t r;
+	lenCounter counter;
+
+	// Feed n(tilde), euro sign and a combining acute accent a byte at a time
+	const unsigned char utf8[] = {0x61,0xc3,0xb1,0xe2,0x82,0xac,0x65,0xcc,0x81};
+	lenCounterInit(&counter, UTF8_BINARY);
+	for(r = 0; r < sizeof(utf8); r++){
+		if(lenCounterUpdate(&counter, (const char *)utf8 + r, 1) == -1){
+			return 0;
+		}
+	}
+	if(lenCounterFinish(&counter) != 4){
+		return 0;
+	}
+
+	// A character cut off by the end of the string
+	lenCounterInit(&counter, UTF8_BINARY);
+	lenCounterUpdate(&counter, (const char *)utf8, 5);
+	if(lenCounterFinish(&counter) != -1){
+		return 0;
+	}
+
+	// An escaped sequence split in the control string and in the code point
+	lenCounterInitEscaped(&counter, ASCII, "YUM", ASCII_HEX_UTF_ESCAPE, NULL);
+	lenCounterUpdate(&counter, "HealthyY", 8);
+	lenCounterUpdate(&counter, "UM23", 4);
+	lenCounterUpdate(&counter, "45N", 3);
+	if(lenCounterFinish(&counter) != 9){
+		return 0;
+	}
+
+	// A cut off control string is plain text and a cut off code point is an error
+	lenCounterInitEscaped(&counter, ASCII, "YUM", ASCII_HEX_UTF_ESCAPE, NULL);
+	lenCounterUpdate(&counter, "HealthyYU", 9);
+	if(lenCounterFinish(&counter) != 9){
+		return 0;
+	}
+	lenCounterInitEscaped(&counter, ASCII, "YUM", ASCII_HEX_UTF_ESCAPE, NULL);
+	lenCounterUpdate(&counter, "HealthyYUM23", 12);
+	if(lenCounterFinish(&counter) != -1){
+		return 0;
+	}
+
+	// Decimal sequences end at the first character that is not a number
+	lenCounterInitEscaped(&counter, ASCII, "&#", ASCII_DECIMAL_UTF_ESCAPE, ";");
+	lenCounterUpdate(&counter, "a&#2", 4);
+	lenCounterUpdate(&counter, "33;b&#", 6);
+	lenCounterUpdate(&counter, "769;", 4);
+	if(lenCounterFinish(&counter) != 3){
+		return 0;
+	}
+	return -1;
+}
+
 // Test the string length escaped functionality
 int testStringLengthEscaped(){
 
@@ -903,6 +1159,896 @@ int testIsLanguageSequenceAtIndex(){
 	return -1;
 }
 
+// A function that checks the encoding of code points into a buffer owned by the caller
+int testEncodeUTF8Into(){
+	int r;
+	char buffer[64];
+	int codePoints[40];
+	const int mixed[] = {0x61, 0xf1, 0x20ac, 0x1f600};
+	const unsigned char expected[] = {0x61,0xc3,0xb1,0xe2,0x82,0xac,0xf0,0x9f,0x98,0x80};
+
+	// Ask for the size, then encode into an exact buffer
+	if(encodeUTF8Into(NULL, 0, mixed, 4) != 10){
+		return 0;
+	}
+	if(encodeUTF8Into(buffer, 10, mixed, 4) != 10 || memcmp(buffer, expected, 10) != 0){
+		return 0;
+	}
+
+	// A short buffer gets the characters that fit
+	memset(buffer, 0, sizeof(buffer));
+	if(encodeUTF8Into(buffer, 8, mixed, 4) != 10 || memcmp(buffer, expected, 6) != 0 || buffer[6] != 0){
+		return 0;
+	}
+
+	// Negative, surrogate and out of range code points
+	const int invalid[] = {-1, 0xd800, 0x110000};
+	for(r = 0; r < 3; r++){
+		if(encodeUTF8Into(buffer, sizeof(buffer), invalid + r, 1) != -1 || convertCodePointToUTF8Binary(invalid[r]) != NULL){
+			return 0;
+		}
+	}
+
+	// A run of ascii broken by a 2 byte character
+	for(r = 0; r < 40; r++){
+		codePoints[r] = r == 20 ? 0xe9 : 'a' + r % 26;
+	}
+	if(encodeUTF8Into(buffer, sizeof(buffer), codePoints, 40) != 41){
+		return 0;
+	}
+	for(r = 0; r < 40; r++){
+		const char * character = buffer + r + (r > 20);
+		if(r == 20 ? ((unsigned char)character[0] != 0xc3 || (unsigned char)character[1] != 0xa9) : character[0] != 'a' + r % 26){
+			return 0;
+		}
+	}
+
+	// The four byte characters
+	const char * smile = convertCodePointToUTF8Binary(0x1f600);
+	if(smile == NULL || memcmp(smile, expected + 6, 4) != 0 || smile[4] != '\0'){
+		return 0;
+	}
+	free((void*)smile);
+	return -1;
+}
+
+// A function that checks the decoding of utf8 buffers into code points
+int testDecodeUTF8ToCodePoints(){
+	int r;
+	char buffer[80];
+	int codePoints[80];
+	size_t errorOffset;
+
+	// n(tilde), euro sign and a four byte character between ascii
+	const unsigned char mixed[] = {0x61,0xc3,0xb1,0xe2,0x82,0xac,0xf0,0x9f,0x98,0x80,0x7a};
+	const int expected[] = {0x61, 0xf1, 0x20ac, 0x1f600, 0x7a};
+	if(decodeUTF8ToCodePoints((const char *)mixed, 11, codePoints, &errorOffset) != 5 || errorOffset != 11){
+		return 0;
+	}
+	for(r = 0; r < 5; r++){
+		if(codePoints[r] != expected[r]){
+			return 0;
+		}
+	}
+
+	// A character cut off by the end of the buffer
+	if(decodeUTF8ToCodePoints((const char *)mixed, 9, codePoints, &errorOffset) != 3 || errorOffset != 6){
+		return 0;
+	}
+
+	// Ascii long enough for the vector path, broken by a stray continuation byte
+	for(r = 0; r < 80; r++){
+		buffer[r] = (char)('a' + r % 26);
+	}
+	buffer[70] = (char)0x80;
+	if(decodeUTF8ToCodePoints(buffer, 80, codePoints, &errorOffset) != 70 || errorOffset != 70){
+		return 0;
+	}
+	for(r = 0; r < 70; r++){
+		if(codePoints[r] != 'a' + r % 26){
+			return 0;
+		}
+	}
+	return -1;
+}
+
+// A function that checks the utf16 length, the utf16 predicates and the
+// transcoders
+int testUTF16(){
+	int r;
+	unsigned short units[64];
+	char utf8[128];
+	size_t errorOffset;
+
+	// n(tilde), e and a combining acute accent, a four byte character and a terminator
+	const unsigned short word[] = {0x6e, 0xf1, 0x65, 0x301, 0xd83d, 0xde00, 0};
+	if(len((const char *)word, UTF16) != 3 || lenBounded((const char *)word, 12, UTF16) != 3){
+		return 0;
+	}
+
+	// An unpaired surrogate and a cut off code unit
+	const unsigned short lone[] = {0x61, 0xdc00, 0x62, 0};
+	if(len((const char *)lone, UTF16) != -1 || lenBounded((const char *)word, 5, UTF16) != -1){
+		return 0;
+	}
+
+	// U+0141 has the same first byte as 'A' in little endian
+	const unsigned short spanish[] = {0x4e, 0x69, 0xf1, 0x6f, 0};
+	const unsigned short notEnglish[] = {0x141, 0};
+	if(isInAlphabetSequence((const char *)spanish, UTF16, SPANISH) != 1 ||
+			isInAlphabetSequence((const char *)spanish, UTF16, ENGLISH) != 0 ||
+			isUpperCaseInAlphabet((const char *)spanish, UTF16, SPANISH) != 1 ||
+			isInAlphabet((const char *)notEnglish, UTF16, ENGLISH) != 0){
+		return 0;
+	}
+
+	// Long enough for the vector paths
+	for(r = 0; r < 40; r++){
+		units[r] = r == 30 ? 0x20ac : (unsigned short)('a' + r % 26);
+	}
+	if(lenBounded((const char *)units, 80, UTF16) != 40){
+		return 0;
+	}
+	if(transcodeUTF16ToUTF8Into(NULL, 0, units, 40, NULL) != 42 ||
+			transcodeUTF16ToUTF8Into(utf8, sizeof(utf8), units, 40, &errorOffset) != 42 || errorOffset != 40){
+		return 0;
+	}
+	memset(units, 0, sizeof(units));
+	if(transcodeUTF8ToUTF16Into(units, 64, utf8, 42, &errorOffset) != 40 || errorOffset != 42 ||
+			units[29] != 'a' + 29 % 26 || units[30] != 0x20ac || units[31] != 'a' + 31 % 26){
+		return 0;
+	}
+
+	// Surrogate pairs, and the offsets of the errors
+	if(transcodeUTF16ToUTF8Into(utf8, sizeof(utf8), word, 6, NULL) != 10 ||
+			(unsigned char)utf8[6] != 0xf0 || (unsigned char)utf8[9] != 0x80){
+		return 0;
+	}
+	if(transcodeUTF8ToUTF16Into(units, 64, utf8, 10, NULL) != 6 || units[4] != 0xd83d || units[5] != 0xde00){
+		return 0;
+	}
+	if(transcodeUTF16ToUTF8Into(utf8, sizeof(utf8), lone, 3, &errorOffset) != -1 || errorOffset != 1){
+		return 0;
+	}
+	if(transcodeUTF8ToUTF16Into(units, 64, "ab\xc3", 3, &errorOffset) != -1 || errorOffset != 2){
+		return 0;
+	}
+	return -1;
+}
+
+// A function that checks the character class tables of the single byte encodings
+int testCharacterClassTable(){
+	const unsigned short * spanish = getCharacterClassTable(ISO_8859_1, SPANISH);
+	const unsigned short * english = getCharacterClassTable(ASCII, ENGLISH);
+	if(spanish == NULL || english == NULL || getCharacterClassTable(UTF8_BINARY, ENGLISH) != NULL ||
+			getCharacterClassTable(ISO_8859_1, 7) != NULL){
+		return 0;
+	}
+	// N with a tilde
+	if(spanish[0xd1] != (CHARACTER_CLASS_ALPHA | CHARACTER_CLASS_UPPER | CHARACTER_CLASS_EXTENDED | CHARACTER_CLASS_VALID)){
+		return 0;
+	}
+	if((english['7'] & CHARACTER_CLASS_DIGIT) == 0 || (english['f'] & CHARACTER_CLASS_HEX) == 0 ||
+			(english['g'] & CHARACTER_CLASS_HEX) != 0 || (english['q'] & CHARACTER_CLASS_ROMANCE) == 0){
+		return 0;
+	}
+
+	// The tables agree with the predicates
+	int c;
+	for(c = 1; c < 256; c++){
+		char character[2] = {(char)c, '\0'};
+		if(((spanish[c] & CHARACTER_CLASS_ALPHA) != 0) != isInAlphabet(character, ISO_8859_1, SPANISH) ||
+				((spanish[c] & CHARACTER_CLASS_LOWER) != 0) != isLowerCaseInAlphabet(character, ISO_8859_1, SPANISH)){
+			return 0;
+		}
+	}
+	return -1;
+}
+
+// A function that checks the unicode class trie of the utf8 and utf16 predicates
+int testUnicodeClassTrie(){
+	// N with a tilde, e with a circumflex and a grinning face
+	if(getUnicodeCharacterClasses(0xd1, SPANISH) != (CHARACTER_CLASS_ALPHA | CHARACTER_CLASS_UPPER | CHARACTER_CLASS_EXTENDED) ||
+			getUnicodeCharacterClasses(0xd1, ENGLISH) != 0 ||
+			(getUnicodeCharacterClasses(0xea, FRENCH) & CHARACTER_CLASS_LOWER) == 0 ||
+			getUnicodeCharacterClasses(0x1f600, FRENCH) != 0 || getUnicodeCharacterClasses(0x141, FRENCH) != 0 ||
+			getUnicodeCharacterClasses('a', 7) != 0 || getUnicodeCharacterClasses(-1, ENGLISH) != 0){
+		return 0;
+	}
+	if(isUpperCaseInAlphabet("\xc3\x89", UTF8_BINARY, FRENCH) != 1 || isLowerCaseInAlphabet("\xc3\x89", UTF8_BINARY, FRENCH) != 0 ||
+			isPunctuationMarkInAlphabet("\xc2\xbf", UTF8_BINARY, SPANISH) != 1 ||
+			isPunctuationMarkInAlphabet("\xc2\xbf", UTF8_BINARY, FRENCH) != 0 ||
+			isInAlphabet("\xc3", UTF8_BINARY, SPANISH) != 0){
+		return 0;
+	}
+	const unsigned short cedilla[] = {0xe7, 0};
+	if(isLowerCaseInAlphabet((const char *)cedilla, UTF16, FRENCH) != 1 || isInAlphabet((const char *)cedilla, UTF16, SPANISH) != 0){
+		return 0;
+	}
+	return -1;
+}
+
+// A function that checks the vector paths of the sequence checks at every offset of a long string
+int testSequenceVectorPaths(){
+	char buffer[101];
+	int r;
+	memset(buffer, 'e', 100);
+	buffer[100] = '\0';
+	if(isInAlphabetSequence(buffer, UTF8_BINARY, FRENCH) != 1 || isLowerCaseInAlphabetSequence(buffer, ISO_8859_1, SPANISH) != 1 ||
+			isHexSequenceBounded(buffer, 100, ASCII) != 1 || isNumberSequenceBounded(buffer, 100, UTF8_BINARY) != 0){
+		return 0;
+	}
+	for(r = 0; r < 99; r++){
+		// A character that fails the check
+		buffer[r] = '!';
+		if(isInAlphabetSequenceBounded(buffer, 100, UTF8_BINARY, FRENCH) != 0 ||
+				isInRomanceAlphabetSequenceBounded(buffer, 100, ISO_8859_1) != 0 ||
+				isPunctuationMarkInAlphabetSequenceBounded(buffer, 100, UTF8_BINARY, ENGLISH) != 0){
+			return 0;
+		}
+		// An e with an acute accent, which is only in the French alphabet
+		buffer[r] = (char)0xc3;
+		buffer[r + 1] = (char)0xa9;
+		if(isInAlphabetSequenceBounded(buffer, 100, UTF8_BINARY, FRENCH) != 1 ||
+				isLowerCaseInAlphabetSequenceBounded(buffer, 100, UTF8_BINARY, FRENCH) != 1 ||
+				isInAlphabetSequenceBounded(buffer, 100, UTF8_BINARY, ENGLISH) != 0 ||
+				isValidCharacterSequenceBounded(buffer, 100, UTF8_BINARY) != 1 ||
+				isValidCharacterSequenceBounded(buffer, r + 1, UTF8_BINARY) != 0){
+			return 0;
+		}
+		buffer[r] = 'e';
+		buffer[r + 1] = 'e';
+	}
+	return -1;
+}
+
+// A function that checks the classes of classifySequence against the sequence checks
+int testClassifySequence(){
+	const char * sequences[] = {"0123", "c0ffee", "Hola", "\xc3\xa9t\xc3\xa9", "\xc2\xbfQu\xc3\xa9?", "ABC", ",.!", "ab\xc3", "\xe9t\xe9", ""};
+	int numberOfSequences = 10;
+	int s;
+	int encoding;
+	int language;
+	if(classifySequence("0123", ASCII, ENGLISH) != (CHARACTER_CLASS_DIGIT | CHARACTER_CLASS_HEX | CHARACTER_CLASS_VALID) ||
+			classifySequence("", UTF8_BINARY, FRENCH) != CHARACTER_CLASS_ALL || classifySequenceBounded("ab\xc3", 3, UTF8_BINARY, ENGLISH) != 0){
+		return 0;
+	}
+	for(s = 0; s < numberOfSequences; s++){
+		size_t numberOfBytes = strlen(sequences[s]);
+		for(encoding = UTF8_BINARY; encoding <= ISO_8859_1; encoding++){
+			for(language = ENGLISH; language <= FRENCH + 1; language++){
+				int classes = classifySequenceBounded(sequences[s], numberOfBytes, encoding, language);
+				if(((classes & CHARACTER_CLASS_DIGIT) != 0) != isNumberSequenceBounded(sequences[s], numberOfBytes, encoding) ||
+						((classes & CHARACTER_CLASS_HEX) != 0) != isHexSequenceBounded(sequences[s], numberOfBytes, encoding) ||
+						((classes & CHARACTER_CLASS_VALID) != 0) != isValidCharacterSequenceBounded(sequences[s], numberOfBytes, encoding) ||
+						((classes & CHARACTER_CLASS_ALPHA) != 0) != isInAlphabetSequenceBounded(sequences[s], numberOfBytes, encoding, language) ||
+						((classes & CHARACTER_CLASS_PUNCT) != 0) != isPunctuationMarkInAlphabetSequenceBounded(sequences[s], numberOfBytes, encoding, language) ||
+						((classes & CHARACTER_CLASS_UPPER) != 0) != isUpperCaseInAlphabetSequenceBounded(sequences[s], numberOfBytes, encoding, language) ||
+						((classes & CHARACTER_CLASS_LOWER) != 0) != isLowerCaseInAlphabetSequenceBounded(sequences[s], numberOfBytes, encoding, language)){
+					return 0;
+				}
+			}
+		}
+	}
+	return -1;
+}
+
+// A function that checks the counts of classHistogram on the vector and the scalar paths
+int testClassHistogram(){
+	characterClassHistogram histogram;
+	char buffer[201];
+	int r;
+	// An upper case E with an acute accent, a combining acute accent and an inverted question mark
+	if(classHistogram("\xc3\x89t\xc3\xa9 e\xcc\x81 \xc2\xbfQu\xc3\xa9? 42", UTF8_BINARY, FRENCH, &histogram) != 1 ||
+			histogram.numberOfCharacters != 15 || histogram.upperCase != 2 || histogram.lowerCase != 5 ||
+			histogram.digits != 2 || histogram.extended != 3 || histogram.diacriticalMarks != 1){
+		return 0;
+	}
+	if(classHistogram("\xe9t\xe9!", ISO_8859_1, SPANISH, &histogram) != 1 || histogram.numberOfCharacters != 4 ||
+			histogram.alphabet != 3 || histogram.punctuationMarks != 1 || classHistogramBounded("ab\xc3", 3, UTF8_BINARY, ENGLISH, &histogram) != 0 ||
+			histogram.numberOfCharacters != 2){
+		return 0;
+	}
+	for(r = 0; r < 200; r++){
+		buffer[r] = "Hello, World 2014! "[r % 19];
+	}
+	buffer[200] = '\0';
+	for(r = 0; r < 199; r += 13){
+		// An n with a tilde, which is only in the Spanish alphabet
+		buffer[r] = (char)0xc3;
+		buffer[r + 1] = (char)0xb1;
+		if(classHistogram(buffer, UTF8_BINARY, SPANISH, &histogram) != 1 || histogram.numberOfCharacters != (size_t)(199 - r / 13) ||
+				histogram.extended != (size_t)(r / 13 + 1)){
+			return 0;
+		}
+	}
+	return -1;
+}
+
+// A function that checks the prefixes of spanOf and the offsets of findFirstNot
+int testSpanOf(){
+	size_t codePointOffset = 0;
+	char buffer[101];
+	int r;
+	// Leading digits and the rest of the string
+	if(spanOf(CHARACTER_CLASS_DIGIT, "2014 \xc3\xa9t\xc3\xa9", UTF8_BINARY, FRENCH, &codePointOffset) != 4 || codePointOffset != 4 ||
+			spanOf(CHARACTER_CLASS_ALPHA, "\xc3\xa9t\xc3\xa9 2014", UTF8_BINARY, FRENCH, &codePointOffset) != 5 || codePointOffset != 3 ||
+			spanOf(CHARACTER_CLASS_ALPHA, "\xc3\xa9t\xc3\xa9 2014", UTF8_BINARY, ENGLISH, NULL) != 0 ||
+			spanOf(CHARACTER_CLASS_ALPHA | CHARACTER_CLASS_DIGIT, "abc123!", ASCII, ENGLISH, NULL) != 6){
+		return 0;
+	}
+	if(findFirstNot(CHARACTER_CLASS_HEX, "c0ffee", ASCII, ENGLISH, &codePointOffset) != -1 || codePointOffset != 6 ||
+			findFirstNotBounded(CHARACTER_CLASS_VALID, "ab\xc3\xa9\xc3", 5, UTF8_BINARY, ENGLISH, &codePointOffset) != 4 ||
+			codePointOffset != 3){
+		return 0;
+	}
+	memset(buffer, 'e', 100);
+	buffer[100] = '\0';
+	for(r = 0; r < 99; r++){
+		// The offsets of a failing character on the vector and the scalar paths
+		buffer[r] = '!';
+		if(findFirstNot(CHARACTER_CLASS_LOWER, buffer, UTF8_BINARY, SPANISH, &codePointOffset) != r || codePointOffset != (size_t)r ||
+				findFirstNot(CHARACTER_CLASS_ROMANCE, buffer, ISO_8859_1, FRENCH, NULL) != r){
+			return 0;
+		}
+		buffer[r] = (char)0xc3;
+		buffer[r + 1] = (char)0xb1;
+		if(spanOf(CHARACTER_CLASS_ALPHA, buffer, UTF8_BINARY, SPANISH, &codePointOffset) != 100 || codePointOffset != 99 ||
+				findFirstNot(CHARACTER_CLASS_ALPHA, buffer, UTF8_BINARY, FRENCH, &codePointOffset) != r || codePointOffset != (size_t)r){
+			return 0;
+		}
+		buffer[r] = 'e';
+		buffer[r + 1] = 'e';
+	}
+	return -1;
+}
+
+// A function that checks the generated language tables
+int testLanguageTables(){
+	int language;
+	int c;
+	if(NUMBER_OF_LANGUAGES != FRENCH + 1 || strcmp(languageNames[ENGLISH], "ENGLISH") != 0 ||
+			strcmp(languageNames[SPANISH], "SPANISH") != 0 || strcmp(languageNames[FRENCH], "FRENCH") != 0){
+		return 0;
+	}
+	// The languages past the tables have no classes
+	if(getCharacterClassTable(ASCII, NUMBER_OF_LANGUAGES) != NULL || getUnicodeCharacterClasses('a', NUMBER_OF_LANGUAGES) != 0 ||
+			getUnicodeCharacterClasses(0x10000, ENGLISH) != 0){
+		return 0;
+	}
+	for(language = ENGLISH; language < NUMBER_OF_LANGUAGES; language++){
+		const unsigned short * ascii = getCharacterClassTable(ASCII, language);
+		const unsigned short * iso = getCharacterClassTable(ISO_8859_1, language);
+		if(ascii == NULL || iso == NULL){
+			return 0;
+		}
+		// Every language has the romance core and the digits in every encoding
+		for(c = 0; c < 128; c++){
+			int romance = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+			int digit = c >= '0' && c <= '9';
+			if(((ascii[c] & CHARACTER_CLASS_ROMANCE) != 0) != romance || ((iso[c] & CHARACTER_CLASS_ROMANCE) != 0) != romance ||
+					((getUnicodeCharacterClasses(c, language) & CHARACTER_CLASS_ROMANCE) != 0) != romance ||
+					((getUnicodeCharacterClasses(c, language) & CHARACTER_CLASS_DIGIT) != 0) != digit){
+				return 0;
+			}
+		}
+	}
+	return -1;
+}
+
+// A function that checks the language scores
+int testScoreLanguages(){
+	long long scores[NUMBER_OF_LANGUAGES];
+	long long batchScores[4][NUMBER_OF_LANGUAGES];
+	int languages[4];
+	const char * sequences[4] = {"The weather was warm, so we went for a walk with the dog.",
+			"El ni\xc3\xb1o llama a su hermano todos los lunes.", "Le gar\xc3\xa7on mange une pomme \xc2\xab d\xc3\xa9licieuse \xc2\xbb.",
+			"ab\xc3"};
+	size_t numberOfBytes[4];
+	int s;
+	if(scoreLanguages(sequences[0], UTF8_BINARY, scores) != ENGLISH || scores[ENGLISH] <= scores[SPANISH] ||
+			scoreLanguages(sequences[1], UTF8_BINARY, scores) != SPANISH || scores[ENGLISH] >= 0 ||
+			scoreLanguages(sequences[2], UTF8_BINARY, scores) != FRENCH){
+		return 0;
+	}
+	// Inverted marks in iso-8859-1 and in utf16
+	const unsigned short units[] = {0xbf, 'Q', 'u', 0xe9, '?', 0};
+	if(scoreLanguages("\xbfQu\xe9?", ISO_8859_1, scores) != SPANISH || scoreLanguages((const char *)units, UTF16, scores) != SPANISH ||
+			scoreLanguages("\xbfQu\xe9?", ASCII, scores) != ENGLISH){
+		return 0;
+	}
+	// No evidence, a malformed character and an unknown encoding
+	if(scoreLanguages("1234", UTF8_BINARY, scores) != ENGLISH || scores[SPANISH] != 0 ||
+			scoreLanguages(sequences[3], UTF8_BINARY, scores) != -1 || scoreLanguages("abc", 7, scores) != -1){
+		return 0;
+	}
+	for(s = 0; s < 4; s++){
+		numberOfBytes[s] = strlen(sequences[s]);
+	}
+	if(scoreLanguagesBatch(sequences, numberOfBytes, 4, UTF8_BINARY, batchScores, languages) != 3 ||
+			languages[0] != ENGLISH || languages[1] != SPANISH || languages[2] != FRENCH || languages[3] != -1 ||
+			scoreLanguages(sequences[2], UTF8_BINARY, scores) != FRENCH || memcmp(scores, batchScores[2], sizeof(scores)) != 0 ||
+			scoreLanguagesBatch(sequences, numberOfBytes, 3, UTF8_BINARY, NULL, languages) != 3){
+		return 0;
+	}
+	return -1;
+}
+
+// A function that checks the grapheme cluster length mode
+int testLenGraphemeClusters(){
+	int encoding = UTF8_BINARY | LEN_GRAPHEME_CLUSTERS;
+	char buffer[101];
+	int r;
+	// e and a combining acute accent, a CR LF pair and a four byte emoji
+	if(len("e\xcc\x81t\xc3\xa9", encoding) != 3 || len("a\r\nb\r\n", encoding) != 4 ||
+			len("\xf0\x9f\x98\x80", encoding) != 1 || len("\xf0\x9f\x98\x80", UTF8_BINARY) != 0){
+		return 0;
+	}
+	// A family of three joined by ZWJs, a thumbs up with a skin tone, and a heart with a variation selector
+	if(len("\xf0\x9f\x91\xa8\xe2\x80\x8d\xf0\x9f\x91\xa9\xe2\x80\x8d\xf0\x9f\x91\xa7", encoding) != 1 ||
+			len("\xf0\x9f\x91\x8d\xf0\x9f\x8f\xbd!", encoding) != 2 || len("\xe2\x9d\xa4\xef\xb8\x8f", encoding) != 1){
+		return 0;
+	}
+	// Two and a half flags of regional indicators, and a Hangul syllable of jamo
+	if(len("\xf0\x9f\x87\xab\xf0\x9f\x87\xb7\xf0\x9f\x87\xaa\xf0\x9f\x87\xb8\xf0\x9f\x87\xba", encoding) != 3 ||
+			len("\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab", encoding) != 1){
+		return 0;
+	}
+	const unsigned short units[] = {'e', 0x301, 0xd83d, 0xdc4d, 0xd83c, 0xdffd, 0};
+	if(len((const char *)units, UTF16 | LEN_GRAPHEME_CLUSTERS) != 2 || len("a\r\n\xe9", ISO_8859_1 | LEN_GRAPHEME_CLUSTERS) != 3 ||
+			lenBounded("ab\xc3", 3, encoding) != -1 || len("abc", 7 | LEN_GRAPHEME_CLUSTERS) != -1){
+		return 0;
+	}
+	// A combining mark and a CR LF at every offset of the vectors of an ascii run
+	memset(buffer, 'e', 100);
+	buffer[100] = '\0';
+	for(r = 1; r < 98; r++){
+		buffer[r] = '\r';
+		buffer[r + 1] = '\n';
+		if(len(buffer, encoding) != 99){
+			return 0;
+		}
+		buffer[r] = (char)0xcc;
+		buffer[r + 1] = (char)0x81;
+		if(len(buffer, encoding) != 98){
+			return 0;
+		}
+		buffer[r] = 'e';
+		buffer[r + 1] = 'e';
+	}
+	return -1;
+}
+
+// A function that checks the NFC and NFD normalization
+int testNormalization(){
+	char buffer[160];
+	char normalized[160];
+	size_t errorOffset;
+	int r;
+	// e and a combining acute accent is the precomposed e of the French alphabet after NFC
+	const char * decomposed = "e\xcc\x81t\xc3\xa9";
+	if(isInAlphabetSequence(decomposed, UTF8_BINARY, FRENCH) ||
+			normalizeUTF8Into(normalized, sizeof(normalized), decomposed, strlen(decomposed), NORMALIZATION_NFC, NULL) != 5 ||
+			memcmp(normalized, "\xc3\xa9t\xc3\xa9", 5) != 0){
+		return 0;
+	}
+	normalized[5] = '\0';
+	if(!isInAlphabetSequence(normalized, UTF8_BINARY, FRENCH) ||
+			normalizeUTF8Into(normalized, sizeof(normalized), "\xc3\xa9t\xc3\xa9", 5, NORMALIZATION_NFD, NULL) != 7 ||
+			memcmp(normalized, "e\xcc\x81te\xcc\x81", 7) != 0){
+		return 0;
+	}
+	// The marks below go before the marks above, and a Hangul syllable of jamo and the angstrom sign compose
+	if(normalizeUTF8Into(normalized, sizeof(normalized), "a\xcc\x81\xcc\xa3", 5, NORMALIZATION_NFD, NULL) != 5 ||
+			memcmp(normalized, "a\xcc\xa3\xcc\x81", 5) != 0 ||
+			normalizeUTF8Into(normalized, sizeof(normalized), "a\xcc\x81\xcc\xa3", 5, NORMALIZATION_NFC, NULL) != 5 ||
+			memcmp(normalized, "\xe1\xba\xa1\xcc\x81", 5) != 0 ||
+			normalizeUTF8Into(normalized, sizeof(normalized), "\xe1\x84\x92\xe1\x85\xa1\xe1\x86\xab", 9, NORMALIZATION_NFC, NULL) != 3 ||
+			memcmp(normalized, "\xed\x95\x9c", 3) != 0 ||
+			normalizeUTF8Into(normalized, sizeof(normalized), "\xe2\x84\xab", 3, NORMALIZATION_NFC, NULL) != 2 ||
+			memcmp(normalized, "\xc3\x85", 2) != 0){
+		return 0;
+	}
+	if(quickCheckNormalizationUTF8("caf\xc3\xa9", 5, NORMALIZATION_NFC, NULL) != NORMALIZATION_YES ||
+			quickCheckNormalizationUTF8(decomposed, 6, NORMALIZATION_NFC, NULL) != NORMALIZATION_MAYBE ||
+			quickCheckNormalizationUTF8("\xe2\x84\xab", 3, NORMALIZATION_NFC, NULL) != NORMALIZATION_NO ||
+			quickCheckNormalizationUTF8("caf\xc3\xa9", 5, NORMALIZATION_NFD, NULL) != NORMALIZATION_NO ||
+			quickCheckNormalizationUTF8("a\xcc\x81\xcc\xa3", 5, NORMALIZATION_NFD, NULL) != NORMALIZATION_NO ||
+			quickCheckNormalizationUTF8("ab\xc3", 3, NORMALIZATION_NFC, &errorOffset) != -1 || errorOffset != 2 ||
+			quickCheckNormalizationUTF8("ab", 2, 2, NULL) != -1){
+		return 0;
+	}
+	// Only whole characters that fit are written, and the full size is returned
+	memset(normalized, 'x', sizeof(normalized));
+	if(normalizeUTF8Into(normalized, 4, "caf\xc3\xa9", 5, NORMALIZATION_NFC, NULL) != 5 || memcmp(normalized, "cafx", 4) != 0 ||
+			normalizeUTF8Into(normalized, 4, decomposed, 6, NORMALIZATION_NFC, NULL) != 5 || memcmp(normalized, "\xc3\xa9tx", 4) != 0 ||
+			normalizeUTF8Into(NULL, 0, decomposed, 6, NORMALIZATION_NFD, NULL) != 7 ||
+			normalizeUTF8Into(normalized, sizeof(normalized), "ab\xc3", 3, NORMALIZATION_NFC, &errorOffset) != -1 || errorOffset != 2){
+		return 0;
+	}
+	// A combining accent at every offset of the vectors of an ascii run
+	memset(buffer, 'e', 100);
+	for(r = 1; r < 98; r++){
+		buffer[r] = (char)0xcc;
+		buffer[r + 1] = (char)0x81;
+		if(quickCheckNormalizationUTF8(buffer, 100, NORMALIZATION_NFC, NULL) != NORMALIZATION_MAYBE ||
+				normalizeUTF8Into(normalized, sizeof(normalized), buffer, 100, NORMALIZATION_NFC, NULL) != 99 ||
+				(unsigned char)normalized[r - 1] != 0xc3 || (unsigned char)normalized[r] != 0xa9 || normalized[98] != 'e' ||
+				normalizeUTF8Into(normalized, sizeof(normalized), buffer, 100, NORMALIZATION_NFD, NULL) != 100){
+			return 0;
+		}
+		buffer[r] = 'e';
+		buffer[r + 1] = 'e';
+	}
+	// More combining marks on a character than a segment holds, which only
+	// the quick check of NFD finds in order
+	buffer[0] = 'a';
+	for(r = 1; r + 1 < 150; r += 2){
+		buffer[r] = (char)0xcc;
+		buffer[r + 1] = (char)0x81;
+	}
+	if(normalizeUTF8Into(normalized, sizeof(normalized), buffer, 149, NORMALIZATION_NFD, NULL) != 149 ||
+			normalizeUTF8Into(normalized, sizeof(normalized), buffer, 149, NORMALIZATION_NFC, &errorOffset) != -1){
+		return 0;
+	}
+	return -1;
+}
+
+// A function that checks the case conversions of the alphabets
+int testCaseConversion(){
+	char buffer[101];
+	char expected[101];
+	const char * pattern = "abcXYZ 09!";
+	int r;
+	int s;
+	int letters;
+	strcpy(buffer, "ni\xc3\xb1o y CAF\xc3\x89");
+	if(toUpperInAlphabet(buffer, UTF8_BINARY, SPANISH) != 5 || strcmp(buffer, "NI\xc3\x91O Y CAF\xc3\x89") != 0 ||
+			toLowerInAlphabet(buffer, UTF8_BINARY, SPANISH) != 9 || strcmp(buffer, "ni\xc3\xb1o y caf\xc3\xa9") != 0){
+		return 0;
+	}
+	// The n with a tilde is not in the English alphabet, and the upper case y with a diaeresis is not in the French one
+	if(toUpperInAlphabet(buffer, UTF8_BINARY, ENGLISH) != 7 || strcmp(buffer, "NI\xc3\xb1O Y CAF\xc3\xa9") != 0 ||
+			toUpperInAlphabet(strcpy(buffer, "\xc3\xbf"), UTF8_BINARY, FRENCH) != 0){
+		return 0;
+	}
+	strcpy(buffer, "\xe7" "a \xe9t\xe9");
+	if(toUpperInAlphabet(buffer, ISO_8859_1, FRENCH) != 5 || strcmp(buffer, "\xc7" "A \xc9T\xc9") != 0 ||
+			toLowerInAlphabet(buffer, ASCII, FRENCH) != 2 || strcmp(buffer, "\xc7" "a \xc9t\xc9") != 0){
+		return 0;
+	}
+	unsigned short units[] = {'n', 0xf1, 0x100, 0};
+	if(toUpperInAlphabet((char *)units, UTF16, SPANISH) != 2 || units[0] != 'N' || units[1] != 0xd1 || units[2] != 0x100){
+		return 0;
+	}
+	// A malformed character stops the conversion, and unknown encodings and languages are errors
+	strcpy(buffer, "ab\xc3");
+	if(toUpperInAlphabetBounded(buffer, 3, UTF8_BINARY, ENGLISH) != -1 || strncmp(buffer, "AB", 2) != 0 ||
+			toUpperInAlphabet(buffer, UTF8_BINARY, NUMBER_OF_LANGUAGES) != -1 || toLowerInAlphabet(buffer, UTF16 + 1, ENGLISH) != -1){
+		return 0;
+	}
+	// A two byte letter at every offset of the vectors of an ascii run
+	for(r = 0; r < 99; r++){
+		letters = 1;
+		for(s = 0; s < 100; s++){
+			buffer[s] = pattern[s % 10];
+			expected[s] = buffer[s] >= 'a' && buffer[s] <= 'z' ? (char)(buffer[s] - 32) : buffer[s];
+		}
+		for(s = 0; s < 100; s++){
+			letters += (s < r || s > r + 1) && buffer[s] >= 'a' && buffer[s] <= 'z';
+		}
+		memcpy(buffer + r, "\xc3\xb1", 2);
+		memcpy(expected + r, "\xc3\x91", 2);
+		if(toUpperInAlphabetBounded(buffer, 100, UTF8_BINARY, SPANISH) != letters || memcmp(buffer, expected, 100) != 0){
+			return 0;
+		}
+		// The same letter in iso-8859-1, with an ascii byte after it
+		for(s = 0, letters = 0; s < 100; s++){
+			letters += (s < r || s > r + 1) && expected[s] >= 'A' && expected[s] <= 'Z';
+		}
+		buffer[r] = (char)0xf1;
+		expected[r] = (char)0xd1;
+		buffer[r + 1] = expected[r + 1] = '!';
+		if(toLowerInAlphabetBounded(buffer, 100, ISO_8859_1, SPANISH) != letters ||
+				toUpperInAlphabetBounded(buffer, 100, ISO_8859_1, SPANISH) != letters + 1 || memcmp(buffer, expected, 100) != 0){
+			return 0;
+		}
+	}
+	return -1;
+}
+
+// A function that checks the diacritic folding of search keys
+int testFoldDiacritics(){
+	char buffer[101];
+	char expected[101];
+	char folded[101];
+	const char * pattern = "abcXYZ 09!";
+	size_t errorOffset;
+	int r;
+	int s;
+	// Precomposed letters and combining marks, with the case of the alphabet
+	if(foldDiacriticsInto(folded, sizeof(folded), "\xc3\x91" "and\xc3\xba caf\xc3\xa9", 13, UTF8_BINARY, SPANISH,
+			FOLD_KEEP_CASE, &errorOffset) != 10 || memcmp(folded, "Nandu cafe", 10) != 0 || errorOffset != 13 ||
+			foldDiacriticsInto(folded, sizeof(folded), "Cafe\xcc\x81" "s", 7, UTF8_BINARY, ENGLISH, FOLD_LOWER_CASE, NULL) != 5 ||
+			memcmp(folded, "cafes", 5) != 0 ||
+			foldDiacriticsInto(folded, sizeof(folded), "\xd1" "and\xfa", 5, ISO_8859_1, FRENCH, FOLD_UPPER_CASE, NULL) != 5 ||
+			memcmp(folded, "NANDU", 5) != 0){
+		return 0;
+	}
+	// The letters that are no extended letter are kept, as are the bytes past ascii in ascii
+	if(foldDiacriticsInto(folded, sizeof(folded), "\xc3\xa6\xe2\x82\xac" "e", 6, UTF8_BINARY, FRENCH, FOLD_UPPER_CASE,
+			NULL) != 6 || memcmp(folded, "\xc3\xa6\xe2\x82\xac" "E", 6) != 0 ||
+			foldDiacriticsInto(folded, sizeof(folded), "\xe9", 1, ASCII, FRENCH, FOLD_KEEP_CASE, NULL) != 1 ||
+			folded[0] != (char)0xe9){
+		return 0;
+	}
+	// A NULL buffer asks for the size, a small one gets the whole characters that fit
+	memset(folded, 0, sizeof(folded));
+	if(foldDiacriticsInto(NULL, 0, "a\xc3\xa9\xe2\x82\xac", 6, UTF8_BINARY, SPANISH, FOLD_KEEP_CASE, NULL) != 5 ||
+			foldDiacriticsInto(folded, 3, "a\xc3\xa9\xe2\x82\xac", 6, UTF8_BINARY, SPANISH, FOLD_KEEP_CASE, NULL) != 5 ||
+			strcmp(folded, "ae") != 0){
+		return 0;
+	}
+	// The text is folded in place
+	strcpy(buffer, "ni\xc3\xb1o \xc3\x89t\xc3\xa9");
+	if(foldDiacriticsInto(buffer, sizeof(buffer), buffer, strlen(buffer), UTF8_BINARY, FRENCH, FOLD_LOWER_CASE, NULL) != 8 ||
+			memcmp(buffer, "nino ete", 8) != 0){
+		return 0;
+	}
+	unsigned short units[] = {0xd1, 'a', 0x301, 0x100, 0xd800};
+	unsigned short foldedUnits[4];
+	if(foldDiacriticsInto((char *)foldedUnits, sizeof(foldedUnits), (const char *)units, 8, UTF16, SPANISH, FOLD_KEEP_CASE,
+			NULL) != 6 || foldedUnits[0] != 'N' || foldedUnits[1] != 'a' || foldedUnits[2] != 0x100 ||
+			foldDiacriticsInto(NULL, 0, (const char *)units, 10, UTF16, SPANISH, FOLD_KEEP_CASE, &errorOffset) != -1 ||
+			errorOffset != 8){
+		return 0;
+	}
+	// Malformed characters, and unknown languages and cases
+	if(foldDiacriticsInto(folded, sizeof(folded), "ab\xc3", 3, UTF8_BINARY, ENGLISH, FOLD_KEEP_CASE, &errorOffset) != -1 ||
+			errorOffset != 2 || foldDiacriticsInto(folded, sizeof(folded), "ab", 2, UTF8_BINARY, NUMBER_OF_LANGUAGES,
+			FOLD_KEEP_CASE, NULL) != -1 || foldDiacriticsInto(folded, sizeof(folded), "ab", 2, UTF8_BINARY, ENGLISH, 3, NULL) != -1){
+		return 0;
+	}
+	// A two byte letter at every offset of the vectors of an ascii run, in utf8 and iso-8859-1
+	for(r = 0; r < 99; r++){
+		for(s = 0; s < 100; s++){
+			buffer[s] = pattern[s % 10];
+			expected[s] = buffer[s] >= 'a' && buffer[s] <= 'z' ? (char)(buffer[s] - 32) : buffer[s];
+		}
+		memcpy(buffer + r, "\xc3\xb1", 2);
+		memcpy(expected + r, "N", 1);
+		memmove(expected + r + 1, expected + r + 2, 98 - r);
+		if(foldDiacriticsInto(folded, sizeof(folded), buffer, 100, UTF8_BINARY, SPANISH, FOLD_UPPER_CASE, NULL) != 99 ||
+				memcmp(folded, expected, 99) != 0){
+			return 0;
+		}
+		// The same letter in iso-8859-1, with an ascii byte after it
+		buffer[r] = (char)0xf1;
+		buffer[r + 1] = '!';
+		memmove(expected + r + 2, expected + r + 1, 98 - r);
+		expected[r + 1] = '!';
+		if(foldDiacriticsInto(folded, sizeof(folded), buffer, 100, ISO_8859_1, SPANISH, FOLD_UPPER_CASE, NULL) != 100 ||
+				memcmp(folded, expected, 100) != 0){
+			return 0;
+		}
+	}
+	return -1;
+}
+
+// A function that checks the comparison and hashing of folded texts
+int testCompareFolded(){
+	char first[101];
+	char second[101];
+	const char * pattern = "abcXYZ 09!";
+	const unsigned short units[] = {0xd1, 'A', 'n', 'd', 'u', 0x301};
+	int r;
+	int s;
+	// The folded texts are the same without their case and diacritics, in any encoding
+	if(compareFolded("\xc3\x91" "and\xc3\xba", 7, "NANDU", 5, UTF8_BINARY, SPANISH) != 0 ||
+			compareFolded("cafe\xcc\x81", 6, "CAF\xc3\x89", 5, UTF8_BINARY, FRENCH) != 0 ||
+			hashFolded("\xc3\x91" "and\xc3\xba", 7, UTF8_BINARY, SPANISH) != hashFolded("nandu", 5, ASCII, SPANISH) ||
+			hashFolded("\xd1" "and\xfa", 5, ISO_8859_1, SPANISH) != hashFolded("nandu", 5, UTF8_BINARY, SPANISH) ||
+			hashFolded((const char *)units, sizeof(units), UTF16, SPANISH) != hashFolded("nandu", 5, UTF8_BINARY, ENGLISH) ||
+			compareFolded("", 0, NULL, 0, UTF8_BINARY, ENGLISH) != 0 || hashFolded("", 0, ASCII, ENGLISH) != hashFolded(NULL, 0, UTF8_BINARY, FRENCH)){
+		return 0;
+	}
+	// The order is that of the folded code points, and a malformed character is after every character
+	if(compareFolded("abc", 3, "ABD", 3, UTF8_BINARY, ENGLISH) >= 0 || compareFolded("abc", 3, "AB", 2, UTF8_BINARY, ENGLISH) <= 0 ||
+			compareFolded("\xc3\xa9", 2, "\xc3\xa6", 2, UTF8_BINARY, FRENCH) >= 0 ||
+			compareFolded("a\xc3", 2, "a\xf0\x9f\x98\x80", 5, UTF8_BINARY, ENGLISH) <= 0 ||
+			hashFolded("a\xc3", 2, UTF8_BINARY, ENGLISH) == hashFolded("a", 1, UTF8_BINARY, ENGLISH) ||
+			hashFolded("a", 1, UTF8_BINARY, ENGLISH) == hashFolded("a\0", 2, UTF8_BINARY, ENGLISH)){
+		return 0;
+	}
+	// An unknown language compares the bytes as they are
+	if(compareFolded("a", 1, "A", 1, UTF8_BINARY, NUMBER_OF_LANGUAGES) <= 0 ||
+			hashFolded("a", 1, UTF8_BINARY, NUMBER_OF_LANGUAGES) == hashFolded("A", 1, UTF8_BINARY, NUMBER_OF_LANGUAGES)){
+		return 0;
+	}
+	// A difference and an accented letter at every offset of the vectors of an ascii run
+	for(r = 0; r < 99; r++){
+		for(s = 0; s < 100; s++){
+			first[s] = pattern[s % 10];
+			second[s] = first[s] >= 'a' && first[s] <= 'z' ? (char)(first[s] - 32) : first[s];
+		}
+		if(compareFolded(first, 100, second, 100, UTF8_BINARY, ENGLISH) != 0 ||
+				hashFolded(first, 100, UTF8_BINARY, ENGLISH) != hashFolded(second, 100, UTF8_BINARY, ENGLISH)){
+			return 0;
+		}
+		second[r] = '#';
+		if((compareFolded(first, 100, second, 100, UTF8_BINARY, ENGLISH) > 0) != (first[r] > '#') ||
+				compareFolded(first, 100, second, 100, UTF8_BINARY, ENGLISH) == 0 ||
+				hashFolded(first, 100, UTF8_BINARY, ENGLISH) == hashFolded(second, 100, UTF8_BINARY, ENGLISH)){
+			return 0;
+		}
+		first[r] = 'e';
+		memmove(second + r + 2, first + r + 1, 99 - r);
+		memcpy(second + r, "\xc3\x89", 2);
+		if(compareFolded(first, 100, second, 101, UTF8_BINARY, SPANISH) != 0 ||
+				hashFolded(first, 100, UTF8_BINARY, SPANISH) != hashFolded(second, 101, UTF8_BINARY, SPANISH)){
+			return 0;
+		}
+	}
+	return -1;
+}
+
+// A function that checks the escaped lengths of compiled escape schemes
+int testEscapeScheme(){
+	static char buffer[40001];
+	const char * text = "caf\xc3\xa9 \\u00e9t\xc3\xa9";
+	escapeScheme scheme;
+	escapeScheme decimalScheme;
+	lenCounter counter;
+	size_t r;
+	// The control and end strings are short and ascii
+	if(compileEscapeScheme(&scheme, NULL, ASCII_HEX_UTF_ESCAPE, NULL) || compileEscapeScheme(&scheme, "", ASCII_HEX_UTF_ESCAPE, NULL) ||
+			compileEscapeScheme(&scheme, "0123456789abcdefg", ASCII_HEX_UTF_ESCAPE, NULL) ||
+			compileEscapeScheme(&scheme, "\xc2\xa7", ASCII_HEX_UTF_ESCAPE, NULL) || compileEscapeScheme(&scheme, "\\u", 2, NULL) ||
+			compileEscapeScheme(&scheme, "&#", ASCII_DECIMAL_UTF_ESCAPE, "\xc2\xa7") ||
+			lenEscapedCompiled("ab", 2, ASCII, &scheme) != -1 || lenEscapedCompiled("ab", 2, ASCII, NULL) != -1){
+		return 0;
+	}
+	// One scheme for strings in ascii and utf8
+	if(!compileEscapeScheme(&scheme, "\\u", ASCII_HEX_UTF_ESCAPE, NULL) ||
+			lenEscapedCompiled("Happy \\u0069 Mildew", 19, ASCII, &scheme) != 14 ||
+			lenEscapedCompiled(text, strlen(text), UTF8_BINARY, &scheme) != 8 ||
+			lenEscapedCompiled(text, strlen(text), UTF16, &scheme) != -1 ||
+			lenEscapedCompiled("\xc3\\u0041", 8, UTF8_BINARY, &scheme) != -1 ||
+			lenEscapedCompiled("\\u00e", 5, UTF8_BINARY, &scheme) != -1 || lenEscapedCompiled("ab\\u", 4, UTF8_BINARY, &scheme) != 4){
+		return 0;
+	}
+	// A control string that starts again inside a failed match
+	if(!compileEscapeScheme(&decimalScheme, "aab", ASCII_DECIMAL_UTF_ESCAPE, ";") ||
+			lenEscapedCompiled("aaab12;c", 8, ASCII, &decimalScheme) != 3 ||
+			lenEscapedBounded("aaab12;c", 8, ASCII, "aab", ASCII_DECIMAL_UTF_ESCAPE, ";") != 3 ||
+			lenEscapedBounded("xaaaaab769;", 11, UTF8_BINARY, "aab", ASCII_DECIMAL_UTF_ESCAPE, ";") != 4){
+		return 0;
+	}
+	// A control string that no number follows is plain text
+	if(!compileEscapeScheme(&decimalScheme, "&#", ASCII_DECIMAL_UTF_ESCAPE, ";") ||
+			lenEscapedCompiled("a&#;b", 5, ASCII, &decimalScheme) != 5 || lenEscapedCompiled("a&#x;b", 6, UTF8_BINARY, &decimalScheme) != 6 ||
+			lenEscapedCompiled("&#&#65;", 7, ASCII, &decimalScheme) != 3 ||
+			lenEscapedBounded("a&#;b", 5, ASCII, "&#", ASCII_DECIMAL_UTF_ESCAPE, ";") != 5){
+		return 0;
+	}
+	// The counter carries the utf8 characters and the control strings over the chunks
+	lenCounterInitCompiled(&counter, UTF8_BINARY, &scheme);
+	for(r = 0; r < strlen(text); r++){
+		lenCounterUpdate(&counter, text + r, 1);
+	}
+	if(lenCounterFinish(&counter) != 8){
+		return 0;
+	}
+	// A run of plain text that is longer than a block
+	for(r = 0; r + 2 <= 39990; r += 2){
+		memcpy(buffer + r, "\xc3\xa9", 2);
+	}
+	memcpy(buffer + r, "\\u0041aaab", 10);
+	if(lenEscapedCompiled(buffer, r + 10, UTF8_BINARY, &scheme) != (int)(r / 2) + 5 ||
+			lenEscapedCompiled(buffer, r + 1, UTF8_BINARY, &scheme) != (int)(r / 2) + 1){
+		return 0;
+	}
+	return -1;
+}
+
+// A function that checks the decoding of escaped sequences
+int testUnescape(){
+	char buffer[64];
+	char decoded[64];
+	escapeScheme hexScheme;
+	escapeScheme decimalScheme;
+	size_t errorOffset;
+	if(!compileEscapeScheme(&hexScheme, "\\u", ASCII_HEX_UTF_ESCAPE, NULL) ||
+			!compileEscapeScheme(&decimalScheme, "&#", ASCII_DECIMAL_UTF_ESCAPE, ";")){
+		return 0;
+	}
+	// Plain utf8 is copied and the sequences are decoded, a surrogate pair to one character
+	if(unescapeUTF8Into(decoded, sizeof(decoded), "Happy \\u0069 Mildew", 19, &hexScheme, &errorOffset) != 14 ||
+			memcmp(decoded, "Happy i Mildew", 14) != 0 || errorOffset != 19 ||
+			unescapeUTF8Into(decoded, sizeof(decoded), "caf\xc3\xa9 \\u00E9\\ud83d\\ude00", 24, &hexScheme, NULL) != 12 ||
+			memcmp(decoded, "caf\xc3\xa9 \xc3\xa9\xf0\x9f\x98\x80", 12) != 0){
+		return 0;
+	}
+	// The end string is optional, and a control string without digits is plain text
+	if(unescapeUTF8Into(decoded, sizeof(decoded), "&#233;&#128512x&#;&", 19, &decimalScheme, NULL) != 11 ||
+			memcmp(decoded, "\xc3\xa9\xf0\x9f\x98\x80x&#;&", 11) != 0 ||
+			unescapeUTF8Into(decoded, sizeof(decoded), "a\\u", 3, &hexScheme, NULL) != 3 || memcmp(decoded, "a\\u", 3) != 0){
+		return 0;
+	}
+	// The same characters as lenEscapedCompiled counts
+	if(unescapeUTF8Into(decoded, sizeof(decoded), "a&#;b", 5, &decimalScheme, NULL) != lenEscapedCompiled("a&#;b", 5, UTF8_BINARY, &decimalScheme) ||
+			unescapeUTF8Into(decoded, sizeof(decoded), "a&#x;b", 6, &decimalScheme, NULL) != lenEscapedCompiled("a&#x;b", 6, UTF8_BINARY, &decimalScheme)){
+		return 0;
+	}
+	// A NULL buffer asks for the size, a small one gets the whole characters that fit
+	memset(decoded, 0, sizeof(decoded));
+	if(unescapeUTF8Into(NULL, 0, "ab\\u00e9\\u20ac", 14, &hexScheme, NULL) != 7 ||
+			unescapeUTF8Into(decoded, 5, "ab\\u00e9\\u20ac", 14, &hexScheme, NULL) != 7 || strcmp(decoded, "ab\xc3\xa9") != 0){
+		return 0;
+	}
+	// The text is decoded in place
+	strcpy(buffer, "x\\u00e9y\\ud83d\\ude00z");
+	if(unescapeUTF8Into(buffer, sizeof(buffer), buffer, strlen(buffer), &hexScheme, NULL) != 9 ||
+			memcmp(buffer, "x\xc3\xa9y\xf0\x9f\x98\x80z", 9) != 0){
+		return 0;
+	}
+	// Unpaired surrogates, malformed sequences and malformed utf8
+	if(unescapeUTF8Into(decoded, sizeof(decoded), "\\ud83d x", 8, &hexScheme, &errorOffset) != -1 || errorOffset != 0 ||
+			unescapeUTF8Into(decoded, sizeof(decoded), "a\\ude00", 7, &hexScheme, &errorOffset) != -1 || errorOffset != 1 ||
+			unescapeUTF8Into(decoded, sizeof(decoded), "ab\\u00g0", 8, &hexScheme, &errorOffset) != -1 || errorOffset != 2 ||
+			unescapeUTF8Into(decoded, sizeof(decoded), "&#1114112;", 10, &decimalScheme, &errorOffset) != -1 || errorOffset != 0 ||
+			unescapeUTF8Into(decoded, sizeof(decoded), "ab\xff\\u0041", 9, &hexScheme, &errorOffset) != -1 || errorOffset != 2 ||
+			unescapeUTF8Into(decoded, sizeof(decoded), "ab", 2, NULL, NULL) != -1){
+		return 0;
+	}
+	return -1;
+}
+
+// A function that checks the parallel length and sequence checks against the serial ones
+int testParallel(){
+	size_t r;
+	char buffer[3001];
+	parallelOptions options = {4, 1, 7};
+
+	// n(tilde), euro sign, an ascii letter and a combining acute accent, split at every offset of a 7 byte chunk
+	const unsigned char pattern[] = {0xc3,0xb1,0xe2,0x82,0xac,0x65,0xcc,0x81};
+	for(r = 0; r < 3000; r++){
+		buffer[r] = pattern[r % sizeof(pattern)];
+	}
+	buffer[3000] = '\0';
+	if(lenParallel(buffer, 3000, UTF8_BINARY, &options) != lenBounded(buffer, 3000, UTF8_BINARY)){
+		return 0;
+	}
+	if(lenParallel(buffer, 3000, UTF8_BINARY, NULL) != lenBounded(buffer, 3000, UTF8_BINARY)){
+		return 0;
+	}
+	if(isLanguageSequenceParallel(isInAlphabetSequenceBounded, buffer, 3000, UTF8_BINARY, FRENCH, &options) != 0){
+		return 0;
+	}
+	// The single byte encodings are the number of bytes, even past the int of lenBounded
+	if(sizeof(size_t) > 4 && (lenParallel(buffer, (size_t)3 << 30, ISO_8859_1, NULL) != (long long)3 << 30 ||
+			lenParallel(buffer, (size_t)3 << 30, UTF8_BINARY | LEN_GRAPHEME_CLUSTERS, NULL) != -1)){
+		return 0;
+	}
+
+	// An invalid byte in the middle of the buffer
+	buffer[1500] = (char)0xff;
+	if(lenParallel(buffer, 3000, UTF8_BINARY, &options) != -1){
+		return 0;
+	}
+
+	memset(buffer, '7', 3000);
+	if(isSequenceParallel(isNumberSequenceBounded, buffer, 3000, ASCII, &options) != 1){
+		return 0;
+	}
+	buffer[2999] = 'a';
+	if(isSequenceParallel(isNumberSequenceBounded, buffer, 3000, ASCII, &options) != 0 ||
+			isSequenceParallel(isHexSequenceBounded, buffer, 3000, ASCII, &options) != 1){
+		return 0;
+	}
+	return -1;
+}
+
 // A function that tests the main points of functionality associated with the
 int testStringUtils(){
 	// The success/failure count
@@ -910,23 +2056,37 @@ int testStringUtils(){
 	int failureCount = 0;
 
 	int testIter = 0;
-	int numberOfTests = 30;
-	int (*test_Array[30])() = {testGetUTF8State, testStringLength, testConvertHex, testIsNumber,
+	int numberOfTests = 55;
+	int (*test_Array[55])() = {testGetUTF8State, testStringLength, testConvertHex, testIsNumber,
 			testStringLengthEscaped, testIsNumberSequence,testIsDiacriticalMarkUTF8, testIsUTF8BinaryCodePoint,
 			testIsUTFBinaryCharacterInUTFSet, testIsInRomanceAlphabet, testIsHex, testIsHexSequence,
 			testIsSpanishExtendCharacter, testIsFrenchExtendCharacter, testConvertUTF8BinaryToCodePoint,testConvertCodePointToUTF8Binary,
 			testIsInAlphabet,testConvertCodePointListToUTF8Binary,testIsValidCharacterSequence, testInRomanceAlphabetSequence,
 			testInAphabetSequence,testIsUpperCaseInAlphabet, testIsLowerCaseInAlphabet,testIsUpperCaseInAlphabetSequence,
 			testIsLowerCaseInAlphabetSequence, testGetCharacterStrideLength, testIsPunctuationMarkInAlphabet,testIsPunctuationMarkInAlphabetSequence,
-			testIsSequenceAtIndex, testIsLanguageSequenceAtIndex};
-	const char * testNames[30] = {"UTF8State test", "String Length test", "Convert hex test", "Is number test",
+			testIsSequenceAtIndex, testIsLanguageSequenceAtIndex, testStringLengthUTF8Blocks,
+			testStringLengthBounded, testSequenceBounded, testDecodeUTF8Character, testValidateUTF8, testLenCounter,
+			testParallel, testEncodeUTF8Into, testDecodeUTF8ToCodePoints,
+			testUTF16, testCharacterClassTable, testUnicodeClassTrie,
+			testSequenceVectorPaths, testClassifySequence, testClassHistogram,
+			testSpanOf, testLanguageTables, testScoreLanguages, testLenGraphemeClusters,
+			testNormalization, testCaseConversion, testFoldDiacritics,
+			testCompareFolded, testEscapeScheme, testUnescape};
+	const char * testNames[55] = {"UTF8State test", "String Length test", "Convert hex test", "Is number test",
 			"String Length Unescaped test", "IsNumberSequence test", "TestIsDiacriticalMarkUTF8 test", "IsUTF8BinaryCodePoint test",
 			"Is UTF8 Character in Code Point Set test", "Is Romance Character test", "Is Hex Character test", "Is Hex Sequence test",
 			"Is Spanish Extended Character Test","Is French Extend Character Set", "Convert UTF8 Binary To Code Point Test","Convert Code Point to UTF8 binary",
 			"Is In Alphabet Test", "Convert Code Points to UTF8 binary","Test is valid Character sequence", "Test is In Romance Alphabet Sequence",
 			"Test Is In Aphabet Sequence", "Test is Upper Case in Alphabet", "Test is Lower Case in Alphabet", "Test is Upper Case in Alphabet Sequence",
 			"Test is Lower Case in Alphabet Sequence", "Test Get Character Stride Length", "Test Is Punctuation Mark in Alphabet","Test Is Punctuation Mark in Alphabet Sequence",
-			"Test if Sequence is at Index", "Test is Language Sequence at Index"};
+			"Test if Sequence is at Index", "Test is Language Sequence at Index", "String Length UTF8 Blocks test",
+			"String Length Bounded test", "Sequence Bounded test", "Decode UTF8 Character test", "Validate UTF8 test", "Length Counter test",
+			"Parallel test", "Encode UTF8 Into test", "Decode UTF8 To Code Points test",
+			"UTF16 test", "Character Class Table test", "Unicode Class Trie test",
+			"Sequence Vector Paths test", "Classify Sequence test", "Class Histogram test",
+			"Span Of test", "Language Tables test", "Score Languages test", "Length Grapheme Clusters test",
+			"Normalization test", "Case Conversion test", "Fold Diacritics test",
+			"Compare Folded test", "Escape Scheme test", "Unescape test"};
 	for(testIter = 0; testIter < numberOfTests; testIter++){
 		const char * testName = testNames[testIter];
 		int (*test)() = test_Array[testIter];
@@ -48,10 +48,10 @@ def runTests(compile):
     for root, dirs, list_of_files in os.walk(os.getcwd()):
         for f in list_of_files:
             fileName, fileExt = os.path.splitext(f)
-            if fileExt == ".c":
+            if fileExt == ".c" or fileExt == ".cc":
                 
                 # Save the actual file name and the executable associated with the filename
-                listOfCTests.append((root + "/" + f, f.replace('Test.c', '')))
+                listOfCTests.append((root + "/" + f, fileName.replace('Test', '')))
             elif fileExt == ".js":
                 listOfJavascriptTests.append(root + "/" + f)
             elif fileExt == ".py":
@@ -59,9 +59,10 @@ def runTests(compile):
                     listOfPythonTests.append(root + "/" + f)
     if compile:
         
-        # Iterate over the tests and create a gcc executable for each test
+        # Iterate over the tests and create a gcc or g++ executable for each test
         for testFile, executable in listOfCTests:
-            cmd = ['gcc','-I../lib', '-o', executable, testFile]
+            compiler = 'g++' if testFile.endswith('.cc') else 'gcc'
+            cmd = [compiler,'-I../lib', '-o', executable, testFile]
             p = subprocess.Popen(cmd,stdout=subprocess.PIPE)
             p.wait()
             